@@ -51,9 +51,19 @@
  *         (
  *             int MAX_RDX_NODES,
  *             int NUM_KEYS,
- *             int MAX_KEY_BYTES
+ *             int MAX_KEY_BYTES,
+ *             unsigned int OPTIONS = 0,  // RDX_ORDER_STATS, RDX_EXPIRY, RDX_EVICT and RDX_LOCALITY or'ed together
+ *             const unsigned char *NONUNIQUE = NULL,  // unsigned char NONUNIQUE[NUM_KEYS] - 1 for a non-unique key index
+ *             const allocator &ALLOC = allocator()  // MKRdxPat<app_data, allocator> - allocator of the trie storage,
+ *                                                   // default std::allocator<unsigned char>
  *         )
  *         e.g. MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(512, 3, 4);
+ *         e.g. MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(512, 3, 4, RDX_ORDER_STATS | RDX_EXPIRY);
+ *
+ *         RDX_ORDER_STATS - keep the subtree counts for rank(), select() and sample()
+ *         RDX_EXPIRY - keep the data node expiry times for set_expiry() and expire()
+ *         RDX_EVICT - insert() into a full trie evicts a data node not recently used(CLOCK)
+ *         RDX_LOCALITY - a new branch node is the free branch node nearest its parent
  *
  *
  *     ~MKRdxPat()
@@ -79,6 +89,83 @@
  *         int data;  // user specified application data structure
  *     };
  *
+ *         int
+ *     insert
+ *         (
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             app_data **app_datapp,
+ *             node_handle *handle
+ *         )
+ *         e.g. int return_code = rdx->insert((unsigned char *)key, &app_datap, &handle);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         int
+ *     insert_hint
+ *         (
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             app_data **app_datapp,
+ *             node_handle *hint
+ *         )
+ *         e.g. int return_code = rdx->insert_hint((unsigned char *)key, &app_datap, &hint);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         template <typename... Args>
+ *         int
+ *     emplace
+ *         (
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             app_data **app_datapp,
+ *             Args&&... args  // app_data constructor arguments
+ *         )
+ *         e.g. int return_code = rdx->emplace((unsigned char *)key, &app_datap, 1, "name");
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         int
+ *     upsert
+ *         (
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             app_data **app_datapp,
+ *             bool *inserted
+ *         )
+ *         e.g. int return_code = rdx->upsert((unsigned char *)key, &app_datap, &inserted);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         int
+ *     insert_batch
+ *         (
+ *             const unsigned char *key,  // unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES]
+ *             const int n,
+ *             app_data **app_datapp,     // app_data *app_datapp[n]
+ *             int *return_code           // int return_code[n]
+ *         )
+ *         e.g. int ninserted = rdx->insert_batch((unsigned char *)key, n, app_datap, return_code);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
  *         app_data *
  *     search
  *         (
@@ -93,6 +180,47 @@
  *     };
  *
  *         app_data *
+ *     search
+ *         (
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             node_handle *handle
+ *         )
+ *         e.g. app_data *app_datap = rdx->search((unsigned char *)key, &handle);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         app_data *
+ *     search_hint
+ *         (
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             node_handle *hint
+ *         )
+ *         e.g. app_data *app_datap = rdx->search_hint((unsigned char *)key, &hint);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         app_data *
+ *     data
+ *         (
+ *             const node_handle handle
+ *         )
+ *         e.g. app_data *app_datap = rdx->data(handle);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         app_data *
  *     remove
  *         (
  *             const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
@@ -100,6 +228,81 @@
  *         e.g. app_data *app_datap = rdx->remove((unsigned char *)key);
  *
  *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         app_data *
+ *     remove
+ *         (
+ *             const node_handle handle
+ *         )
+ *         e.g. app_data *app_datap = rdx->remove(handle);
+ *
+ *
+ *         void
+ *     clear
+ *         (
+ *         )
+ *         e.g. rdx->clear();
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         int
+ *     remove_batch
+ *         (
+ *             const unsigned char *key,  // unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES]
+ *             const int n,
+ *             app_data **app_datapp      // app_data *app_datapp[n]
+ *         )
+ *         e.g. int nremoved = rdx->remove_batch((unsigned char *)key, n, app_datap);
+ *
+ *
+ *         int
+ *     remove_prefix
+ *         (
+ *             const int k,
+ *             const unsigned char *prefix,
+ *             const int prefix_bits
+ *         )
+ *         e.g. int n = rdx->remove_prefix(k, prefix, prefix_bits);
+ *
+ *
+ *         int
+ *     remove_range
+ *         (
+ *             const int k,
+ *             const unsigned char *lo,  // unsigned char lo[MAX_KEY_BYTES]
+ *             const unsigned char *hi   // unsigned char hi[MAX_KEY_BYTES]
+ *         )
+ *         e.g. int n = rdx->remove_range(k, lo, hi);
+ *
+ *
+ *         int
+ *     rekey
+ *         (
+ *             const unsigned char *key,     // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             const int k,
+ *             const unsigned char *new_key  // unsigned char new_key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. int return_code = rdx->rekey((unsigned char *)key, k, new_key);
+ *
+ *
+ *         int
+ *     rekey
+ *         (
+ *             const node_handle handle,
+ *             const int k,
+ *             const unsigned char *new_key  // unsigned char new_key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. int return_code = rdx->rekey(handle, k, new_key);
+ *
+ *
  *         int
  *     sort
  *         (
@@ -118,1078 +321,6708 @@
  *
  *
  *         int
- *     alloc_nodes
+ *     keys
  *         (
- *         ) const
- *         e.g. int alloc_nodes = rdx->alloc_nodes();
+ *             const node_handle handle,
+ *             unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *         )
+ *         e.g. int return_code = rdx->keys(handle, (unsigned char *)key);
  *
  *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
  *         int
- *     bsize
+ *     bulk_load
  *         (
- *         ) const
- *         e.g. int bsize = rdx->bsize();
+ *             const unsigned char *key,  // unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES]
+ *             const app_data *data,
+ *             const int n
+ *         )
+ *         e.g. int return_code = rdx->bulk_load((unsigned char *)key, data, n);
  *
  *
  *         int
- *     max_rdx_nodes
+ *     dump
  *         (
- *         ) const
- *         e.g. int max_rdx_nodes = rdx->max_rdx_nodes();
+ *             std::ostream &os
+ *         )
+ *         e.g. int n = rdx->dump(os);
  *
  *
  *         int
- *     num_keys
+ *     load
  *         (
- *         ) const
- *         e.g. int num_keys = rdx->num_keys();
+ *             std::istream &is
+ *         )
+ *         e.g. int return_code = rdx->load(is);
  *
  *
- *         int
- *     max_key_bytes 
+ *         iterator
+ *     begin
  *         (
- *         ) const
- *         e.g. int max_key_bytes = rdx->max_key_bytes();
+ *             const int k
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->begin(k);
  *
  *
- *         MKRdxPat<app_data> *
- *     chg_max_rdx_nodes 
+ *         iterator
+ *     end
  *         (
- *             const unsigned int new_max_rdx_nodes
- *         ) const
- *         e.g. MKRdxPat<app_data> *rdx_new = rdx_old->chg_max_rdx_nodes(new_max_rdx_nodes);
+ *             const int k
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->end(k);
  *
  *
- *         int
- *     print
+ *         reverse_iterator
+ *     rbegin
  *         (
- *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
- *             ofstream& os
+ *             const int k
  *         )
- *         e.g. int return_code = rdx->print(NULL, os);
- *         e.g. int return_code = rdx->print((unsigned char *)key, os);
+ *         e.g. MKRdxPat<app_data>::reverse_iterator rit = rdx->rbegin(k);
  *
  *
- *         int
- *     verify
+ *         reverse_iterator
+ *     rend
  *         (
- *             VERIFY_MODE vm,
- *             ofstream& os
+ *             const int k
  *         )
- *         e.g. int return_code = rdx->verify(ERR_CODE, os);
- *         e.g. int return_code = rdx->verify(ERR_CODE_PRINT, os);
+ *         e.g. MKRdxPat<app_data>::reverse_iterator rit = rdx->rend(k);
  *
- *======================================================================================================================
  *
- * Description:
- *     The MKRdxPat class allows the allocation of a fixed sized contiguous data store that holds data nodes
- *     of an arbitrary structure that may be accessed with any number of keys of any size with the PATRICIA
- *     (Practical Algorithm To Retrieve Information Coded In Alphanumeric)(1,2,3) fast search algorithm.
- *     MKRdxPat is particularly suited to applications that require complex data structures be contiguously
- *     stored and accessed with an algorithm of known fast character with any of several possible keys,
- *     either singly of several simultaneously.
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
  *
- *     For example, a data structure that required either of an IPv4, IPv6 or MAC address key(s) to access
- *     data nodes.  In this case NUM_KEYS would be 3 and MAX_KEY_BYTES would be 16(the longest - see below).
+ *         template <typename callback>
+ *         int
+ *     range
+ *         (
+ *             const int k,
+ *             const unsigned char *lo,  // unsigned char lo[MAX_KEY_BYTES]
+ *             const unsigned char *hi,  // unsigned char hi[MAX_KEY_BYTES]
+ *             callback cb               // int cb(app_data *app_datap, const unsigned char *key)
+ *         )
+ *         e.g. int n = rdx->range(k, lo, hi, [](app_data *app_datap, const unsigned char *key) -> int { return 0; });
  *
- *     The MKRdxPat class supports a data structure of MAX_RDX_NODES data nodes and NUM_KEYS keys per
- *     data node with keys of MAX_KEY_BYTES bytes or less.  The class constructor:
  *
- *         MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
  *
- *     along with a:
+ *         template <typename callback>
+ *         int
+ *     for_each_prefix
+ *         (
+ *             const int k,
+ *             const unsigned char *prefix,
+ *             const int prefix_bits,
+ *             callback cb  // int cb(app_data *app_datap, const unsigned char *key)
+ *         )
+ *         e.g. int n = rdx->for_each_prefix(k, prefix, 24, [](app_data *app_datap, const unsigned char *key) -> int { return 0; });
  *
- *         struct app_data
- *         {
- *             // user data
- *         };
  *
- *     class constructor typename specifies the data structure.  A data node may be accessed with a single
- *     key or any number of keys simultaneously.  Keys must be unique within their key index(0 - NUM_KEYS-1),
- *     but not over different key indexes.  Member functions that require keys are passed the array:
+ *         iterator
+ *     lower_bound
+ *         (
+ *             const int k,
+ *             const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->lower_bound(k, key);
  *
- *         unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
  *
- *     One extra prefix byte, a key boolean - required to be 0(ignore) or 1(search), is set with each key to
- *     specify if the key is to be used in the data node search.  It is suggested that the array be first
- *     memset() to 0:
+ *         iterator
+ *     upper_bound
+ *         (
+ *             const int k,
+ *             const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->upper_bound(k, key);
  *
- *         memset(key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
  *
- *     and then only keys to be used copied in with the key boolean(set to 1) prepended.
+ *         std::pair<iterator, iterator>
+ *     equal_range
+ *         (
+ *             const int k,
+ *             const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. std::pair<MKRdxPat<app_data>::iterator, MKRdxPat<app_data>::iterator> r = rdx->equal_range(k, key);
  *
- *     In most cases the necessary keys will be of different lengths.  The MAX_KEY_BYTES constructor argument
- *     would be set to the longest of these.  All other shorter keys would be left justified in the key[][]
- *     array, that is, start just after the key boolean.  Thus, for the example above, the IPv6 key would use
- *     the full 16 bytes, the IPv4 key would use the first four bytes after the key boolean(with the rest(12)
- *     set to 0) and the MAC key would use the first 6 bytes after the key boolean(with the rest(10) set to
- *     0).  This was done to make the specification of the key[][] array and the code associated with
- *     processing it simpler.  Actually, the IPv4 and MAC addresses could be right justified, just so long as
- *     all the keys are always right justified and the other bytes are 0; you just have to be consistent
- *     within any given key index.  From the way that PATRICIA works the keys are examined from left to
- *     right.  Thus, it makes sense to left justify.  Then, the actual key bits are examined instead of
- *     examining irrelevent 0 bits first.  The suffixed 0 bits are not a factor in the data node search since
- *     the key bits on the left will find a data node if all inserts were made with the same number of key
- *     bits on the left e.g. 32 for an IPv4 address.  Example:
  *
- *                 kb key bytes
- *         IPv4 :  01 c0 a8 00 01 00 00 00 00 00 00 00 00 00 00 00 00 - 192.168.0.1
- *         IPv6 :  01 fe 80 00 00 00 00 00 00 02 21 2f ff fe b5 6e 10 - fe80::221:2fff:feb5:6e10
- *         MAC  :  01 00 21 2f b5 6e 10 00 00 00 00 00 00 00 00 00 00 - 00:21:2f:b5:6e:10
+ *         iterator
+ *     successor
+ *         (
+ *             const int k,
+ *             const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->successor(k, key);
  *
- *     Let's suppose that we wanted to find a data node with just the IPv6 address.  We first memset()
- *     key[][] to 0.  We then add the IPv6 address with it's key boolean set to 1 and pass the key[][] array
- *     to the member functions.  Thus:
  *
- *                 kb key bytes
- *         IPv4 :  00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 - 0
- *         IPv6 :  01 fe 80 00 00 00 00 00 00 02 21 2f ff fe b5 6e 10 - fe80::221:2fff:feb5:6e10
- *         MAC  :  00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 - 0
+ *         iterator
+ *     predecessor
+ *         (
+ *             const int k,
+ *             const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->predecessor(k, key);
  *
- *     See the member function summary above or a detailed member function usage comment before each
- *     function's code.  A verify() member function is provided that does extensive data structure memory
- *     analysis and a print() member function is provided that prints the structural details of all the
- *     branch and data nodes.
  *
- *     For a trie of NUM_KEYS keys, each data node will have NUM_KEYS branch nodes associated with it.  The
- *     number of actual data nodes in the data structure is MAX_RDX_NODES+1.  This extra node is for the
- *     initial branch nodes and initial data node with the impossible key of all 0xff's(1,2,3).  The number
- *     of user storable nodes is MAX_RDX_NODES.   The user, through the constructor, declares PNODEs,
- *     each of which contains a radix PATRICIA trie of MAX_RDX_NODES nodes with NUM_KEYS keys of
- *     at most MAX_KEY_BYTES bytes length.
+ *         iterator
+ *     min
+ *         (
+ *             const int k
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->min(k);
  *
- *     These routines are a modification of the algorithm cited.  Specifically, the upward pointers used to
- *     terminate search are not used, and are instead used to point to data nodes as trie leaves.  In
- *     multi-key search with PATRICIA the upward pointer scheme will not work since each key would have
- *     pointed to a different branch node with it's associated data structure.  In multi-key PATRICIA search
- *     all keys must lead to the same data node.  The viability of multi-key radix PATRICIA search depends
- *     on the fact that each data node insertion requires only one new branch node for each key, thus the
- *     initial allocation of NUM_KEYS branch nodes with each data node.  This implementation has several
- *     additional branch and data node members not used in the original PATRICIA search algorithm.  These
- *     are for various purposes; related to changes in the original algorithm for multi-key search, related
- *     to changes in the original algorithm for leaf data nodes instead of upward pointers to data structures
- *     stored in branch nodes, related to printing, related to sorting and debugging.
  *
- *======================================================================================================================
+ *         iterator
+ *     max
+ *         (
+ *             const int k
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->max(k);
  *
- * Error Handling
  *
- *     1. Exceptions - The #include <exception> header is used to define exception objects throw()'n
- *                     upon calloc() failures.  Calloc() failures are thrown in the class constructor
- *                     MKRdxPat(), the chg_max_rdx_nodes() member function and the verify() member
- *                     function.  All other errors are reported via return values.
- *     2. Debugging  - Debugging output is provided for the class constructor - MKRdxPat() and member
- *                     functions insert(), search() and remove().  A debug() macro is provided.  It
- *                     will generte output if any one of three defines - DEBUG_I(insert()), DEBUG_S(search()),
- *                     DEBUG_R(remove()) - are set to 1.  If any of these are set to 1 then debug output for
- *                     MKRdxPat() will happen.
- *     3. Returns    - Member functions can return error indications.  These are documented in the comment
- *                     headings of the functions.  These are much faster than exceptions and should be
- *                     handled locally.
+ *         int
+ *     rank
+ *         (
+ *             const int k,
+ *             const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+ *         )
+ *         e.g. int n = rdx->rank(k, key);
  *
- *======================================================================================================================
  *
- * Operational Notes:
+ *         iterator
+ *     select
+ *         (
+ *             const int k,
+ *             const int i
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->select(k, i);
  *
- *     1. the first member of BNODE and DNODE typedefs, id, should not be moved.  when doing operations on the
- *        trie, a search will reference the id from a BNODE type initially and then terminate at a DNODE type.
  *
- *     2. the maximum number of key bits is MAX_KEY_BITS.  the impossible key in the initially allocated data
- *        node must be at least one bit longer.  this requires the data node storage for the keys to have one
- *        extra byte.
+ *         template <typename generator>
+ *         iterator
+ *     sample
+ *         (
+ *             const int k,
+ *             generator &gen  // a uniform random bit generator, e.g. std::mt19937_64
+ *         )
+ *         e.g. MKRdxPat<app_data>::iterator it = rdx->sample(k, gen);
  *
- *     3. all keys are the same length - MAX_KEY_BYTES bytes.  the performance hit, the small memory savings
- *        and the added code complexity of having individually sized keys did not seem worth it.  thus, the
- *        longest required key will determine MAX_KEY_BYTES.  shorter keys may be left justified in the
- *        MAX_KEY_BYTES bytes.
  *
- *     4. it is suggested that the 'unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]' array be first memset() to
- *        0 and then all the keys to be used with key boolean 1 added in one operation(keys with key boolean
- *        0 are never needed) e.g. memset(key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));.
+ *         int
+ *     set_expiry
+ *         (
+ *             const node_handle handle,
+ *             const unsigned long long t
+ *         )
+ *         e.g. int return_code = rdx->set_expiry(handle, now + timeout);
  *
- *     5. multidemensional arrays in C++ are implemented by subscripting calloc()'ed memory with parameterized
- *        values calculated from the C array versions.  One, two and three dimensional arrays are illustrated
- *        as follows(see verify() for actual usage):
  *
- *        n -> subscripts max_rdx_nodes_
- *        k -> subscripts num_keys_
- *        b -> subscripts max_key_bytes_:
+ *         unsigned long long
+ *     expiry
+ *         (
+ *             const node_handle handle
+ *         )
+ *         e.g. unsigned long long t = rdx->expiry(handle);
  *
- *        a. one dimensional:
- *           unsigned long verify_dnode_addrs_[max_rdx_nodes_+1];
- *               -> verify_dnode_addrs_[n]
  *
- *        b. two dimensional:
- *           unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
- *               -> verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
  *
- *        c. three dimensional:
- *           unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_];
- *               -> verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
+ *         template <typename callback>
+ *         int
+ *     expire
+ *         (
+ *             const unsigned long long now,
+ *             const int budget,
+ *             callback cb  // int cb(app_data *app_datap, node_handle handle)
+ *         )
+ *         e.g. int n = rdx->expire(now, 1000, [](app_data *app_datap, MKRdxPat<app_data>::node_handle handle) -> int { return 0; });
  *
- *======================================================================================================================
  *
- * Theoretic Notes:
+ *         int
+ *     expire
+ *         (
+ *             const unsigned long long now,
+ *             const int budget
+ *         )
+ *         e.g. int n = rdx->expire(now, 1000);
  *
- *     1. depending on the key structure it is possible for the trie to be very unbalanced.  for a three byte
- *        key, for example, if 24 keys are inserted, each with only one different bit set, then the resulting
- *        trie would be a string of branch nodes extending to the left, each with a data node on its right
- *        branch.  the maximum trie depth would be 24 with the key of all zeros.
  *
- *     2. for the N node trie with b bit keys, even for very long keys, the average search requires log2(N)
- *        bit comparisons, and the average trie depth is log2(N).  see reference 1.  for a full key space,
- *        N = 2**b, log2(2**b) = b, and the average trie depth approaches b.
+ *         int
+ *     alloc_nodes
+ *         (
+ *         ) const
+ *         e.g. int alloc_nodes = rdx->alloc_nodes();
  *
- *     3. note that insertion requires two traversals of the trie - one to find if the key(s) already exists
- *        and the other to do the actual insertion.  the user may think that there must be a way to traverse
- *        down the trie only once to do an insertion.  the answer is YES! But.  in order to know where to
- *        stop you need to know all the key bits that intervene between the two b bit parameters of each
- *        branch node.  thus you would have to store these bits in each branch node or you could store any
- *        full key from any data node below a branch node in that branch node, which, by the property of a
- *        PATRICIA trie, will all have prefix bits identical for all data nodes below that branch node.  if,
- *        on insertion, the insertion key had bits differing between the two b bit parameters of two branch
- *        nodes then an insertion would be done at that point.  all this key storage and bit comparison in
- *        each traversed branch node is inefficient.  the first search traversal finds the key that does not
- *        match, but this key has all the key bits needed to find the first key bit of the new key that is
- *        different from the nearest key already in the trie.  this first differing bit then tells the second
- *        traversal where to stop and insert the new key.  thus, dual traversal is more efficient and simpler.
  *
- *======================================================================================================================
+ *         size_t
+ *     bsize
+ *         (
+ *         ) const
+ *         e.g. size_t bsize = rdx->bsize();
  *
- * References:
  *
- *     1. Algorithms in C++ Third Edition Parts 1-4, Robert Sedgewick with Christopher J. Van Wyk,
- *        Addison-Wesley, 1998, Chapter 15.3 Patricia Tries, pp. 637.
+ *         int
+ *     max_rdx_nodes
+ *         (
+ *         ) const
+ *         e.g. int max_rdx_nodes = rdx->max_rdx_nodes();
  *
- *     2. PATRICIA - Practical Algorithm To Retrieve Information Coded in Alphanumeric, Donald R. Morrison,
- *        Journal of the Association for Computing Machinery, Vol. 15, No. 4, Oct. 1968, pp. 514-534.
  *
- *     3. The Art of Computer Programming: Sorting and Searching, Donald E. Knuth,
- *        Addison-Wesley, 1973, pp 490-499.
+ *         int
+ *     num_keys
+ *         (
+ *         ) const
+ *         e.g. int num_keys = rdx->num_keys();
  *
- *======================================================================================================================
  *
- * Author: Richard Hogaboom
- *         richard.hogaboom@gmail.com
+ *         int
+ *     max_key_bytes 
+ *         (
+ *         ) const
+ *         e.g. int max_key_bytes = rdx->max_key_bytes();
  *
- *======================================================================================================================
- */
-
-#include <vector>
-#include <string>
-#include <algorithm>
-#include <iostream>
-#include <cstdlib>
-#include <cstring>
-#include <exception>
-
-using std::vector;
-using std::string;
-using std::ofstream;
-
-namespace MultiKeyRdxPat
-{
-    #define DEBUG_I 0 // 0/1 for debug output in insert()
-    #define DEBUG_S 0 // 0/1 for debug output in search()
-    #define DEBUG_R 0 // 0/1 for debug output in remove()
-
-    #define debug(fmt, ...) if (DEBUG_I or DEBUG_S or DEBUG_R) fprintf(stdout, "%s:%d:%s(): " fmt, \
-                                                                               __FILE__, __LINE__, __func__, __VA_ARGS__);
-
-    // verify_mode arg to verify()
-    typedef enum verify_mode
-    {
-        ERR_CODE,            // return 0 for no error and positive int with error code for any errors
-        ERR_CODE_PRINT       // return same error code above but also print current data structure data
-                             // node addresses/keys, branch node addresses and error messages
-    } VERIFY_MODE;
-
-    template <typename app_data> class MKRdxPat
-    {
-        private:
-
-            //
-            // typedefs
-            //
-
-            // branch node typedef
-            typedef struct bnode
-            {
-                unsigned int id;     // IDentification(id=0 branch node,id=1 data node) - must be first field in node
-                unsigned int br;     // br=0: from left parent BRanch - br=1: from right parent BRanch
-                void *p;             // ptr to Parent node
-                unsigned int nsn;    // Node Sequence Number - 0->max_rdx_nodes_
-                unsigned int b;      // Bit number to do branch test on(bits start at 0 from right to left)
-                void *l, *r;         // Left and Right node ptrs
-            } BNODE;
-
-            // data node typedef for application declarations.  the key must have one extra byte from max_key_bytes_
-            // specified above in order to have an "impossible" key data node set at initialization
-            typedef struct dnode
-            {
-                unsigned int id;     // IDentification(id=1) for data node - must be first field in node
-                unsigned int *br;    // br=0: from left parent BRanch - br=1: from right parent branch - br[num_keys_]
-                BNODE **p;           // ptr to Parent node - p[num_keys_]
-                unsigned int nsn;    // Node Sequence Number - 0->max_rdx_nodes_
-                void *nnfp;          // Next Node Free Ptr
-                unsigned int alloc;  // 1 - allocated in rdx trie, 0 - on free queue
-                unsigned char *key;  // search KEY(s) - key[num_keys_][1+max_key_bytes_]
-                app_data data;       // user defined data structure
-            } DNODE;
-
-            // typedef of struct for PATRICIA node holding max_rdx_nodes_ data
-            // nodes with num_keys_ keys of length max_key_bytes_
-            typedef struct pnode
-            {
-                // rdx trie size in bytes - includes all data and branch nodes including the root node
-                unsigned int bsize;
-
-                // total number of nodes allocated(does not include root(0xff key) node)
-                unsigned int alloc_nodes;
-
-                // head of rdx search node trie for each key
-                BNODE **head;  // BNODE *head[num_keys_]
-
-                // array holding ptrs to app_data used in sort()
-                app_data **app_data_ptrs;  // app_data *app_data_ptrs[max_rdx_nodes_+1]
-
-                // number of ptrs in node_ptrs array(not including root node)
-                unsigned int app_data_ptrs_cnt;
-
-                // branch nodes and free queue head ptr(s) of branch nodes
-                BNODE *bnodes;  // BNODE bnodes[max_rdx_nodes_+1][num_keys_]
-                BNODE **bfree_head;  // BNODE *bfree_head[num_keys_]
-
-                // data nodes and free queue head ptr of data nodes
-                DNODE *dnodes;  // DNODE dnodes[max_rdx_nodes_+1]
-                DNODE *dfree_head;
-            } PNODE_;
-
-
-            //
-            // private data
-            //
-
-            const int max_rdx_nodes_;
-            const int num_keys_;
-            const int max_key_bytes_;
-
-
-            //
-            // variables related to insert()
-            //
-
-            // during search insert_p_[] and insert_c_[] are successively set to parent and child nodes
-            // down the trie.  if a new key is to be inserted bna will be the branch node address linked
-            // between insert_p_[] and insert_c_[] and dna will be the data node address linked as the
-            // other child of bna.  num_keys_ branch nodes are always added with one data node.
-            // insert_lr_[k] is used to set the br indicator in all nodes - insert_lr_[k]=1: node is a
-            // right link of its parent, insert_lr_[k]=0: node is a left link of its parent.
-            // insert_key_bit_ is the leftmost bit that key is different from terminating key actually
-            // found in trie.
-
-            BNODE **insert_p_, **insert_bna_;  // BNODE *insert_p_[num_keys_], BNODE *insert_bna_[num_keys_];
-            unsigned int *insert_lr_;          // unsigned int insert_lr_[num_keys_];
-            unsigned int *insert_key_bit_;     // unsigned int insert_key_bit_[num_keys_];
+ *
+ *         allocator
+ *     get_allocator
+ *         (
+ *         ) const
+ *         e.g. std::allocator<unsigned char> al = rdx->get_allocator();
+ *
+ *
+ *         MKRdxPat<app_data> *
+ *     chg_max_rdx_nodes 
+ *         (
+ *             const unsigned int new_max_rdx_nodes
+ *         ) const
+ *         e.g. MKRdxPat<app_data> *rdx_new = rdx_old->chg_max_rdx_nodes(new_max_rdx_nodes);
+ *
+ *
+ *     struct app_data
+ *     {
+ *         int data;  // user specified application data structure
+ *     };
+ *
+ *         template <typename added_callback, typename removed_callback, typename both_callback>
+ *         static int
+ *     diff
+ *         (
+ *             MKRdxPat<app_data> *a,
+ *             MKRdxPat<app_data> *b,
+ *             const int k,
+ *             added_callback on_added,      // int on_added(app_data *b_datap, const unsigned char *key)
+ *             removed_callback on_removed,  // int on_removed(app_data *a_datap, const unsigned char *key)
+ *             both_callback on_both         // int on_both(app_data *a_datap, app_data *b_datap, const unsigned char *key)
+ *         )
+ *         e.g. int n = MKRdxPat<app_data>::diff(rdx_a, rdx_b, k, on_added, on_removed, on_both);
+ *
+ *
+ *         static MKRdxPat<app_data> *
+ *     set_union
+ *         (
+ *             MKRdxPat<app_data> *a,
+ *             MKRdxPat<app_data> *b,
+ *             const int k
+ *         )
+ *         e.g. MKRdxPat<app_data> *rdx_new = MKRdxPat<app_data>::set_union(rdx_a, rdx_b, k);
+ *
+ *
+ *         static MKRdxPat<app_data> *
+ *     set_intersection
+ *         (
+ *             MKRdxPat<app_data> *a,
+ *             MKRdxPat<app_data> *b,
+ *             const int k
+ *         )
+ *         e.g. MKRdxPat<app_data> *rdx_new = MKRdxPat<app_data>::set_intersection(rdx_a, rdx_b, k);
+ *
+ *
+ *         int
+ *     print
+ *         (
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             ofstream& os
+ *         )
+ *         e.g. int return_code = rdx->print(NULL, os);
+ *         e.g. int return_code = rdx->print((unsigned char *)key, os);
+ *
+ *
+ *         int
+ *     verify
+ *         (
+ *             VERIFY_MODE vm,
+ *             ofstream& os
+ *         )
+ *         e.g. int return_code = rdx->verify(ERR_CODE, os);
+ *         e.g. int return_code = rdx->verify(ERR_CODE_PRINT, os);
+ *
+ *
+ *         int
+ *     save
+ *         (
+ *             const char *path
+ *         )
+ *         e.g. int return_code = rdx->save("routes.snap");
+ *
+ *
+ *         static MKRdxPat<app_data, allocator> *
+ *     map
+ *         (
+ *             const char *path,
+ *             const bool check = false
+ *         )
+ *         e.g. MKRdxPat<app_data> *rdx = MKRdxPat<app_data>::map("routes.snap");
+ *
+ *
+ *     MKRdxPatGroup<app_data>
+ *         (
+ *             int MAX_TRIES,  // the number of member tries sharing the pool
+ *             int MAX_RDX_NODES,  // the data nodes of the pool - shared by all the member tries
+ *             int NUM_KEYS,
+ *             int MAX_KEY_BYTES,
+ *             unsigned int OPTIONS = 0,  // RDX_ORDER_STATS and RDX_LOCALITY or'ed together
+ *             const unsigned char *NONUNIQUE = NULL,
+ *             const allocator &ALLOC = allocator()
+ *         )
+ *         e.g. MKRdxPatGroup<app_data> *group = new MKRdxPatGroup<app_data>(4096, 65536, 1, 4);
+ *
+ *
+ *     ~MKRdxPatGroup()
+ *         e.g. delete group;
+ *
+ *
+ *         int
+ *     insert
+ *         (
+ *             const int t,
+ *             const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *             app_data **app_datapp
+ *         )
+ *         e.g. int return_code = group->insert(t, (unsigned char *)key, &app_datap);
+ *
+ *
+ *         app_data *
+ *     search
+ *         (
+ *             const int t,
+ *             const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *         )
+ *         e.g. app_data *app_datap = group->search(t, (unsigned char *)key);
+ *
+ *
+ *         app_data *
+ *     remove
+ *         (
+ *             const int t,
+ *             const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *         )
+ *         e.g. app_data *app_datap = group->remove(t, (unsigned char *)key);
+ *
+ *
+ *         int
+ *     clear
+ *         (
+ *             const int t
+ *         )
+ *         e.g. int n = group->clear(t);
+ *
+ *
+ *         template <typename callback>
+ *         int
+ *     for_each
+ *         (
+ *             const int t,
+ *             const int k,
+ *             callback cb  // int cb(app_data *app_datap, const unsigned char *key)
+ *         )
+ *         e.g. int n = group->for_each(t, k, cb);
+ *
+ *
+ *         int
+ *     alloc_nodes
+ *         (
+ *             const int t = -1
+ *         ) const
+ *         e.g. int alloc_nodes = group->alloc_nodes(t);
+ *
+ *
+ *         int
+ *     max_tries
+ *         (
+ *         ) const
+ *         e.g. int max_tries = group->max_tries();
+ *
+ *
+ *         MKRdxPat<app_data, allocator> *
+ *     pool
+ *         (
+ *         ) const
+ *         e.g. MKRdxPat<app_data> *rdx = group->pool();
+ *
+ *======================================================================================================================
+ *
+ * Description:
+ *     The MKRdxPat class allows the allocation of a fixed sized contiguous data store that holds data nodes
+ *     of an arbitrary structure that may be accessed with any number of keys of any size with the PATRICIA
+ *     (Practical Algorithm To Retrieve Information Coded In Alphanumeric)(1,2,3) fast search algorithm.
+ *     MKRdxPat is particularly suited to applications that require complex data structures be contiguously
+ *     stored and accessed with an algorithm of known fast character with any of several possible keys,
+ *     either singly of several simultaneously.
+ *
+ *     For example, a data structure that required either of an IPv4, IPv6 or MAC address key(s) to access
+ *     data nodes.  In this case NUM_KEYS would be 3 and MAX_KEY_BYTES would be 16(the longest - see below).
+ *
+ *     The MKRdxPat class supports a data structure of MAX_RDX_NODES data nodes and NUM_KEYS keys per
+ *     data node with keys of MAX_KEY_BYTES bytes or less.  The class constructor:
+ *
+ *         MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+ *
+ *     along with a:
+ *
+ *         struct app_data
+ *         {
+ *             // user data
+ *         };
+ *
+ *     class constructor typename specifies the data structure.  A data node may be accessed with a single
+ *     key or any number of keys simultaneously.  Keys must be unique within their key index(0 - NUM_KEYS-1),
+ *     but not over different key indexes.  Member functions that require keys are passed the array:
+ *
+ *         unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+ *
+ *     One extra prefix byte, a key boolean - required to be 0(ignore) or 1(search), is set with each key to
+ *     specify if the key is to be used in the data node search.  It is suggested that the array be first
+ *     memset() to 0:
+ *
+ *         memset(key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+ *
+ *     and then only keys to be used copied in with the key boolean(set to 1) prepended.
+ *
+ *     In most cases the necessary keys will be of different lengths.  The MAX_KEY_BYTES constructor argument
+ *     would be set to the longest of these.  All other shorter keys would be left justified in the key[][]
+ *     array, that is, start just after the key boolean.  Thus, for the example above, the IPv6 key would use
+ *     the full 16 bytes, the IPv4 key would use the first four bytes after the key boolean(with the rest(12)
+ *     set to 0) and the MAC key would use the first 6 bytes after the key boolean(with the rest(10) set to
+ *     0).  This was done to make the specification of the key[][] array and the code associated with
+ *     processing it simpler.  Actually, the IPv4 and MAC addresses could be right justified, just so long as
+ *     all the keys are always right justified and the other bytes are 0; you just have to be consistent
+ *     within any given key index.  From the way that PATRICIA works the keys are examined from left to
+ *     right.  Thus, it makes sense to left justify.  Then, the actual key bits are examined instead of
+ *     examining irrelevent 0 bits first.  The suffixed 0 bits are not a factor in the data node search since
+ *     the key bits on the left will find a data node if all inserts were made with the same number of key
+ *     bits on the left e.g. 32 for an IPv4 address.  Example:
+ *
+ *                 kb key bytes
+ *         IPv4 :  01 c0 a8 00 01 00 00 00 00 00 00 00 00 00 00 00 00 - 192.168.0.1
+ *         IPv6 :  01 fe 80 00 00 00 00 00 00 02 21 2f ff fe b5 6e 10 - fe80::221:2fff:feb5:6e10
+ *         MAC  :  01 00 21 2f b5 6e 10 00 00 00 00 00 00 00 00 00 00 - 00:21:2f:b5:6e:10
+ *
+ *     Let's suppose that we wanted to find a data node with just the IPv6 address.  We first memset()
+ *     key[][] to 0.  We then add the IPv6 address with it's key boolean set to 1 and pass the key[][] array
+ *     to the member functions.  Thus:
+ *
+ *                 kb key bytes
+ *         IPv4 :  00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 - 0
+ *         IPv6 :  01 fe 80 00 00 00 00 00 00 02 21 2f ff fe b5 6e 10 - fe80::221:2fff:feb5:6e10
+ *         MAC  :  00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 - 0
+ *
+ *     See the member function summary above or a detailed member function usage comment before each
+ *     function's code.  A verify() member function is provided that does extensive data structure memory
+ *     analysis and a print() member function is provided that prints the structural details of all the
+ *     branch and data nodes.
+ *
+ *     For a trie of NUM_KEYS keys, each data node will have NUM_KEYS branch nodes associated with it.  The
+ *     number of actual data nodes in the data structure is MAX_RDX_NODES+1.  This extra node is for the
+ *     initial branch nodes and initial data node with the impossible key of all 0xff's(1,2,3).  The number
+ *     of user storable nodes is MAX_RDX_NODES.   The user, through the constructor, declares PNODEs,
+ *     each of which contains a radix PATRICIA trie of MAX_RDX_NODES nodes with NUM_KEYS keys of
+ *     at most MAX_KEY_BYTES bytes length.
+ *
+ *     These routines are a modification of the algorithm cited.  Specifically, the upward pointers used to
+ *     terminate search are not used, and are instead used to point to data nodes as trie leaves.  In
+ *     multi-key search with PATRICIA the upward pointer scheme will not work since each key would have
+ *     pointed to a different branch node with it's associated data structure.  In multi-key PATRICIA search
+ *     all keys must lead to the same data node.  The viability of multi-key radix PATRICIA search depends
+ *     on the fact that each data node insertion requires only one new branch node for each key, thus the
+ *     initial allocation of NUM_KEYS branch nodes with each data node.  This implementation has several
+ *     additional branch and data node members not used in the original PATRICIA search algorithm.  These
+ *     are for various purposes; related to changes in the original algorithm for multi-key search, related
+ *     to changes in the original algorithm for leaf data nodes instead of upward pointers to data structures
+ *     stored in branch nodes, related to printing, related to sorting and debugging.
+ *
+ *======================================================================================================================
+ *
+ * Error Handling
+ *
+ *     1. Exceptions - The #include <exception> header is used to define exception objects throw()'n
+ *                     upon calloc() failures.  Calloc() failures are thrown in the class constructor
+ *                     MKRdxPat(), the chg_max_rdx_nodes() member function and the verify() member
+ *                     function.  All other errors are reported via return values.
+ *     2. Debugging  - Debugging output is provided for the class constructor - MKRdxPat() and member
+ *                     functions insert(), search() and remove().  A debug() macro is provided.  It
+ *                     will generte output if any one of three defines - DEBUG_I(insert()), DEBUG_S(search()),
+ *                     DEBUG_R(remove()) - are set to 1.  If any of these are set to 1 then debug output for
+ *                     MKRdxPat() will happen.
+ *     3. Returns    - Member functions can return error indications.  These are documented in the comment
+ *                     headings of the functions.  These are much faster than exceptions and should be
+ *                     handled locally.
+ *
+ *======================================================================================================================
+ *
+ * Operational Notes:
+ *
+ *     1. the first member of BNODE and DNODE typedefs, id, should not be moved.  when doing operations on the
+ *        trie, a search will reference the id from a BNODE type initially and then terminate at a DNODE type.
+ *
+ *     2. the maximum number of key bits is MAX_KEY_BITS.  the impossible key in the initially allocated data
+ *        node must be at least one bit longer.  this requires the data node storage for the keys to have one
+ *        extra byte.
+ *
+ *     3. all keys are the same length - MAX_KEY_BYTES bytes.  the performance hit, the small memory savings
+ *        and the added code complexity of having individually sized keys did not seem worth it.  thus, the
+ *        longest required key will determine MAX_KEY_BYTES.  shorter keys may be left justified in the
+ *        MAX_KEY_BYTES bytes.
+ *
+ *     4. it is suggested that the 'unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]' array be first memset() to
+ *        0 and then all the keys to be used with key boolean 1 added in one operation(keys with key boolean
+ *        0 are never needed) e.g. memset(key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));.
+ *
+ *     5. multidemensional arrays in C++ are implemented by subscripting calloc()'ed memory with parameterized
+ *        values calculated from the C array versions.  One, two and three dimensional arrays are illustrated
+ *        as follows(see verify() for actual usage):
+ *
+ *        n -> subscripts max_rdx_nodes_
+ *        k -> subscripts num_keys_
+ *        b -> subscripts max_key_bytes_:
+ *
+ *        a. one dimensional:
+ *           unsigned long verify_dnode_addrs_[max_rdx_nodes_+1];
+ *               -> verify_dnode_addrs_[n]
+ *
+ *        b. two dimensional:
+ *           unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
+ *               -> verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
+ *
+ *        c. three dimensional:
+ *           unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_];
+ *               -> verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
+ *
+ *     6. the trie size is a size_t - on a 64 bit host a trie may be larger than 4 GB.  the node and key byte
+ *        subscripts are int - the constructor throws if (MAX_RDX_NODES+1)*NUM_KEYS or NUM_KEYS*(1+MAX_KEY_BYTES)
+ *        do not fit in an int, or if the trie size does not fit in a size_t.  at about 200 bytes a node for one
+ *        4 byte key, hundreds of millions of nodes fit in an int with room to spare.
+ *
+ *     7. a save() snapshot holds raw node addresses and is only map()'ed by a build of the same layout version, node
+ *        sizes, app_data size and byte order.  it is not a portable interchange format.
+ *
+ *     8. save() and map() need the POSIX open(), pwrite() and mmap() calls.  they are compiled on unix hosts only -
+ *        define MKRDXPAT_SNAPSHOT 0 or 1 before including MKRdxPat.hpp to choose.
+ *
+ *======================================================================================================================
+ *
+ * Theoretic Notes:
+ *
+ *     1. depending on the key structure it is possible for the trie to be very unbalanced.  for a three byte
+ *        key, for example, if 24 keys are inserted, each with only one different bit set, then the resulting
+ *        trie would be a string of branch nodes extending to the left, each with a data node on its right
+ *        branch.  the maximum trie depth would be 24 with the key of all zeros.
+ *
+ *     2. for the N node trie with b bit keys, even for very long keys, the average search requires log2(N)
+ *        bit comparisons, and the average trie depth is log2(N).  see reference 1.  for a full key space,
+ *        N = 2**b, log2(2**b) = b, and the average trie depth approaches b.
+ *
+ *     3. note that insertion requires two traversals of the trie - one to find if the key(s) already exists
+ *        and the other to do the actual insertion.  the user may think that there must be a way to traverse
+ *        down the trie only once to do an insertion.  the answer is YES! But.  in order to know where to
+ *        stop you need to know all the key bits that intervene between the two b bit parameters of each
+ *        branch node.  thus you would have to store these bits in each branch node or you could store any
+ *        full key from any data node below a branch node in that branch node, which, by the property of a
+ *        PATRICIA trie, will all have prefix bits identical for all data nodes below that branch node.  if,
+ *        on insertion, the insertion key had bits differing between the two b bit parameters of two branch
+ *        nodes then an insertion would be done at that point.  all this key storage and bit comparison in
+ *        each traversed branch node is inefficient.  the first search traversal finds the key that does not
+ *        match, but this key has all the key bits needed to find the first key bit of the new key that is
+ *        different from the nearest key already in the trie.  this first differing bit then tells the second
+ *        traversal where to stop and insert the new key.  thus, dual traversal is more efficient and simpler.
+ *
+ *======================================================================================================================
+ *
+ * References:
+ *
+ *     1. Algorithms in C++ Third Edition Parts 1-4, Robert Sedgewick with Christopher J. Van Wyk,
+ *        Addison-Wesley, 1998, Chapter 15.3 Patricia Tries, pp. 637.
+ *
+ *     2. PATRICIA - Practical Algorithm To Retrieve Information Coded in Alphanumeric, Donald R. Morrison,
+ *        Journal of the Association for Computing Machinery, Vol. 15, No. 4, Oct. 1968, pp. 514-534.
+ *
+ *     3. The Art of Computer Programming: Sorting and Searching, Donald E. Knuth,
+ *        Addison-Wesley, 1973, pp 490-499.
+ *
+ *======================================================================================================================
+ *
+ * Author: Richard Hogaboom
+ *         richard.hogaboom@gmail.com
+ *
+ *======================================================================================================================
+ */
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <cstddef>
+#include <thread>
+#include <cstdint>
+#include <utility>
+#include <new>
+#include <type_traits>
+#include <memory>
+#include <climits>
+#include <random>
+
+// save() and map() use the POSIX file and mmap() calls - compile with -DMKRDXPAT_SNAPSHOT=0 to leave them out
+#ifndef MKRDXPAT_SNAPSHOT
+    #if defined(__unix__) || defined(__APPLE__)
+        #define MKRDXPAT_SNAPSHOT 1
+    #else
+        #define MKRDXPAT_SNAPSHOT 0
+    #endif
+#endif
+
+#if MKRDXPAT_SNAPSHOT
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using std::vector;
+using std::string;
+using std::ofstream;
+
+namespace MultiKeyRdxPat
+{
+    #define DEBUG_I 0 // 0/1 for debug output in insert()
+    #define DEBUG_S 0 // 0/1 for debug output in search()
+    #define DEBUG_R 0 // 0/1 for debug output in remove()
+
+    #define debug(fmt, ...) if (DEBUG_I or DEBUG_S or DEBUG_R) fprintf(stdout, "%s:%d:%s(): " fmt, \
+                                                                               __FILE__, __LINE__, __func__, __VA_ARGS__);
+
+    // verify_mode arg to verify()
+    typedef enum verify_mode
+    {
+        ERR_CODE,            // return 0 for no error and positive int with error code for any errors
+        ERR_CODE_PRINT       // return same error code above but also print current data structure data
+                             // node addresses/keys, branch node addresses and error messages
+    } VERIFY_MODE;
+
+    // OPTIONS arg to MKRdxPat() and MKRdxPatGroup() - 0 or the options or'ed together
+    typedef enum rdx_option
+    {
+        RDX_ORDER_STATS = 1,  // keep the subtree counts for rank(), select() and sample()
+        RDX_EXPIRY = 2,       // keep the data node expiry times for set_expiry() and expire()
+        RDX_EVICT = 4,        // insert() into a full trie evicts a data node not recently used(CLOCK)
+        RDX_LOCALITY = 8      // a new branch node is the free branch node nearest its parent
+    } RDX_OPTION;
+
+    template <typename app_data, typename allocator = std::allocator<unsigned char> > class MKRdxPat
+    {
+        private:
+
+            //
+            // constants
+            //
+
+            // number of items ahead of the current item that insert_batch() and remove_batch() prefetch the keys of
+            static const int BATCH_PREFETCH = 8;
+
+            //
+            // typedefs
+            //
+
+            // branch node typedef
+            typedef struct bnode
+            {
+                unsigned int id;     // IDentification(id=0 branch node,id=1 data node) - must be first field in node
+                unsigned int br;     // br=0: from left parent BRanch - br=1: from right parent BRanch
+                void *p;             // ptr to Parent node
+                unsigned int nsn;    // Node Sequence Number - 0->max_rdx_nodes_
+                unsigned int b;      // Bit number to do branch test on(bits start at 0 from right to left)
+                void *l, *r;         // Left and Right node ptrs
+            } BNODE;
+
+            // data node typedef for application declarations.  the key must have one extra byte from max_key_bytes_
+            // specified above in order to have an "impossible" key data node set at initialization
+            typedef struct dnode
+            {
+                unsigned int id;     // IDentification(id=1) for data node - must be first field in node
+                unsigned int *br;    // br=0: from left parent BRanch - br=1: from right parent branch - br[num_keys_]
+                BNODE **p;           // ptr to Parent node - p[num_keys_]
+                unsigned int nsn;    // Node Sequence Number - 0->max_rdx_nodes_
+                void *nnfp;          // Next Node Free Ptr
+                unsigned int alloc;  // 1 - allocated in rdx trie, 0 - on free queue
+                unsigned int dcon;   // 1 - Data CONstructed(allocated, or removed and not yet reused), 0 - not constructed
+                unsigned char *key;  // search KEY(s) - key[num_keys_][1+max_key_bytes_]
+                struct dnode **nx;   // NeXt data node with the same key in a non-unique key index - nx[num_keys_]
+                struct dnode **pv;   // PreVious data node with the same key in a non-unique key index - pv[num_keys_]
+                app_data data;       // user defined data structure
+            } DNODE;
+
+            // typedef of struct for PATRICIA node holding max_rdx_nodes_ data
+            // nodes with num_keys_ keys of length max_key_bytes_
+            typedef struct pnode
+            {
+                // rdx trie size in bytes - includes all data and branch nodes including the root node
+                size_t bsize;
+
+                // total number of nodes allocated(does not include root(0xff key) node)
+                unsigned int alloc_nodes;
+
+                // head of rdx search node trie for each key
+                BNODE **head;  // BNODE *head[num_keys_]
+
+                // array holding ptrs to app_data used in sort()
+                app_data **app_data_ptrs;  // app_data *app_data_ptrs[max_rdx_nodes_+1]
+
+                // number of ptrs in node_ptrs array(not including root node)
+                unsigned int app_data_ptrs_cnt;
+
+                // branch nodes and free queue head ptr(s) of branch nodes
+                BNODE *bnodes;  // BNODE bnodes[max_rdx_nodes_+1][num_keys_]
+                BNODE **bfree_head;  // BNODE *bfree_head[num_keys_]
+
+                // data nodes and free queue head ptr of data nodes
+                DNODE *dnodes;  // DNODE dnodes[max_rdx_nodes_+1]
+                DNODE *dfree_head;
+            } PNODE_;
+
+
+            //
+            // private data
+            //
+
+            const int max_rdx_nodes_;
+            const int num_keys_;
+            const int max_key_bytes_;
+            const bool order_stats_;  // true - keep the branch node subtree counts for rank(), select() and sample()
+            const bool expiry_;       // true - keep the data node expiry times for set_expiry() and expire()
+            const bool evict_;        // true - insert() into a full trie evicts a data node not recently used
+            const bool locality_;     // true - a new branch node is the free branch node nearest its parent branch node
+
+
+            //
+            // variables related to insert()
+            //
+
+            // during search insert_c_[] is successively set to the child nodes down the trie and ends at the
+            // data node closest to the key.  if a new key is to be inserted it is both the duplicate check and
+            // the node link_dnode() climbs from to link the new branch node and data node dna - num_keys_
+            // branch nodes are always added with one data node.
+
+            // insert_c_[] is declared as BNODE * but is cast to DNODE * at the end of a search.
+            // this is because all searches go through a series of BNODES and end at a DNODE.
+            // the determination of search termination is made by examining insert_c_[k]->id == 1,
+            // which indicates a data node.  since insert_c_[k] is declared a BNODE * and the id
+            // field is in both node types, then the id field must be at the start of the
+            // typedef and in the same relative position in order to get the correct value.
+
+            BNODE **insert_c_;                 // BNODE *insert_c_[num_keys_];
+            unsigned char *insert_ky_;         // unsigned char insert_ky_[num_keys_][1+max_key_bytes_];
+
+
+            //
+            // variables related to search()
+            //
+
+            // search_c_[] is declared as BNODE * but is cast to DNODE * at the end of a search.
+            // this is because all searches go through a series of BNODES and end at a DNODE.
+            // the determination of search termination is made by examining search_c_[k]->id == 1,
+            // which indicates a data node.  since search_c_[k] is declared a BNODE * and the id
+            // field is in both node types, then the id field must be at the start of the
+            // typedef and in the same relative position in order to get the correct value.
+
+            BNODE *search_c_;           // BNODE *search_c_[num_keys_];
+            unsigned char *search_ky_;  // unsigned char search_ky_[num_keys_][1+max_key_bytes_];
+
+
+            //
+            // variables related to remove()
+            //
+
+            // remove_c_[] is declared as BNODE * but is cast to DNODE * at the end of a search.
+            // this is because all searches go through a series of BNODES and end at a DNODE.
+            // the determination of search termination is made by examining remove_c_[k]->id == 1,
+            // which indicates a data node.  since remove_c_[k] is declared a BNODE * and the id
+            // field is in both node types, then the id field must be at the start of the
+            // typedef and in the same relative position in order to get the correct value.
+
+            BNODE *remove_c_;           // BNODE *remove_c_[num_keys_];
+            unsigned char *remove_ky_;  // unsigned char remove_ky_[num_keys_][1+max_key_bytes_];
+
+
+            //
+            // variables related to print()
+            //
+
+            unsigned char *print_ky_;  // unsigned char print_ky_[1+max_key_bytes_];
+
+
+            //
+            // variables related to range(), for_each_prefix(), lower_bound(), upper_bound(), predecessor(), remove_prefix()
+            // and remove_range()
+            //
+
+            // the search key, lower bound key or prefix copied with the extra prefix byte for comparison
+            unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
+
+
+            //
+            // variables related to rank(), select() and sample()
+            //
+
+            // the number of data nodes in the subtree of each branch node - same subscripts as rdx_.bnodes.  only
+            // allocated and kept up to date if order_stats_ is true.
+            // unsigned int order_cnt_[max_rdx_nodes_+1][num_keys_]; -> order_cnt_[n*num_keys_+k]
+            unsigned int *order_cnt_;  // unsigned int order_cnt_[max_rdx_nodes_+1][num_keys_];
+
+
+            //
+            // variables related to non-unique key indices
+            //
+
+            // nonunique_[k] is 1 if key index k may hold the same key in any number of data nodes.  only the first of
+            // these data nodes is linked into the key index k trie - the rest are kept in a circular list through the
+            // data node nx[k]/pv[k] pointers with their parent pointer p[k] set to NULL.
+            unsigned char *nonunique_;  // unsigned char nonunique_[num_keys_];
+
+            // number of non-unique key indices - if 0 no space is allocated for the data node nx[]/pv[] pointers
+            int num_nonunique_;
+
+
+            //
+            // variables related to set_expiry() and expire()
+            //
+
+            // the hierarchical timing wheel - WHEEL_LEVELS levels of WHEEL_SLOTS slots.  a data node with expiry time t is
+            // kept in the level of the highest bit where t differs from wheel_time_ and in the slot of the WHEEL_BITS bits
+            // of t at that level - a data node with t <= wheel_time_ is in the due list.  when time advances only the slots
+            // passed are emptied and their data nodes go to a lower level or the due list, thus, a data node is moved at
+            // most WHEEL_LEVELS times.
+            static const int WHEEL_BITS = 6;
+            static const int WHEEL_SLOTS = 1 << WHEEL_BITS;
+            static const int WHEEL_LEVELS = (64 + WHEEL_BITS-1) / WHEEL_BITS;
+            static const int WHEEL_LISTS = WHEEL_LEVELS * WHEEL_SLOTS + 1;  // the slot lists and the due list(last)
+
+            // the expiry time of each data node(0 - none) - same subscripts as rdx_.dnodes.  the wheel lists are circular
+            // lists of data node subscripts through wheel_nx_[]/wheel_pv_[] - subscript max_rdx_nodes_+1+l is the list
+            // head of wheel list l and 0 is not in any list.  only allocated if expiry_ is true.
+            unsigned long long *expire_at_;  // unsigned long long expire_at_[max_rdx_nodes_+1];
+            unsigned int *wheel_nx_;         // unsigned int wheel_nx_[max_rdx_nodes_+1+WHEEL_LISTS];
+            unsigned int *wheel_pv_;         // unsigned int wheel_pv_[max_rdx_nodes_+1+WHEEL_LISTS];
+
+            // the time the wheel has been advanced to by expire()
+            unsigned long long wheel_time_;
+
+
+            //
+            // variables related to eviction - see evict_dnode()
+            //
+
+            // the CLOCK reference bit of each data node - same subscripts as rdx_.dnodes.  set when the data node is
+            // inserted or found by search() and cleared as the CLOCK hand passes it.  only allocated if evict_ is true.
+            unsigned char *clock_ref_;  // unsigned char clock_ref_[max_rdx_nodes_+1];
+
+            // the data node subscript(1 - max_rdx_nodes_) the CLOCK hand last stopped at
+            unsigned int clock_hand_;
+
+
+            //
+            // variables related to clear() - see pop_dnode() and pop_bnode()
+            //
+
+            // the clear() watermarks.  the data nodes from subscript dfresh_ up and the key index k branch nodes from
+            // subscript bfresh_[k] up have been free since the last clear().  they end their free list in subscript order
+            // without the free list links, and their fields are reset as they are taken off it.  max_rdx_nodes_+1 if
+            // there are none.
+            unsigned int dfresh_;
+            unsigned int *bfresh_;  // unsigned int bfresh_[num_keys_];
+
+
+            //
+            // variables related to locality aware branch node allocation - see alloc_bnode()
+            //
+
+            // the free branch nodes searched for the one nearest the parent branch node are within LOCALITY_WORDS words
+            // of bfree_map_ - LOCALITY_WORDS*64 subscripts - either side of the parent branch node subscript
+            static const int LOCALITY_WORDS = 4;
+
+            // the number of 64 bit words in the free branch node bitmap of one key index
+            unsigned int map_words_;
+
+            // bit n of key index k is 1 if the key index k branch node with subscript n is on the free list and below the
+            // clear() watermark bfresh_[k].  the free list is doubly linked - the l pointer of a free branch node is the
+            // previous free branch node - so that any free branch node may be taken off it.  only allocated if locality_ is
+            // true.
+            unsigned long long *bfree_map_;  // unsigned long long bfree_map_[num_keys_][map_words_];
+
+
+            //
+            // variables related to save() and map()
+            //
+
+            #if MKRDXPAT_SNAPSHOT
+            // a snapshot file is a SNAPSHOT header followed by an image of the full trie storage at SNAPSHOT_OFFSET - a
+            // multiple of any page size - plus the saved address modulo SNAPSHOT_OFFSET.  the image has the same offset
+            // within a page in the file as in memory, thus, a page aligned mmap() puts it at the address it was saved from
+            // even if that address is not page aligned.  the links in the image are the addresses they had in the saved
+            // trie, thus, map() asks for the image to be mapped at the address it was saved from and only if it cannot be
+            // adds the difference to each link.
+            static const unsigned long long SNAPSHOT_MAGIC = 0x5441505844524b4dULL;  // "MKRDXPAT"
+            static const unsigned int SNAPSHOT_VERSION = 4;                          // the header and image layout
+            static const size_t SNAPSHOT_OFFSET = 65536;                            // the image offset in the file
+
+            typedef struct snapshot
+            {
+                unsigned long long magic;       // SNAPSHOT_MAGIC - also fails on a host of the other byte order
+                unsigned int version;           // SNAPSHOT_VERSION
+                unsigned int bnode_bytes;       // sizeof(BNODE)
+                unsigned int dnode_bytes;       // sizeof(DNODE)
+                unsigned int app_data_bytes;    // sizeof(app_data)
+                int max_rdx_nodes;              // max_rdx_nodes_
+                int num_keys;                   // num_keys_
+                int max_key_bytes;              // max_key_bytes_
+                int num_nonunique;              // num_nonunique_
+                unsigned char order_stats;      // order_stats_
+                unsigned char expiry;           // expiry_
+                unsigned char evict;            // evict_
+                unsigned char locality;         // locality_
+                unsigned int alloc_nodes;       // rdx_.alloc_nodes
+                unsigned int dfresh;            // dfresh_
+                unsigned int clock_hand;        // clock_hand_
+                unsigned long long wheel_time;  // wheel_time_
+                unsigned long long dfree_head;  // rdx_.dfree_head - a link as those in the image
+                unsigned long long base;        // the address of the saved full trie storage
+                unsigned long long bsize;       // rdx_.bsize - the image size
+                unsigned long long checksum;    // snapshot_sum() of the image
+            } SNAPSHOT;
+            #endif
+
+            // the size of the map()'ed snapshot image and the page bytes before it - 0 if the full trie storage is from
+            // arena_alloc()
+            size_t map_bytes_;
+
+
+            //
+            // variables related to dump() and load()
+            //
+
+            // a dump is DUMP_FIELDS 8 byte little endian header fields - DUMP_MAGIC, DUMP_VERSION, num_keys_,
+            // max_key_bytes_, sizeof(app_data), the number of data nodes and 1 if the records are ranked(any key index but
+            // 0 non-unique) else 0 - then one record per data node in key index 0 order, its num_keys_ keys of
+            // max_key_bytes_ bytes, if ranked its 4 byte little endian list_order() position for k = 1 to num_keys_-1,
+            // then the bytes of its app_data, and last the 8 byte snapshot_sum() of the records.  the ranks keep the list
+            // order of identical keys.  records are written and read DUMP_BUFFER bytes at a time.
+            static const unsigned long long DUMP_MAGIC = 0x504d445844524b4dULL;  // "MKRDXDMP"
+            static const unsigned long long DUMP_VERSION = 2;
+            static const int DUMP_FIELDS = 7;
+            static const size_t DUMP_BUFFER = 65536;
+
+
+            //
+            // variables related to verify()
+            //
+
+            // holds all of the allocated branch node addresses
+            // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
+            unsigned long *verify_bnode_addrs_;       // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
+
+            // holds all of the unallocated branch node addresses
+            // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
+            unsigned long *verify_free_bnode_addrs_;  // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
+
+            // holds all of the allocated data node addresses
+            // unsigned long dnode_addrs[max_rdx_nodes_+1]; -> dnode_addrs[n]
+            unsigned long *verify_dnode_addrs_;       // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1];
+
+            // holds all of the unallocated data node addresses
+            // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]; -> verify_free_dnode_addrs_[n]
+            unsigned long *verify_free_dnode_addrs_;  // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1];
+
+            // hold all of the allocated data node keys
+            // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]; -> verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
+            unsigned char *verify_dnode_keys_;        // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_];
+
+            // holds integer indexes(0 to max_rdx_nodes_) of free and allocated nodes
+            // unsigned long verify_node_index_[2][max_rdx_nodes_+1]; -> verify_node_index_[i*(max_rdx_nodes_+1)+n]
+            unsigned long *verify_node_index_;        // unsigned long verify_node_index_[2][max_rdx_nodes_+1];
+
+
+            // full trie calloc() free pointer
+            void *free_ptr_;
+
+            // allocator of the full trie storage - see arena_alloc()
+            allocator alloc_;
+
+            // the full trie storage is allocated as an array of max_align_t so that any allocator returns it aligned for
+            // every data structure carved from it
+            typedef typename std::allocator_traits<allocator>::template rebind_alloc<std::max_align_t> arena_allocator;
+
+            // primary data structure
+            PNODE_ rdx_;
+
+
+            //
+            // private functions
+            //
+
+            // given a key and bit number (bytes numbered 0 from left, bits numbered 0 from right)
+            // will return that bit used by: insert(), search(), remove(), print()
+                inline unsigned int
+            gbit
+                (
+                    unsigned char *key,
+                    unsigned int bit_num
+                )
+            {
+                unsigned int byte;
+                unsigned int bit;
+                unsigned char mask;
+
+                //
+                // the byte index set here assumes one extra prefix byte in the input parameter key(for the
+                // 0xff of the root node impossible key). thus, data nodes with keys of max_key_bytes_ will
+                // have a 0 byte prefix added, and the byte index set here is not 0 to max_key_bytes_-1 but 1
+                // to max_key_bytes_. e.g. if max_key_bytes_ = 1 and bit_num = 0 then byte is set to 1 not 0.
+                // if max_key_bytes_=16 and bit_num=0 then byte is set to 16 not 15.
+                //
+                mask = 1;                              // right most bit set - to be shifted left
+                byte = max_key_bytes_ - (bit_num>>3);  // get byte number(0 from left) that bit is in(from 1 to max_key_bytes_)
+                mask <<= bit_num%8;                    // shift mask bit to position of bit wanted
+                bit = key[byte] & mask;                // keep only bit wanted(0 or 1) - all other bits zero
+                bit >>= bit_num%8;                     // shift wanted bit right to first position in bit variable
+
+                return bit;  // bit should always be 0 or 1
+            }  // gbit()
+
+            // given two different keys, each with the extra prefix byte, will return the leftmost bit number(the highest)
+            // at which they differ.  a difference in the prefix byte(only possible against the root node impossible key)
+            // is returned as bit max_key_bytes_*8, the branch test bit of the head branch node.  the keys are compared
+            // 8 bytes at a time - the first differing word is byte swapped to big endian order(key byte order) so the
+            // count of its leading zero bits is the offset of the differing bit - then byte at a time for the rest.
+            // used by: bulk_load(), lower_bound_dnode(), link_dnode()
+                inline unsigned int
+            diff_bit
+                (
+                    const unsigned char *key1,
+                    const unsigned char *key2
+                )
+            {
+                int byte = 0;      // key byte offset(0 - the extra prefix byte)
+                unsigned int pos;  // offset of the differing bit from the start of the keys
+
+
+                for ( ; byte+8 <= 1+max_key_bytes_ ; byte += 8 )
+                {
+                    uint64_t w1, w2, x;  // the next 8 bytes of each key and their exclusive or
+
+                    memcpy( &w1, &key1[byte], 8 );
+                    memcpy( &w2, &key2[byte], 8 );
+                    x = w1 ^ w2;
+                    if ( x != 0 )
+                    {
+                        #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+                        x = __builtin_bswap64(x);
+                        #endif
+
+                        pos = byte*8 + __builtin_clzll(x);
+                        return ( pos < 8 ) ? max_key_bytes_*8 : max_key_bytes_*8 + 7 - pos;
+                    }
+                }
+
+                for ( ; byte <= max_key_bytes_ ; byte++ )
+                {
+                    unsigned int x = key1[byte] ^ key2[byte];  // the exclusive or of the key bytes
+
+                    if ( x != 0 )
+                    {
+                        pos = byte*8 + __builtin_clz(x) - (sizeof(unsigned int)-1)*8;
+                        return ( pos < 8 ) ? max_key_bytes_*8 : max_key_bytes_*8 + 7 - pos;
+                    }
+                }
+
+                return 0;  // identical keys - should never happen
+            }  // diff_bit()
+
+            // set child node c(branch or data node) as the left(lr=0) or right(lr=1) child of branch node p in key index k
+            // and set the parent pointer and parent branch indicator of c
+            // used by: bulk_load(), link_dnode(), unlink_dnode(), remove_prefix()
+                inline void
+            link_child
+                (
+                    BNODE *p,
+                    unsigned int lr,
+                    BNODE *c,
+                    int k
+                )
+            {
+                if ( lr == 0 )
+                {
+                    p->l = (void *)c;
+                }
+                else
+                {
+                    p->r = (void *)c;
+                }
+
+                if ( c->id == 0 )
+                {
+                    c->p = p;
+                    c->br = lr;
+                }
+                else
+                {
+                    ((DNODE *)c)->p[k] = p;
+                    ((DNODE *)c)->br[k] = lr;
+                }
+            }  // link_child()
+
+            // return the first(leftmost, lowest key) data node of the subtree headed by node c
+            // used by: begin(), next_dnode()
+                inline DNODE *
+            leftmost_dnode
+                (
+                    BNODE *c
+                )
+            {
+                while ( c->id == 0 )
+                {
+                    c = (BNODE *)(c->l);
+                }
+
+                return (DNODE *)c;
+            }  // leftmost_dnode()
+
+            // return the last(rightmost, highest key) data node of the subtree headed by node c
+            // used by: rbegin(), prev_dnode()
+                inline DNODE *
+            rightmost_dnode
+                (
+                    BNODE *c
+                )
+            {
+                while ( c->id == 0 )
+                {
+                    c = (BNODE *)(c->r);
+                }
+
+                return (DNODE *)c;
+            }  // rightmost_dnode()
+
+            // return the parent branch node and parent branch indicator of node c(branch or data node) in key index k
+            // used by: next_dnode(), prev_dnode()
+                inline void
+            parent
+                (
+                    BNODE *c,
+                    const int k,
+                    BNODE **p,
+                    unsigned int *br
+                )
+            {
+                if ( c->id == 0 )
+                {
+                    *p = (BNODE *)(c->p);
+                    *br = c->br;
+                }
+                else
+                {
+                    *p = ((DNODE *)c)->p[k];
+                    *br = ((DNODE *)c)->br[k];
+                }
+            }  // parent()
+
+            // return the data node following all the data nodes of the subtree headed by node c(a data node is a subtree
+            // of one) in key index k key order or NULL after the last data node.  climb the parent pointers while c is a
+            // right child, then the next data node is the leftmost data node of the right subtree of that parent.  the
+            // root impossible key data node is last in every key index and is never returned.
+            // used by: next_in_order(), lower_bound_dnode(), for_each_prefix(), upper_bound()
+                DNODE *
+            next_dnode
+                (
+                    BNODE *c,
+                    const int k
+                )
+            {
+                BNODE *p;         // parent branch node
+                unsigned int br;  // 1 - the child climbed from is the right child of p
+                DNODE *d;
+
+
+                parent(c, k, &p, &br);
+                while ( br == 1 )
+                {
+                    br = p->br;
+                    p = (BNODE *)(p->p);
+                }
+
+                d = leftmost_dnode( (BNODE *)(p->r) );
+
+                return ( d == &rdx_.dnodes[0] ) ? NULL : d;
+            }  // next_dnode()
+
+            // return the data node preceding all the data nodes of the subtree headed by node c in key index k key order
+            // or NULL before the first data node.  the mirror image of next_dnode() - climbing past the top of the trie to
+            // the rdx_.head[k] branch node means there is no preceding data node.
+            // used by: prev_in_order()
+                DNODE *
+            prev_dnode
+                (
+                    BNODE *c,
+                    const int k
+                )
+            {
+                BNODE *p;         // parent branch node
+                unsigned int br;  // 0 - the child climbed from is the left child of p
+
+
+                parent(c, k, &p, &br);
+                while ( br == 0 )
+                {
+                    if ( p == rdx_.head[k] )
+                    {
+                        return NULL;
+                    }
+
+                    br = p->br;
+                    p = (BNODE *)(p->p);
+                }
+
+                return rightmost_dnode( (BNODE *)(p->l) );
+            }  // prev_dnode()
+
+            // compare the leading bits bits of key and prefix(both without the extra prefix byte) - return 0 if the same
+            // used by: prefix_subtree()
+                int
+            prefix_compare
+                (
+                    const unsigned char *key,
+                    const unsigned char *prefix,
+                    const int bits
+                )
+            {
+                int rc = memcmp( key, prefix, bits/8 );
+
+                if ( rc != 0 || bits%8 == 0 )
+                {
+                    return rc;
+                }
+
+                unsigned char mask = (unsigned char)(0xff << (8 - bits%8));  // the leading bits%8 bits of the last byte
+
+                return (int)(key[bits/8] & mask) - (int)(prefix[bits/8] & mask);
+            }  // prefix_compare()
+
+            // return the subtree of the key index k trie holding all the keys whose leading prefix_bits bits are the same as
+            // prefix or NULL if there are none.  descend only while the branch nodes test bits within the prefix - all the
+            // keys of the subtree reached share the bits tested above it, so one key of the subtree is checked.
+            // used by: for_each_prefix(), remove_prefix()
+                BNODE *
+            prefix_subtree
+                (
+                    const int k,
+                    const unsigned char *prefix,
+                    const int prefix_bits
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
+
+                BNODE *c;
+
+
+                if ( rdx_.alloc_nodes == 0 )
+                {
+                    return NULL;
+                }
+
+                // copy prefix to storage with extra byte - the bits after the prefix are not tested
+                memset( &range_ky_[0], 0, 1+max_key_bytes_ );
+                memmove( &range_ky_[1], prefix, (prefix_bits+7)/8 );
+
+                // the top branch node tests the extra byte - never a prefix bit - and the descent always goes left from it
+                c = (BNODE *)(rdx_.head[k]->l);
+                while ( c->id == 0 && (int)c->b >= max_key_bytes_*8 - prefix_bits )
+                {
+                    c = ( gbit( &range_ky_[0], c->b ) ) ? (BNODE *)(c->r) : (BNODE *)(c->l);
+                }
+
+                if ( prefix_compare( &leftmost_dnode(c)->key[k*(1+max_key_bytes_)+1], prefix, prefix_bits ) != 0 )
+                {
+                    return NULL;
+                }
+
+                return c;
+            }  // prefix_subtree()
+
+            // return the data node with the lowest key in key index k that is >= ky or NULL if all keys are lower.  ky has
+            // the extra prefix byte.  descend once to the data node ky would be found at and find the first bit ky differs
+            // from that key.  every key in the subtree under the last branch node testing a higher bit shares the bits of
+            // ky above that bit, so ky is either lower than all of them(bit 0) or higher than all of them(bit 1).
+            // used by: range(), lower_bound(), upper_bound(), predecessor(), remove_range()
+                DNODE *
+            lower_bound_dnode
+                (
+                    const int k,
+                    const unsigned char *ky  // unsigned char ky[1+max_key_bytes_]
+                )
+            {
+                BNODE *c;         // descent child and then the subtree that ky is lower or higher than
+                BNODE *p;         // parent branch node of c
+                unsigned int br;  // parent branch indicator of c - not used
+                unsigned int b;   // first bit ky differs from the key found
+
+
+                if ( rdx_.alloc_nodes == 0 )
+                {
+                    return NULL;
+                }
+
+                c = (BNODE *)(rdx_.head[k]->l);
+                while ( c->id == 0 )
+                {
+                    c = ( gbit( (unsigned char *)ky, c->b ) ) ? (BNODE *)(c->r) : (BNODE *)(c->l);
+                }
+
+                if ( memcmp( ky, &((DNODE *)c)->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) == 0 )
+                {
+                    return (DNODE *)c;
+                }
+
+                b = diff_bit( ky, &((DNODE *)c)->key[k*(1+max_key_bytes_)] );
+
+                parent(c, k, &p, &br);
+                while ( p->b < b )
+                {
+                    c = p;
+                    parent(c, k, &p, &br);
+                }
+
+                if ( gbit( (unsigned char *)ky, b ) == 0 )
+                {
+                    return leftmost_dnode(c);
+                }
+
+                return next_dnode(c, k);
+            }  // lower_bound_dnode()
+
+            // return the data node the search for ky(with the extra prefix byte) in key index k ends at.  with no hint data
+            // node the descent starts at the top of the trie.  with a hint climb from the hint data node to the first
+            // branch node testing a bit at or above the first bit ky differs from the hint key at - every branch node
+            // above it tests a bit that ky and the hint key have the same value at, so the search path of ky passes
+            // through it - and descend from there.  keys close to the hint key start their descent close to the hint.
+            // used by: insert_dnode(), search_hint()
+                BNODE *
+            descend
+                (
+                    const int k,
+                    unsigned char *ky,  // unsigned char ky[1+max_key_bytes_]
+                    DNODE *hint
+                )
+            {
+                BNODE *c;         // descent child
+                BNODE *p;         // parent branch node of c
+                unsigned int br;  // parent branch indicator of c - not used
+                unsigned int b;   // first bit ky differs from the hint key
+
+
+                if ( hint != NULL && hint->p[k] == NULL )
+                {
+                    hint = list_dnode(hint, k);  // a data node of a non-unique key index not linked into the trie
+                }
+
+                if ( hint == NULL )
+                {
+                    c = (BNODE *)(rdx_.head[k]->l);
+                }
+                else if ( memcmp( ky, &hint->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) == 0 )
+                {
+                    return (BNODE *)hint;
+                }
+                else
+                {
+                    b = diff_bit( ky, &hint->key[k*(1+max_key_bytes_)] );
+
+                    // the rdx_.head[k] branch node tests the highest bit so the climb always stops at or below it
+                    c = (BNODE *)hint;
+                    parent(c, k, &p, &br);
+                    while ( p->b < b )
+                    {
+                        c = p;
+                        parent(c, k, &p, &br);
+                    }
+
+                    c = ( p == rdx_.head[k] ) ? (BNODE *)(rdx_.head[k]->l) : p;
+                }
+
+                while ( c->id == 0 )
+                {
+                    c = ( gbit( ky, c->b ) ) ? (BNODE *)(c->r) : (BNODE *)(c->l);
+                }
+
+                return c;
+            }  // descend()
+
+            // return the number of data nodes in the key index k subtree headed by node c(branch or data node) - the root
+            // impossible key data node is not counted and a data node of a non-unique key index counts the list of data
+            // nodes with its key.  only valid if order_stats_ is true.
+            // used by: set_count(), rank(), select_dnode(), remove_prefix()
+                inline unsigned int
+            subtree_count
+                (
+                    BNODE *c,
+                    const int k
+                )
+            {
+                unsigned int n = 1;
+
+
+                if ( c->id == 0 )
+                {
+                    return order_cnt_[c - rdx_.bnodes];
+                }
+
+                if ( (DNODE *)c == &rdx_.dnodes[0] )
+                {
+                    return 0;
+                }
+
+                if ( nonunique_[k] )
+                {
+                    for ( DNODE *d = ((DNODE *)c)->nx[k] ; d != (DNODE *)c ; d = d->nx[k] )
+                    {
+                        n++;
+                    }
+                }
+
+                return n;
+            }  // subtree_count()
+
+            // return the data node at position n(0 - the lowest key) in key index k key order, or NULL if k or n is out of
+            // range or order_stats_ is false.  the position is kept in size_t so no draw is truncated.
+            // used by: select(), sample()
+                DNODE *
+            select_dnode
+                (
+                    const int k,
+                    size_t n
+                )
+            {
+                BNODE *c;   // descent child
+                size_t nl;  // subtree count of the left child of c
+
+
+                if ( k < 0 || k > num_keys_-1 || !order_stats_ || n >= rdx_.alloc_nodes )
+                {
+                    return NULL;
+                }
+
+                c = (BNODE *)(rdx_.head[k]->l);
+                while ( c->id == 0 )
+                {
+                    nl = subtree_count( (BNODE *)(c->l), k );
+                    if ( n < nl )
+                    {
+                        c = (BNODE *)(c->l);
+                    }
+                    else
+                    {
+                        n -= nl;
+                        c = (BNODE *)(c->r);
+                    }
+                }
+
+                // in a non-unique key index the data node may be further along the list of data nodes with the same key
+                for ( ; n > 0 ; n-- )
+                {
+                    c = (BNODE *)( ((DNODE *)c)->nx[k] );
+                }
+
+                return (DNODE *)c;
+            }  // select_dnode()
+
+            // set the subtree count of key index k branch node c from the subtree counts of its two children
+            // used by: link_dnode(), bulk_link()
+                inline void
+            set_count
+                (
+                    BNODE *c,
+                    const int k
+                )
+            {
+                order_cnt_[c - rdx_.bnodes] = subtree_count( (BNODE *)(c->l), k ) + subtree_count( (BNODE *)(c->r), k );
+            }  // set_count()
+
+            // add n(negative to subtract) to the subtree count of branch node p and of every branch node above it in the key
+            // index k trie.  the rdx_.head[k] branch node has no count.
+            // used by: link_dnode(), unlink_dnode(), remove_prefix()
+                inline void
+            add_count
+                (
+                    BNODE *p,
+                    const int k,
+                    const int n
+                )
+            {
+                for ( ; p != rdx_.head[k] ; p = (BNODE *)(p->p) )
+                {
+                    order_cnt_[p - rdx_.bnodes] += n;
+                }
+            }  // add_count()
+
+            // return the data node of the list of data nodes with the same key index k key as data node d(non-unique key
+            // index only) that is linked into the key index k trie
+            // used by: descend(), unlink_dnode()
+                inline DNODE *
+            list_dnode
+                (
+                    DNODE *d,
+                    const int k
+                )
+            {
+                while ( d->p[k] == NULL )
+                {
+                    d = d->nx[k];
+                }
+
+                return d;
+            }  // list_dnode()
+
+            // add data node d to the end of the list of data nodes with the same key index k key as data node r, the data
+            // node linked into the key index k trie(non-unique key index only).  d is not linked into the trie.
+            // used by: insert_dnode(), upsert(), rekey_dnode(), bulk_link()
+                inline void
+            append_dnode
+                (
+                    DNODE *d,
+                    const int k,
+                    DNODE *r
+                )
+            {
+                d->p[k] = NULL;
+                d->br[k] = 0;
+                d->nx[k] = r;
+                d->pv[k] = r->pv[k];
+                r->pv[k]->nx[k] = d;
+                r->pv[k] = d;
+            }  // append_dnode()
+
+            // return the data node after data node d in key index k key order - the next data node of the list of data
+            // nodes with the same key in a non-unique key index or else the first data node with the next key.  NULL
+            // after the last data node.
+            // used by: iterator, range(), for_each_prefix(), remove_range()
+                inline DNODE *
+            next_in_order
+                (
+                    DNODE *d,
+                    const int k
+                )
+            {
+                if ( nonunique_[k] )
+                {
+                    if ( d->nx[k]->p[k] == NULL )
+                    {
+                        return d->nx[k];
+                    }
+
+                    d = d->nx[k];  // the list wrapped around to the data node linked into the trie
+                }
+
+                return next_dnode( (BNODE *)d, k );
+            }  // next_in_order()
+
+            // return the data node before data node d in key index k key order or NULL before the first data node - the
+            // mirror image of next_in_order()
+            // used by: reverse_iterator, predecessor()
+                inline DNODE *
+            prev_in_order
+                (
+                    DNODE *d,
+                    const int k
+                )
+            {
+                if ( nonunique_[k] && d->p[k] == NULL )
+                {
+                    return d->pv[k];
+                }
+
+                d = prev_dnode( (BNODE *)d, k );
+
+                // the last data node of the list of the previous key
+                return ( nonunique_[k] && d != NULL ) ? d->pv[k] : d;
+            }  // prev_in_order()
+
+            // return the data node with the ky keys(with the extra prefix byte) of every non-unique key index with key
+            // boolean 1 in key.  d is the data node found with the unique key indices or NULL if only non-unique key
+            // indices are used - then the list of data nodes with the key of the first of them is searched.  NULL if there
+            // is no such data node.
+            // used by: search(), search_dnode(), search_hint(), remove(), upsert()
+                DNODE *
+            nonunique_dnode
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    unsigned char *ky,         // unsigned char ky[num_keys_][1+max_key_bytes_]
+                    DNODE *d
+                )
+            {
+                DNODE *r;     // first data node checked
+                int nk = -1;  // key index of the list searched - -1 if d was found with the unique key indices
+
+
+                if ( d == NULL )
+                {
+                    for ( nk = 0 ; !nonunique_[nk] || key[nk*(1+max_key_bytes_)+0] != 1 ; nk++ )
+                    {
+                        ;
+                    }
+
+                    d = (DNODE *)descend( nk, &ky[nk*(1+max_key_bytes_)], NULL );
+                    if ( memcmp( &ky[nk*(1+max_key_bytes_)], &d->key[nk*(1+max_key_bytes_)], 1+max_key_bytes_ ) != 0 )
+                    {
+                        return NULL;  // key not found
+                    }
+                }
+
+                r = d;
+                do
+                {
+                    int k;
+
+                    for ( k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        if ( nonunique_[k] && key[k*(1+max_key_bytes_)+0] == 1 &&
+                             memcmp( &ky[k*(1+max_key_bytes_)], &d->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) != 0 )
+                        {
+                            break;
+                        }
+                    }
+
+                    if ( k == num_keys_ )
+                    {
+                        return d;
+                    }
+
+                    d = ( nk < 0 ) ? r : d->nx[nk];
+                } while ( d != r );
+
+                return NULL;
+            }  // nonunique_dnode()
+
+            // link data node dna into the key index k trie - the key index k key of dna is already set.  c is the data
+            // node the search for the key in key index k ended at.  the new branch node tests the first bit the two keys
+            // differ at and goes just below the last branch node of the search path testing a higher bit - found by
+            // climbing the parent pointers from c rather than descending again from rdx_.head[k].
+            // used by: insert_dnode(), upsert(), rekey_dnode()
+                void
+            link_dnode
+                (
+                    DNODE *dna,
+                    const int k,
+                    BNODE *c
+                )
+            {
+                unsigned char *ky = &dna->key[k*(1+max_key_bytes_)];  // key with the extra prefix byte
+                BNODE *p;         // parent branch node of c
+                unsigned int br;  // parent branch indicator of c
+                BNODE *bna;       // branch node address assigned from the free queue head
+                unsigned int b;   // first bit the new key differs from the key found
+
+
+                if ( nonunique_[k] )
+                {
+                    dna->nx[k] = dna;  // a list of one data node
+                    dna->pv[k] = dna;
+                }
+
+                b = diff_bit( ky, &((DNODE *)c)->key[k*(1+max_key_bytes_)] );
+
+                // the rdx_.head[k] branch node tests the highest bit so the climb always stops at or below it
+                parent(c, k, &p, &br);
+                while ( p->b < b )
+                {
+                    c = p;
+                    parent(c, k, &p, &br);
+                }
+
+                // allocate new branch node from free list - near its parent branch node if locality aware
+                bna = alloc_bnode(k, p);
+
+                bna->b = b;
+                link_child(p, br, bna, k);
+                if ( gbit( ky, b ) )
+                {
+                    link_child(bna, 0, c, k);
+                    link_child(bna, 1, (BNODE *)dna, k);
+                }
+                else
+                {
+                    link_child(bna, 0, (BNODE *)dna, k);
+                    link_child(bna, 1, c, k);
+                }
+
+                if ( order_stats_ )
+                {
+                    set_count(bna, k);
+                    add_count(p, k, 1);
+                }
+            }  // link_dnode()
+
+            // remove data node d and its parent branch node from the key index k trie - the other child of the parent
+            // branch node takes its place - and return the branch node to the key index k free list.  in a non-unique key
+            // index a data node with other data nodes of the same key is only taken off their list - if it is the one linked
+            // into the trie the next data node of the list takes its place.
+            // used by: remove(), remove_prefix(), remove_range(), rekey_dnode()
+                void
+            unlink_dnode
+                (
+                    DNODE *d,
+                    const int k
+                )
+            {
+                BNODE *p = d->p[k];  // parent branch node to remove
+                BNODE *oc;           // other child pointer
+
+
+                if ( nonunique_[k] && d->nx[k] != d )
+                {
+                    DNODE *r;  // data node of the list linked into the trie after d is removed
+
+                    if ( p == NULL )
+                    {
+                        r = list_dnode(d, k);
+                    }
+                    else
+                    {
+                        r = d->nx[k];
+                        link_child( p, d->br[k], (BNODE *)r, k );
+                    }
+
+                    d->pv[k]->nx[k] = d->nx[k];
+                    d->nx[k]->pv[k] = d->pv[k];
+
+                    if ( order_stats_ )
+                    {
+                        add_count( r->p[k], k, -1 );
+                    }
+
+                    return;
+                }
+
+                // set ptr to other child of branch node to remove
+                if ( d->br[k] == 0 )
+                {
+                    oc = (BNODE *)(p->r);
+                }
+                else
+                {
+                    oc = (BNODE *)(p->l);
+                }
+
+                // repair other child ptrs and ptr of parent of parent
+                link_child( (BNODE *)(p->p), p->br, oc, k );
+
+                if ( order_stats_ )
+                {
+                    add_count( (BNODE *)(p->p), k, -1 );
+                }
+
+                // return branch node to free list
+                push_bnode(p, k);
+            }  // unlink_dnode()
+
+            // change the key index k key of data node d to new_key(no extra prefix byte) - unlink d from the key index k
+            // trie and link it again under new_key.  if the search for new_key ends at a data node other than d that
+            // data node is still where the search ends once d is unlinked, otherwise search again after the unlink.
+            // returns 0 - key changed or unchanged, 2 - new_key is the key index k key of another data node and key index
+            // k is unique
+            // used by: rekey()
+                int
+            rekey_dnode
+                (
+                    DNODE *d,
+                    const int k,
+                    const unsigned char *new_key  // unsigned char new_key[max_key_bytes_]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
+
+                BNODE *c;  // data node the search for new_key ends at
+
+
+                // copy key to storage with extra byte for comparison
+                range_ky_[0] = 0;
+                memmove( &range_ky_[1], new_key, max_key_bytes_ );
+
+                if ( memcmp( &range_ky_[0], &d->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) == 0 )
+                {
+                    return 0;
+                }
+
+                c = (BNODE *)(rdx_.head[k]->l);
+                while ( c->id == 0 )
+                {
+                    c = ( gbit( &range_ky_[0], c->b ) ) ? (BNODE *)(c->r) : (BNODE *)(c->l);
+                }
+
+                if ( memcmp( &range_ky_[0], &((DNODE *)c)->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) == 0 )
+                {
+                    if ( !nonunique_[k] )
+                    {
+                        return 2;
+                    }
+
+                    // join the list of data nodes with new_key
+                    unlink_dnode(d, k);
+                    memmove( &d->key[k*(1+max_key_bytes_)], &range_ky_[0], 1+max_key_bytes_ );
+                    append_dnode(d, k, (DNODE *)c);
+                    if ( order_stats_ )
+                    {
+                        add_count( ((DNODE *)c)->p[k], k, 1 );
+                    }
+
+                    return 0;
+                }
+
+                unlink_dnode(d, k);
+
+                if ( c == (BNODE *)d )
+                {
+                    c = (BNODE *)(rdx_.head[k]->l);
+                    while ( c->id == 0 )
+                    {
+                        c = ( gbit( &range_ky_[0], c->b ) ) ? (BNODE *)(c->r) : (BNODE *)(c->l);
+                    }
+                }
+
+                memmove( &d->key[k*(1+max_key_bytes_)], &range_ky_[0], 1+max_key_bytes_ );
+                link_dnode(d, k, c);
+
+                return 0;
+            }  // rekey_dnode()
+
+            // return the data node with handle h or NULL if h is not the handle of a data node in the trie
+            // used by: data(), remove(), keys(), rekey(), insert_hint(), search_hint()
+                inline DNODE *
+            handle_dnode
+                (
+                    const unsigned int h  // node_handle h
+                )
+            {
+                if ( h < 1 || h >= dfresh_ || rdx_.dnodes[h].alloc == 0 )
+                {
+                    return NULL;
+                }
+
+                return &rdx_.dnodes[h];
+            }  // handle_dnode()
+
+            // return the handle of the data node holding app_data *app_datap - the app_data of a data node in the trie
+            // used by: insert(), search(), insert_hint(), search_hint()
+                inline unsigned int
+            dnode_handle
+                (
+                    const app_data *app_datap
+                )
+            {
+                return (unsigned int)( ((const char *)app_datap - (const char *)&rdx_.dnodes[0].data) / sizeof(DNODE) );
+            }  // dnode_handle()
+
+            // set order[] to the item numbers 0 to n-1 of the n item key array key[n][num_keys_][1+max_key_bytes_] sorted
+            // by the key index 0 key bytes - items with the same key index 0 key stay in array order
+            // used by: insert_batch(), remove_batch()
+                void
+            batch_order
+                (
+                    const unsigned char *key,  // unsigned char key[n][num_keys_][1+max_key_bytes_]
+                    const int n,
+                    std::vector<int> &order
+                )
+            {
+                const size_t item_bytes = num_keys_*(1+max_key_bytes_);  // bytes in one item of key[]
+
+
+                order.resize(n);
+                for ( int i = 0 ; i < n ; i++ )
+                {
+                    order[i] = i;
+                }
+
+                std::stable_sort( order.begin(), order.end(),
+                    [key, item_bytes, this](int i, int j) { return memcmp( &key[i*item_bytes+1], &key[j*item_bytes+1], max_key_bytes_ ) < 0; } );
+            }  // batch_order()
+
+            // insert() starting the search of each key index at data node hint(see descend()) or at the top of the trie if
+            // hint is NULL and construct the app_data of the new data node from args.  return values as insert().
+            // used by: insert(), insert_hint(), emplace()
+                template <typename... Args>
+                int
+            insert_dnode
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    app_data **app_datapp,
+                    DNODE *hint,
+                    Args&&... args
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // BNODE **insert_c_;          // BNODE *insert_c_[num_keys_];
+                // unsigned char *insert_ky_;  // unsigned char insert_ky_[num_keys_][1+max_key_bytes_];
+
+                DNODE *dna;  // data node address assigned from the free queue head
+
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // for insertion all key booleans must be 1
+                    if ( key[k*(1+max_key_bytes_)+0] != 1 )
+                    {
+                        *app_datapp = NULL;
+                        return 3;
+                    }
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // copy key to storage with extra byte for comparison
+                    insert_ky_[k*(1+max_key_bytes_)+0] = 0;
+                    memmove( &insert_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+
+                    // search for key in rdx trie - the data node reached is kept for the link if the key is not found
+                    insert_c_[k] = descend( k, &insert_ky_[k*(1+max_key_bytes_)], hint );
+
+                    // if key found return node in arg and set return to 1 - a non-unique key index may hold the key already
+                    if ( !nonunique_[k] &&
+                         memcmp( &insert_ky_[k*(1+max_key_bytes_)], &((DNODE *)insert_c_[k])->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) == 0 )
+                    {
+                        *app_datapp = &( ((DNODE *)(insert_c_[k]))->data );
+                        return 1;
+                    }
+                }
+
+                if ( evict_ && rdx_.dfree_head == NULL )
+                {
+                    // full trie - evict a data node not recently used.  the data node the search ended at may be the one
+                    // evicted, thus, each key index is searched again from the top.
+                    evict_dnode();
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        insert_c_[k] = descend( k, &insert_ky_[k*(1+max_key_bytes_)], NULL );
+                    }
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // if no nodes free set app_datapp to NULL and return 2
+                    if ( rdx_.bfree_head[k] == NULL || rdx_.dfree_head == NULL )
+                    {
+                        *app_datapp = NULL;
+                        return 2;
+                    }
+                }
+
+                // construct the app_data before the data node leaves the free list - an app_data constructor that throws
+                // leaves the data node free
+                construct_data( rdx_.dfree_head, std::forward<Args>(args)... );
+
+                dna = pop_dnode();
+                rdx_.alloc_nodes++;
+
+                if ( evict_ )
+                {
+                    clock_ref_[dna->nsn] = 1;
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // set child key
+                    memmove( &(dna->key[k*(1+max_key_bytes_)]), &insert_ky_[k*(1+max_key_bytes_)], max_key_bytes_+1 );
+
+                    #if DEBUG_I
+                    debug("DEBUG_I: dna->key[] k = %d\n", k);
+                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    {
+                        printf("%X ", *( &(dna->key[k*(1+max_key_bytes_)])+i ) );
+                    }
+                    printf("\n\n");
+                    #endif
+
+                    // key not found in rdx trie: link the new branch node and data node at the leftmost bit that key is
+                    // different from the terminating key actually found in trie - climbing from the data node the search
+                    // ended at, no second descent is needed.
+                    //
+                    // NOTE: the extra high order byte insures that any time we arrive at this code the two keys are
+                    //       different.  the maximum key bit will be the first bit of the extra byte.
+                    if ( nonunique_[k] &&
+                         memcmp( &insert_ky_[k*(1+max_key_bytes_)], &((DNODE *)insert_c_[k])->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) == 0 )
+                    {
+                        // key found in a non-unique key index - join the list of data nodes with the key
+                        append_dnode(dna, k, (DNODE *)insert_c_[k]);
+                        if ( order_stats_ )
+                        {
+                            add_count( ((DNODE *)insert_c_[k])->p[k], k, 1 );
+                        }
+                    }
+                    else
+                    {
+                        link_dnode(dna, k, insert_c_[k]);
+                    }
+                }
+
+                // set node to allocated status
+                dna->alloc = 1;
+
+                #if DEBUG_I
+                debug("DEBUG_I: dna = %p \n", (void *)dna );
+                #endif
+
+                // new node insertion successful, set return values
+                *app_datapp = &( dna->data );
+
+                #if DEBUG_I
+                debug("DEBUG_I: end insert(): %d\n", dna->id);
+                #endif
+
+                return 0;
+            }  // insert_dnode()
+
+            // take data node i(subscript of rdx_.dnodes) off its expiry wheel list
+            // used by: free_dnode(), set_expiry(), wheel_advance()
+                inline void
+            wheel_unlink
+                (
+                    const unsigned int i
+                )
+            {
+                wheel_nx_[wheel_pv_[i]] = wheel_nx_[i];
+                wheel_pv_[wheel_nx_[i]] = wheel_pv_[i];
+                wheel_nx_[i] = 0;
+                wheel_pv_[i] = 0;
+            }  // wheel_unlink()
+
+            // add data node i(subscript of rdx_.dnodes) to the end of the expiry wheel list for its expiry time - the due
+            // list if the time is not after wheel_time_
+            // used by: set_expiry(), wheel_advance()
+                inline void
+            wheel_link
+                (
+                    const unsigned int i
+                )
+            {
+                unsigned long long t = expire_at_[i];
+                unsigned int l = WHEEL_LISTS-1;  // wheel list - the due list
+                unsigned int h;                  // wheel list head subscript
+
+
+                if ( t > wheel_time_ )
+                {
+                    int level = (63 - __builtin_clzll( t ^ wheel_time_ )) / WHEEL_BITS;
+
+                    l = level*WHEEL_SLOTS + ( (t >> (level*WHEEL_BITS)) & (WHEEL_SLOTS-1) );
+                }
+
+                h = max_rdx_nodes_+1+l;
+                wheel_nx_[i] = h;
+                wheel_pv_[i] = wheel_pv_[h];
+                wheel_nx_[wheel_pv_[h]] = i;
+                wheel_pv_[h] = i;
+            }  // wheel_link()
+
+            // advance wheel_time_ to now.  at each level where the time changes the slots passed over are emptied and
+            // their data nodes linked again for the new time - into a lower level or the due list.  the levels above the
+            // first level where the time does not change are not touched.
+            // used by: expire()
+                void
+            wheel_advance
+                (
+                    const unsigned long long now
+                )
+            {
+                unsigned long long old = wheel_time_;
+
+
+                wheel_time_ = now;
+                for ( int level = 0 ; level < WHEEL_LEVELS ; level++ )
+                {
+                    int shift = level*WHEEL_BITS;
+                    int first;  // first slot passed over
+                    int last;   // last slot passed over
+
+                    if ( (old >> shift) == (now >> shift) )
+                    {
+                        break;
+                    }
+
+                    // past the last slot of the level if the time changes at a higher level too
+                    first = (int)( (old >> shift) & (WHEEL_SLOTS-1) ) + 1;
+                    last = ( shift+WHEEL_BITS < 64 && (old >> (shift+WHEEL_BITS)) != (now >> (shift+WHEEL_BITS)) ) ?
+                           WHEEL_SLOTS-1 : (int)( (now >> shift) & (WHEEL_SLOTS-1) );
+
+                    for ( int s = first ; s <= last ; s++ )
+                    {
+                        unsigned int h = max_rdx_nodes_+1 + level*WHEEL_SLOTS + s;  // wheel list head subscript
+
+                        while ( wheel_nx_[h] != h )
+                        {
+                            unsigned int i = wheel_nx_[h];
+
+                            wheel_unlink(i);
+                            wheel_link(i);
+                        }
+                    }
+                }
+            }  // wheel_advance()
+
+            // set data node d to free status, take it off the expiry wheel and return it to the data node free list
+            // used by: remove_dnode(), remove_prefix(), remove_range()
+                void
+            free_dnode
+                (
+                    DNODE *d
+                )
+            {
+                // take data node off the expiry wheel
+                if ( expiry_ && expire_at_[d->nsn] != 0 )
+                {
+                    wheel_unlink( d->nsn );
+                    expire_at_[d->nsn] = 0;
+                }
+
+                // set node to free status
+                d->alloc = 0;
+
+                // return data node to free list
+                d->nnfp = rdx_.dfree_head;
+                rdx_.dfree_head = d;
+
+                // decrement total allocated nodes
+                rdx_.alloc_nodes--;
+            }  // free_dnode()
+
+            // reset the fields of free data node d, left from before the last clear(), that a data node taken off the free
+            // list is expected to have
+            // used by: pop_dnode(), finish_clear()
+                void
+            reset_dnode
+                (
+                    DNODE *d
+                )
+            {
+                d->alloc = 0;
+
+                for ( int k = 0 ; num_nonunique_ != 0 && k < num_keys_ ; k++ )
+                {
+                    d->nx[k] = d;
+                    d->pv[k] = d;
+                }
+
+                if ( expiry_ )
+                {
+                    expire_at_[d->nsn] = 0;
+                    wheel_nx_[d->nsn] = 0;
+                    wheel_pv_[d->nsn] = 0;
+                }
+
+                if ( evict_ )
+                {
+                    clock_ref_[d->nsn] = 0;
+                }
+            }  // reset_dnode()
+
+            // take the data node at the head of the data node free list off it - the free list must not be empty
+            // used by: insert_dnode(), upsert(), bulk_load(), load()
+                inline DNODE *
+            pop_dnode
+                (
+                )
+            {
+                DNODE *d = rdx_.dfree_head;
+
+
+                if ( d->nsn < dfresh_ )
+                {
+                    rdx_.dfree_head = (DNODE *)(d->nnfp);
+                    return d;
+                }
+
+                // free since clear() - the next data node of the free list is the next subscript
+                reset_dnode(d);
+                dfresh_ = d->nsn+1;
+                rdx_.dfree_head = ( dfresh_ <= (unsigned int)max_rdx_nodes_ ) ? &rdx_.dnodes[dfresh_] : NULL;
+
+                return d;
+            }  // pop_dnode()
+
+            // take the branch node at the head of the key index k branch node free list off it - the free list must not be
+            // empty.  the fields of a branch node are all set when it is linked into the trie.
+            // used by: alloc_bnode(), bulk_link()
+                inline BNODE *
+            pop_bnode
+                (
+                    const int k
+                )
+            {
+                BNODE *b = rdx_.bfree_head[k];
+
+
+                if ( locality_ )
+                {
+                    clear_bfree_bit(k, b->nsn);  // may be left from before the last clear()
+                }
+
+                if ( b->nsn < bfresh_[k] )
+                {
+                    rdx_.bfree_head[k] = (BNODE *)(b->p);
+                    if ( locality_ && rdx_.bfree_head[k] != NULL && rdx_.bfree_head[k]->nsn < bfresh_[k] )
+                    {
+                        rdx_.bfree_head[k]->l = NULL;
+                    }
+                    return b;
+                }
+
+                // free since clear() - the next branch node of the free list is the next subscript
+                bfresh_[k] = b->nsn+1;
+                rdx_.bfree_head[k] = ( bfresh_[k] <= (unsigned int)max_rdx_nodes_ ) ? &rdx_.bnodes[bfresh_[k]*num_keys_+k] : NULL;
+
+                return b;
+            }  // pop_bnode()
+
+            // return branch node b to the head of the key index k branch node free list.  if locality_ the l pointer of
+            // the free branch node that was the head points back to b and b is marked free in bfree_map_.
+            // used by: unlink_dnode(), free_subtree(), remove_prefix()
+                inline void
+            push_bnode
+                (
+                    BNODE *b,
+                    const int k
+                )
+            {
+                BNODE *h = rdx_.bfree_head[k];
+
+
+                b->p = h;
+                if ( locality_ )
+                {
+                    b->l = NULL;
+                    if ( h != NULL && h->nsn < bfresh_[k] )
+                    {
+                        h->l = b;
+                    }
+                    bfree_map_[k*map_words_ + b->nsn/64] |= 1ULL << (b->nsn%64);
+                }
+                rdx_.bfree_head[k] = b;
+            }  // push_bnode()
+
+            // mark the key index k branch node with subscript n not free in bfree_map_
+            // used by: pop_bnode(), alloc_bnode()
+                inline void
+            clear_bfree_bit
+                (
+                    const int k,
+                    const unsigned int n
+                )
+            {
+                bfree_map_[k*map_words_ + n/64] &= ~(1ULL << (n%64));
+            }  // clear_bfree_bit()
+
+            // the bits of word w of the key index k bfree_map_ - without the bits at or above the clear() watermark
+            // bfresh_[k], left from before the last clear()
+            // used by: near_bnode()
+                inline unsigned long long
+            bfree_word
+                (
+                    const int k,
+                    const unsigned int w
+                )
+            {
+                if ( w*64 >= bfresh_[k] )
+                {
+                    return 0;
+                }
+
+                unsigned long long x = bfree_map_[k*map_words_ + w];
+
+                if ( bfresh_[k] - w*64 < 64 )
+                {
+                    x &= (1ULL << (bfresh_[k] - w*64)) - 1;
+                }
+
+                return x;
+            }  // bfree_word()
+
+            // find the free key index k branch node below the clear() watermark nearest subscript s - searching the
+            // bfree_map_ word of s, then the words either side of it out to LOCALITY_WORDS words away.  returns the
+            // subscript of the branch node found, 0 - no free branch node near s.
+            // used by: alloc_bnode()
+                unsigned int
+            near_bnode
+                (
+                    const int k,
+                    const unsigned int s
+                )
+            {
+                const unsigned int w = s/64;  // bfree_map_ word of s
+                unsigned long long x = bfree_word(k, w);
+                unsigned long long lo;        // bits of x at or below s
+
+
+                if ( x != 0 )
+                {
+                    lo = x & ( (2ULL << (s%64)) - 1 );  // all bits if s%64 is 63
+                    x &= ~lo;
+
+                    if ( lo == 0 )
+                    {
+                        return w*64 + __builtin_ctzll(x);
+                    }
+
+                    unsigned int below = w*64 + 63 - __builtin_clzll(lo);
+                    if ( x == 0 )
+                    {
+                        return below;
+                    }
+
+                    unsigned int above = w*64 + __builtin_ctzll(x);
+                    return ( s - below <= above - s ) ? below : above;
+                }
+
+                for ( unsigned int d = 1 ; d <= (unsigned int)LOCALITY_WORDS ; d++ )
+                {
+                    unsigned long long xb = ( w >= d ) ? bfree_word(k, w-d) : 0;
+                    unsigned long long xa = ( w+d < map_words_ ) ? bfree_word(k, w+d) : 0;
+
+                    if ( xb != 0 && xa != 0 )
+                    {
+                        unsigned int below = (w-d)*64 + 63 - __builtin_clzll(xb);
+                        unsigned int above = (w+d)*64 + __builtin_ctzll(xa);
+                        return ( s - below <= above - s ) ? below : above;
+                    }
+                    if ( xb != 0 )
+                    {
+                        return (w-d)*64 + 63 - __builtin_clzll(xb);
+                    }
+                    if ( xa != 0 )
+                    {
+                        return (w+d)*64 + __builtin_ctzll(xa);
+                    }
+                }
+
+                return 0;
+            }  // near_bnode()
+
+            // allocate a key index k branch node to link under parent branch node p.  if locality_ it is the free branch
+            // node nearest p in the arena, so that a search descending through p touches nearby memory, taken off the
+            // middle of the doubly linked free list.  otherwise, or if there is no free branch node near p, it is the head
+            // of the free list.  the free list must not be empty.
+            // used by: link_dnode()
+                BNODE *
+            alloc_bnode
+                (
+                    const int k,
+                    BNODE *p
+                )
+            {
+                unsigned int n = locality_ ? near_bnode(k, p->nsn) : 0;
+
+
+                if ( n == 0 )
+                {
+                    return pop_bnode(k);
+                }
+
+                BNODE *b = &rdx_.bnodes[n*num_keys_+k];
+                BNODE *pv = (BNODE *)(b->l);  // previous free branch node
+                BNODE *nx = (BNODE *)(b->p);  // next free branch node
+
+
+                if ( pv != NULL )
+                {
+                    pv->p = nx;
+                }
+                else
+                {
+                    rdx_.bfree_head[k] = nx;
+                }
+
+                if ( nx != NULL && nx->nsn < bfresh_[k] )
+                {
+                    nx->l = pv;
+                }
+
+                clear_bfree_bit(k, n);
+
+                return b;
+            }  // alloc_bnode()
+
+            // complete the free lists left by clear() - link and reset every node above the clear() watermarks as
+            // initialize() does, for the functions that walk all the nodes
+            // used by: print(), verify()
+                void
+            finish_clear
+                (
+                )
+            {
+                for ( unsigned int n = dfresh_ ; n <= (unsigned int)max_rdx_nodes_ ; n++ )
+                {
+                    reset_dnode( &rdx_.dnodes[n] );
+                    rdx_.dnodes[n].nnfp = ( n < (unsigned int)max_rdx_nodes_ ) ? &rdx_.dnodes[n+1] : NULL;
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        rdx_.dnodes[n].br[k] = 0;
+                        rdx_.dnodes[n].p[k] = 0;
+                        memset( &rdx_.dnodes[n].key[k*(1+max_key_bytes_)], 0, max_key_bytes_+1 );
+                    }
+                }
+                dfresh_ = max_rdx_nodes_+1;
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    BNODE *pv = NULL;  // if locality_ the free branch node before the one at the watermark
+
+
+                    // the last free branch node below the watermark
+                    for ( BNODE *b = rdx_.bfree_head[k] ; locality_ && b != NULL && b->nsn < bfresh_[k] ; b = (BNODE *)(b->p) )
+                    {
+                        pv = b;
+                    }
+
+                    for ( unsigned int n = bfresh_[k] ; n <= (unsigned int)max_rdx_nodes_ ; n++ )
+                    {
+                        BNODE *b = &rdx_.bnodes[n*num_keys_+k];
+
+                        b->id = 0;
+                        b->br = 0;
+                        b->p = ( n < (unsigned int)max_rdx_nodes_ ) ? &rdx_.bnodes[(n+1)*num_keys_+k] : NULL;
+                        b->b = 0;
+                        b->l = pv;
+                        b->r = NULL;
+
+                        if ( locality_ )
+                        {
+                            bfree_map_[k*map_words_ + n/64] |= 1ULL << (n%64);
+                            pv = b;
+                        }
+                    }
+                    bfresh_[k] = max_rdx_nodes_+1;
+                }
+            }  // finish_clear()
+
+            // unlink data node d and its parent branch nodes from every key index trie and free it
+            // used by: remove(), expire(), evict_dnode()
+                void
+            remove_dnode
+                (
+                    DNODE *d
+                )
+            {
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    unlink_dnode( d, k );
+                }
+
+                free_dnode( d );
+            }  // remove_dnode()
+
+            // destroy the app_data of data node d if it is constructed - the app_data of a removed data node is kept until
+            // the data node is reused or the trie is deleted so that the app_data returned by remove() may still be read
+            // used by: construct_data(), ~MKRdxPat()
+                inline void
+            destroy_data
+                (
+                    DNODE *d
+                )
+            {
+                if ( d->dcon == 1 )
+                {
+                    d->data.~app_data();
+                    d->dcon = 0;
+                }
+            }  // destroy_data()
+
+            // construct the app_data of data node d taken off the free list - default initialized as insert() always has,
+            // i.e. a struct of scalars is left uninitialized
+            // used by: insert_dnode(), upsert(), bulk_load()
+                inline void
+            construct_data
+                (
+                    DNODE *d
+                )
+            {
+                destroy_data(d);
+                new ( &d->data ) app_data;
+                d->dcon = 1;
+            }  // construct_data()
+
+            // construct the app_data of data node d taken off the free list in place from args
+            // used by: insert_dnode(), bulk_load(), load()
+                template <typename... Args>
+                inline void
+            construct_data
+                (
+                    DNODE *d,
+                    Args&&... args
+                )
+            {
+                destroy_data(d);
+                new ( &d->data ) app_data( std::forward<Args>(args)... );
+                d->dcon = 1;
+            }  // construct_data()
+
+            // allocate bsize zeroed bytes of full trie storage - calloc() for the default allocator, whose untouched pages
+            // stay unmapped until used, otherwise from alloc_.  NULL if calloc() fails - any other allocator throws.
+            // used by: MKRdxPat()
+                unsigned char *
+            arena_alloc
+                (
+                    const size_t bsize
+                )
+            {
+                const size_t n = (bsize + sizeof(std::max_align_t)-1) / sizeof(std::max_align_t);  // max_align_t units
+                unsigned char *p;
+
+
+                if ( std::is_same<allocator, std::allocator<unsigned char> >::value )
+                {
+                    return (unsigned char *)calloc( bsize, sizeof(unsigned char) );
+                }
+
+                arena_allocator a(alloc_);
+                p = (unsigned char *)std::allocator_traits<arena_allocator>::allocate( a, n );
+                memset( p, 0, bsize );
+
+                return p;
+            }  // arena_alloc()
+
+            // return the full trie storage p of bsize bytes from arena_alloc()
+            // used by: ~MKRdxPat()
+                void
+            arena_free
+                (
+                    unsigned char *p,
+                    const size_t bsize
+                )
+            {
+                const size_t n = (bsize + sizeof(std::max_align_t)-1) / sizeof(std::max_align_t);  // max_align_t units
+
+
+                if ( std::is_same<allocator, std::allocator<unsigned char> >::value )
+                {
+                    free( (void *)p );
+                    return;
+                }
+
+                arena_allocator a(alloc_);
+                std::allocator_traits<arena_allocator>::deallocate( a, (std::max_align_t *)p, n );
+            }  // arena_free()
+
+            // add the size of an array of n1*n2 elements of type T to the full trie size rdx_.bsize - first rounded up to a
+            // multiple of alignof(T), thus, the array starts where place_array() places it.  throws if the size does not
+            // fit in a size_t.
+            // used by: size_storage()
+                template <typename T>
+                void
+            add_bsize
+                (
+                    const size_t n1,
+                    const size_t n2
+                )
+            {
+                const size_t size = sizeof(T);
+
+
+                align_bsize( alignof(T) );
+
+                if ( n2 != 0 && n1 > SIZE_MAX / n2 )
+                {
+                    throw "MKRdxPat.hpp: trie size > SIZE_MAX(too many nodes, keys or key bytes)";
+                }
+
+                size_t bytes = n1 * n2;
+
+                if ( size != 0 && bytes > SIZE_MAX / size )
+                {
+                    throw "MKRdxPat.hpp: trie size > SIZE_MAX(too many nodes, keys or key bytes)";
+                }
+
+                bytes *= size;
+
+                if ( bytes > SIZE_MAX - rdx_.bsize )
+                {
+                    throw "MKRdxPat.hpp: trie size > SIZE_MAX(too many nodes, keys or key bytes)";
+                }
+
+                rdx_.bsize += bytes;
+            }  // add_bsize()
+
+            // round the full trie size rdx_.bsize up to a multiple of align, a power of 2.  throws if the size does not fit
+            // in a size_t.
+            // used by: add_bsize(), size_storage()
+                void
+            align_bsize
+                (
+                    const size_t align
+                )
+            {
+                if ( rdx_.bsize > SIZE_MAX - (align-1) )
+                {
+                    throw "MKRdxPat.hpp: trie size > SIZE_MAX(too many nodes, keys or key bytes)";
+                }
+
+                rdx_.bsize = (rdx_.bsize + align-1) & ~(align-1);
+            }  // align_bsize()
+
+            // fptr rounded up to a multiple of align, a power of 2.  the full trie storage starts max_align_t aligned(as far
+            // into its page as the trie saved if map()'ed), thus, fptr is at the offset align_bsize() rounded it up to.
+            // used by: place_array(), layout_storage()
+                static unsigned char *
+            align_fptr
+                (
+                    unsigned char *fptr,
+                    const size_t align
+                )
+            {
+                return (unsigned char *)( ((uintptr_t)fptr + align-1) & ~(uintptr_t)(align-1) );
+            }  // align_fptr()
+
+            // the array of n elements of type T at fptr rounded up to a multiple of alignof(T) - as add_bsize() sized it.
+            // fptr is moved past the array.
+            // used by: layout_storage()
+                template <typename T>
+                static T *
+            place_array
+                (
+                    unsigned char *&fptr,
+                    const size_t n
+                )
+            {
+                fptr = align_fptr( fptr, alignof(T) );
+
+                T *a = (T *)fptr;
+                fptr += n * sizeof(T);
+
+                return a;
+            }  // place_array()
+
+            // throw if the constructor MAX_RDX_NODES, NUM_KEYS or MAX_KEY_BYTES are out of range
+            // used by: MKRdxPat()
+                void
+            check_sizes
+                (
+                ) const
+            {
+                if ( max_rdx_nodes_ < 1 )
+                {
+                    throw "MKRdxPat.hpp: max_rdx_nodes_ < 1(must be > 0)";
+                }
+
+                if ( num_keys_ < 1 )
+                {
+                    throw "MKRdxPat.hpp: num_keys_ < 1(must be > 0)";
+                }
+
+                if ( max_key_bytes_ < 1 )
+                {
+                    throw "MKRdxPat.hpp: max_key_bytes_ < 1(must be > 0)";
+                }
+
+                // the node subscripts, n*num_keys_+k, k*(max_rdx_nodes_+1)+n and max_rdx_nodes_+1+WHEEL_LISTS, are int
+                if ( max_rdx_nodes_ > (INT_MAX - WHEEL_LISTS) / num_keys_ - 1 )
+                {
+                    throw "MKRdxPat.hpp: (max_rdx_nodes_+1) * num_keys_ > INT_MAX - WHEEL_LISTS";
+                }
+
+                // the key byte subscripts, k*(1+max_key_bytes_)+b, and the key bit numbers, up to max_key_bytes_*8+7, are int
+                if ( max_key_bytes_ > INT_MAX / num_keys_ - 1 || max_key_bytes_ > INT_MAX / 8 - 1 )
+                {
+                    throw "MKRdxPat.hpp: num_keys_ * (1+max_key_bytes_) or max_key_bytes_*8+7 > INT_MAX";
+                }
+            }  // check_sizes()
+
+            // the constructor OPTIONS of this trie
+            // used by: chg_max_rdx_nodes(), merge_tries()
+                unsigned int
+            options
+                (
+                ) const
+            {
+                return ( order_stats_ ? RDX_ORDER_STATS : 0 ) | ( expiry_ ? RDX_EXPIRY : 0 ) | ( evict_ ? RDX_EVICT : 0 ) |
+                       ( locality_ ? RDX_LOCALITY : 0 );
+            }  // options()
+
+            // compute the full trie size rdx_.bsize from the constructor arguments
+            // used by: MKRdxPat()
+                void
+            size_storage
+                (
+                )
+            {
+                rdx_.bsize = 0;  // the size of the trie - everything allocated by calloc() - add_bsize() checks it fits in a size_t
+
+                //
+                // total calloc() segments =
+                //     5(in PNODE_) +
+                //     ( max_rdx_nodes_+1 ) * 5(in DNODE) +
+                //     2(in insert()) +
+                //     2(in search()) +
+                //     2(in remove()) +
+                //     1(in print()) +
+                //     1(in range()) +
+                //     1(in rank()) +
+                //     1(for non-unique key indices) +
+                //     3(in expire()) +
+                //     1(in insert() eviction) +
+                //     1(in clear()) +
+                //     1(in insert() locality) +
+                //     6(in verify())
+                //
+
+                // 5(in PNODE_)
+                add_bsize<BNODE *>( 1, num_keys_ );                          // BNODE *head[num_keys_]
+                add_bsize<app_data *>( 1, max_rdx_nodes_+1 );                // app_data *app_data_ptrs[max_rdx_nodes_+1]
+                add_bsize<BNODE>( max_rdx_nodes_+1, num_keys_ );             // BNODE bnodes[max_rdx_nodes_+1][num_keys_]
+                add_bsize<BNODE *>( 1, num_keys_ );                          // BNODE *bfree_head[num_keys_]
+                add_bsize<DNODE>( 1, max_rdx_nodes_+1 );                     // DNODE dnodes[max_rdx_nodes_+1]
+
+                debug("BNODE *head[num_keys_]  -  (num_keys_) * sizeof(BNODE *) = %lu\n",
+                      (num_keys_) * sizeof(BNODE *));
+                debug("app_data *app_data_ptrs[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(app_data *) = %lu\n",
+                      (max_rdx_nodes_+1) * sizeof(app_data *));
+                debug("BNODE bnodes[max_rdx_nodes_+1][num_keys_]  -  ((max_rdx_nodes_+1) * num_keys_) * sizeof(BNODE) = %lu\n",
+                      ((max_rdx_nodes_+1) * num_keys_) * sizeof(BNODE));
+                debug("BNODE *bfree_head[num_keys_]  -  (num_keys_) * sizeof(BNODE *) = %lu\n",
+                      (num_keys_) * sizeof(BNODE *));
+                debug("DNODE dnodes[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(DNODE) = %lu\n\n",
+                      (max_rdx_nodes_+1) * sizeof(DNODE));
+
+                // ( max_rdx_nodes_+1 ) * 5(in DNODE) - no nx[]/pv[] space unless there is a non-unique key index.  the arrays
+                // of each data node are placed as by layout_storage() - starting and ending pointer aligned - so the arrays
+                // of data node 0 give the size of those of every data node
+                align_bsize( alignof(BNODE *) );
+                const size_t dnode_start = rdx_.bsize;  // the offset of the arrays of data node 0
+
+                add_bsize<unsigned int>( 1, num_keys_ );                                // unsigned int br[num_keys_]
+                add_bsize<BNODE *>( 1, num_keys_ );                                     // BNODE *p[num_keys_]
+                add_bsize<unsigned char>( 1, num_keys_ * (1+max_key_bytes_) );          // unsigned char key[num_keys_][1+max_key_bytes_]
+                add_bsize<DNODE *>( 1, ( num_nonunique_ ? num_keys_ : 0 ) );            // DNODE *nx[num_keys_]
+                add_bsize<DNODE *>( 1, ( num_nonunique_ ? num_keys_ : 0 ) );            // DNODE *pv[num_keys_]
+                align_bsize( alignof(BNODE *) );
+
+                const size_t dnode_bytes = rdx_.bsize - dnode_start;  // the bytes of the arrays of one data node
+
+                add_bsize<unsigned char>( max_rdx_nodes_, dnode_bytes );               // data nodes 1 to max_rdx_nodes_
+
+                debug("unsigned int br[num_keys_], BNODE *p[num_keys_], unsigned char key[num_keys_][1+max_key_bytes_], DNODE *nx[num_keys_], DNODE *pv[num_keys_]  -  aligned bytes per data node * ( max_rdx_nodes_+1 ) = %lu\n\n",
+                      dnode_bytes * ( max_rdx_nodes_+1 ));
+
+                // 2(in insert())
+                add_bsize<BNODE *>( 1, num_keys_ );                                    // BNODE *insert_c_[num_keys_]
+                add_bsize<unsigned char>( num_keys_, 1+max_key_bytes_ );               // unsigned char insert_ky_[num_keys_][1+max_key_bytes_]
+
+                debug("BNODE *insert_c_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
+                      num_keys_ * sizeof(BNODE *));
+                debug("unsigned char insert_ky_[num_keys_][1+max_key_bytes_]  -  num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
+                      num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char));
+
+                // 2(in search())
+                add_bsize<BNODE *>( 1, num_keys_ );                                    // BNODE *search_c_[num_keys_]
+                add_bsize<unsigned char>( num_keys_, 1+max_key_bytes_ );               // unsigned char search_ky_[num_keys_][1+max_key_bytes_]
+
+                debug("BNODE *search_c_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
+                      num_keys_ * sizeof(BNODE *));
+                debug("unsigned char search_ky_[num_keys_][1+max_key_bytes_]  -  num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
+                      num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char));
+
+                // 2(in remove())
+                add_bsize<BNODE *>( 1, num_keys_ );                                    // BNODE *remove_c_[num_keys_]
+                add_bsize<unsigned char>( num_keys_, 1+max_key_bytes_ );               // unsigned char remove_ky_[num_keys_][1+max_key_bytes_]
+
+                debug("BNODE *remove_c_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
+                      num_keys_ * sizeof(BNODE *));
+                debug("unsigned char remove_ky_[num_keys_][1+max_key_bytes_]  -  num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
+                      num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char));
+
+                // 1(in print())
+                add_bsize<unsigned char>( 1, 1+max_key_bytes_ );          // unsigned char print_ky_[1+max_key_bytes_]
+
+                debug("unsigned char print_ky_[1+max_key_bytes_]  -  (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
+                      (1+max_key_bytes_) * sizeof(unsigned char));
+
+                // 1(in range())
+                add_bsize<unsigned char>( 1, 1+max_key_bytes_ );          // unsigned char range_ky_[1+max_key_bytes_]
+
+                debug("unsigned char range_ky_[1+max_key_bytes_]  -  (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
+                      (1+max_key_bytes_) * sizeof(unsigned char));
+
+                // 1(in rank()) - no space unless order statistics are kept
+                add_bsize<unsigned int>( ( order_stats_ ? max_rdx_nodes_+1 : 0 ), num_keys_ );          // unsigned int order_cnt_[max_rdx_nodes_+1][num_keys_]
+
+                debug("unsigned int order_cnt_[max_rdx_nodes_+1][num_keys_]  -  ( order_stats_ ? (max_rdx_nodes_+1) * num_keys_ : 0 ) * sizeof(unsigned int) = %lu\n\n",
+                      ( order_stats_ ? (max_rdx_nodes_+1) * num_keys_ : 0 ) * sizeof(unsigned int));
+
+                // 1(for non-unique key indices)
+                add_bsize<unsigned char>( 1, num_keys_ );          // unsigned char nonunique_[num_keys_]
+
+                debug("unsigned char nonunique_[num_keys_]  -  num_keys_ * sizeof(unsigned char) = %lu\n\n",
+                      num_keys_ * sizeof(unsigned char));
+
+                // 3(in expire()) - no space unless expiry times are kept
+                add_bsize<unsigned long long>( 1, ( expiry_ ? max_rdx_nodes_+1 : 0 ) );                  // unsigned long long expire_at_[max_rdx_nodes_+1]
+                add_bsize<unsigned int>( 1, ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) );          // unsigned int wheel_nx_[max_rdx_nodes_+1+WHEEL_LISTS]
+                add_bsize<unsigned int>( 1, ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) );          // unsigned int wheel_pv_[max_rdx_nodes_+1+WHEEL_LISTS]
+
+                debug("unsigned long long expire_at_[max_rdx_nodes_+1]  -  ( expiry_ ? max_rdx_nodes_+1 : 0 ) * sizeof(unsigned long long) = %lu\n",
+                      ( expiry_ ? max_rdx_nodes_+1 : 0 ) * sizeof(unsigned long long));
+                debug("unsigned int wheel_nx_[max_rdx_nodes_+1+WHEEL_LISTS]  -  ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) * sizeof(unsigned int) = %lu\n",
+                      ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) * sizeof(unsigned int));
+                debug("unsigned int wheel_pv_[max_rdx_nodes_+1+WHEEL_LISTS]  -  ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) * sizeof(unsigned int) = %lu\n\n",
+                      ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) * sizeof(unsigned int));
+
+                // 1(in insert() eviction) - no space unless a full trie evicts
+                add_bsize<unsigned char>( 1, ( evict_ ? max_rdx_nodes_+1 : 0 ) );          // unsigned char clock_ref_[max_rdx_nodes_+1]
+
+                debug("unsigned char clock_ref_[max_rdx_nodes_+1]  -  ( evict_ ? max_rdx_nodes_+1 : 0 ) * sizeof(unsigned char) = %lu\n\n",
+                      ( evict_ ? max_rdx_nodes_+1 : 0 ) * sizeof(unsigned char));
+
+                // 1(in clear())
+                add_bsize<unsigned int>( 1, num_keys_ );          // unsigned int bfresh_[num_keys_]
+
+                debug("unsigned int bfresh_[num_keys_]  -  (num_keys_) * sizeof(unsigned int) = %lu\n\n",
+                      (num_keys_) * sizeof(unsigned int));
+
+                // 1(in insert() locality) - no space unless branch node allocation is locality aware
+                map_words_ = (max_rdx_nodes_+1 + 63) / 64;  // max_rdx_nodes_+1+WHEEL_LISTS fits in an int
+                add_bsize<unsigned long long>( ( locality_ ? num_keys_ : 0 ), map_words_ );          // unsigned long long bfree_map_[num_keys_][map_words_]
+
+                debug("unsigned long long bfree_map_[num_keys_][map_words_]  -  ( locality_ ? num_keys_ * map_words_ : 0 ) * sizeof(unsigned long long) = %lu\n\n",
+                      ( locality_ ? num_keys_ * map_words_ : 0 ) * sizeof(unsigned long long));
+
+                // 6(in verify())
+                add_bsize<unsigned long>( num_keys_, max_rdx_nodes_+1 );                                  // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]
+                add_bsize<unsigned long>( num_keys_, max_rdx_nodes_+1 );                                  // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]
+                add_bsize<unsigned long>( 1, max_rdx_nodes_+1 );                                          // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1]
+                add_bsize<unsigned long>( 1, max_rdx_nodes_+1 );                                          // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]
+                add_bsize<unsigned char>( num_keys_ * (max_rdx_nodes_+1), max_key_bytes_ );               // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]
+                add_bsize<unsigned long>( 2, max_rdx_nodes_+1 );                                          // unsigned long verify_node_index_[2][max_rdx_nodes_+1]
+
+                debug("unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]  -  num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
+                      num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long));
+                debug("unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]  -  num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
+                      num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long));
+                debug("unsigned long verify_dnode_addrs_[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
+                      (max_rdx_nodes_+1) * sizeof(unsigned long));
+                debug("unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
+                      (max_rdx_nodes_+1) * sizeof(unsigned long));
+                debug("unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]  -  num_keys_ * (max_rdx_nodes_+1) * max_key_bytes_ * sizeof(unsigned char) = %lu\n",
+                      (size_t)num_keys_ * (max_rdx_nodes_+1) * max_key_bytes_ * sizeof(unsigned char));
+                debug("unsigned long verify_node_index_[2][max_rdx_nodes_+1]  -  2 * (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n\n",
+                      2 * (max_rdx_nodes_+1) * sizeof(unsigned long));
+            }  // size_storage()
+
+            // carve the full trie storage at fptr, of rdx_.bsize bytes, into its arrays.  if dnode_links the DNODE br, p,
+            // key, nx and pv pointers are set as well.
+            // used by: MKRdxPat()
+                void
+            layout_storage
+                (
+                    unsigned char *fptr,
+                    const bool dnode_links
+                )
+            {
+                // dynamic allocation for PNODE_ - each array placed as add_bsize() sized it in size_storage()
+                rdx_.head = place_array<BNODE *>( fptr, num_keys_ );
+                rdx_.app_data_ptrs = place_array<app_data *>( fptr, max_rdx_nodes_+1 );
+                rdx_.bnodes = place_array<BNODE>( fptr, (size_t)(max_rdx_nodes_+1) * num_keys_ );
+                rdx_.bfree_head = place_array<BNODE *>( fptr, num_keys_ );
+                rdx_.dnodes = place_array<DNODE>( fptr, max_rdx_nodes_+1 );
+
+
+                // dynamic allocation for DNODE - the DNODE pointers into it are already set in a mapped snapshot unless it
+                // was relocated.  the arrays of each data node start and end pointer aligned as in size_storage().
+                for ( int i = 0 ; i < max_rdx_nodes_+1 ; i++ )
+                {
+                    fptr = align_fptr( fptr, alignof(BNODE *) );
+
+                    unsigned int *br = place_array<unsigned int>( fptr, num_keys_ );
+                    BNODE **p = place_array<BNODE *>( fptr, num_keys_ );
+                    unsigned char *key = place_array<unsigned char>( fptr, num_keys_ * (1+max_key_bytes_) );
+                    DNODE **nx = place_array<DNODE *>( fptr, ( num_nonunique_ ? num_keys_ : 0 ) );
+                    DNODE **pv = place_array<DNODE *>( fptr, ( num_nonunique_ ? num_keys_ : 0 ) );
+
+                    if ( dnode_links )
+                    {
+                        rdx_.dnodes[i].br = br;
+                        rdx_.dnodes[i].p = p;
+                        rdx_.dnodes[i].key = key;
+                        rdx_.dnodes[i].nx = nx;
+                        rdx_.dnodes[i].pv = pv;
+                    }
+                }
+                fptr = align_fptr( fptr, alignof(BNODE *) );
+
+                // dynamic allocation for insert()
+                insert_c_ = place_array<BNODE *>( fptr, num_keys_ );
+                insert_ky_ = place_array<unsigned char>( fptr, num_keys_ * (1+max_key_bytes_) );
+
+                // dynamic allocation for search()
+                search_c_ = (BNODE *)place_array<BNODE *>( fptr, num_keys_ );
+                search_ky_ = place_array<unsigned char>( fptr, num_keys_ * (1+max_key_bytes_) );
+
+                // dynamic allocation for remove()
+                remove_c_ = (BNODE *)place_array<BNODE *>( fptr, num_keys_ );
+                remove_ky_ = place_array<unsigned char>( fptr, num_keys_ * (1+max_key_bytes_) );
+
+                // dynamic allocation for print()
+                print_ky_ = place_array<unsigned char>( fptr, 1+max_key_bytes_ );
+
+                // dynamic allocation for range()
+                range_ky_ = place_array<unsigned char>( fptr, 1+max_key_bytes_ );
+
+                // dynamic allocation for rank()
+                order_cnt_ = place_array<unsigned int>( fptr, ( order_stats_ ? (size_t)(max_rdx_nodes_+1) * num_keys_ : 0 ) );
+
+                // dynamic allocation for non-unique key indices
+                nonunique_ = place_array<unsigned char>( fptr, num_keys_ );
+
+                // dynamic allocation for expire()
+                expire_at_ = place_array<unsigned long long>( fptr, ( expiry_ ? max_rdx_nodes_+1 : 0 ) );
+                wheel_nx_ = place_array<unsigned int>( fptr, ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) );
+                wheel_pv_ = place_array<unsigned int>( fptr, ( expiry_ ? max_rdx_nodes_+1+WHEEL_LISTS : 0 ) );
+
+                // dynamic allocation for insert() eviction
+                clock_ref_ = place_array<unsigned char>( fptr, ( evict_ ? max_rdx_nodes_+1 : 0 ) );
+
+                // dynamic allocation for clear()
+                bfresh_ = place_array<unsigned int>( fptr, num_keys_ );
+
+                // dynamic allocation for insert() locality
+                bfree_map_ = place_array<unsigned long long>( fptr, ( locality_ ? (size_t)num_keys_ * map_words_ : 0 ) );
+
+                // dynamic allocation for verify()
+                verify_bnode_addrs_ = place_array<unsigned long>( fptr, (size_t)num_keys_ * (max_rdx_nodes_+1) );
+                verify_free_bnode_addrs_ = place_array<unsigned long>( fptr, (size_t)num_keys_ * (max_rdx_nodes_+1) );
+                verify_dnode_addrs_ = place_array<unsigned long>( fptr, max_rdx_nodes_+1 );
+                verify_free_dnode_addrs_ = place_array<unsigned long>( fptr, max_rdx_nodes_+1 );
+                verify_dnode_keys_ = place_array<unsigned char>( fptr, (size_t)num_keys_ * (max_rdx_nodes_+1) * max_key_bytes_ );
+                verify_node_index_ = place_array<unsigned long>( fptr, (size_t)2 * (max_rdx_nodes_+1) );
+            }  // layout_storage()
+
+            // remove the data node the CLOCK hand stops at - the first allocated data node after the hand with its
+            // reference bit clear.  the reference bits of the data nodes passed over are cleared, thus, the hand stops
+            // within two turns of the data node array.  the trie must not be empty.
+            // used by: insert_dnode(), upsert()
+                void
+            evict_dnode
+                (
+                )
+            {
+                for ( ;; )
+                {
+                    clock_hand_ = clock_hand_ % max_rdx_nodes_ + 1;  // 1 - max_rdx_nodes_
+
+                    if ( rdx_.dnodes[clock_hand_].alloc == 1 )
+                    {
+                        if ( clock_ref_[clock_hand_] == 0 )
+                        {
+                            remove_dnode( &rdx_.dnodes[clock_hand_] );
+                            return;
+                        }
+
+                        clock_ref_[clock_hand_] = 0;
+                    }
+                }
+            }  // evict_dnode()
+
+            // recursive routine to free a subtree already detached from the key index k trie.  the branch nodes are
+            // returned to the key index k free list.  the data nodes - with the lists of data nodes of the same key of a
+            // non-unique key index - are unlinked from every other key index trie and returned to the data node free list.
+            // returns the number of data nodes freed.
+            // used by: remove_prefix()
+                int
+            free_subtree
+                (
+                    BNODE *c,
+                    const int k
+                )
+            {
+                if ( c->id == 0 )
+                {
+                    int n = free_subtree( (BNODE *)(c->l), k ) + free_subtree( (BNODE *)(c->r), k );
+
+                    push_bnode(c, k);
+
+                    return n;
+                }
+
+                DNODE *d = (DNODE *)c;  // current data node of the list
+                DNODE *nd;              // next data node of the list
+                int n = 0;
+
+                do
+                {
+                    nd = nonunique_[k] ? d->nx[k] : d;
+
+                    for ( int j = 0 ; j < num_keys_ ; j++ )
+                    {
+                        if ( j != k )
+                        {
+                            unlink_dnode( d, j );
+                        }
+                    }
+                    free_dnode( d );
+                    n++;
+
+                    d = nd;
+                } while ( d != (DNODE *)c );
+
+                return n;
+            }  // free_subtree()
+
+            // recursive routine to descend the key index k rdx_ trie
+            // used by: sort()
+                void
+            recursive
+                (
+                    BNODE *bnode_ptr,
+                    const int k
+                )
+            {
+                // bnode_ptr is NULL only at end of trie traversal
+                if ( bnode_ptr == NULL )
+                {
+                    return;
+                }
+
+                // if branch node continue down trie.  if data node inc count and store node ptr
+                if ( bnode_ptr->id != 1 )
+                {
+                    recursive( (BNODE *)(bnode_ptr->l), k );
+                    recursive( (BNODE *)(bnode_ptr->r), k );
+                }
+                else
+                {
+                    rdx_.app_data_ptrs[rdx_.app_data_ptrs_cnt++] = &( ((DNODE *)(bnode_ptr))->data );
+
+                    // the rest of the list of data nodes with the same key of a non-unique key index
+                    if ( nonunique_[k] && (DNODE *)bnode_ptr != &rdx_.dnodes[0] )
+                    {
+                        for ( DNODE *d = ((DNODE *)bnode_ptr)->nx[k] ; d != (DNODE *)bnode_ptr ; d = d->nx[k] )
+                        {
+                            rdx_.app_data_ptrs[rdx_.app_data_ptrs_cnt++] = &( d->data );
+                        }
+                    }
+                }
+            }  // recursive()
+
+            // used to compare node addresses stored in unsigned longs
+            // used by: verify()
+                static int
+            unsigned_long_compare
+                (
+                    const void *a,
+                    const void *b
+                )
+            {
+                if ( *(unsigned long *)a < *(unsigned long *)b )
+                {
+                    return -1;
+                }
+                else if ( *(unsigned long *)a > *(unsigned long *)b )
+                {
+                    return 1;
+                }
+
+                return 0;
+            }  // unsigned_long_compare()
+
+            /*
+             *======================================================================================================================
+             *     search_dnode()
+             *
+             * Purpose: 
+             *     search trie for the data node with the keys key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte
+             *     for all keys(key[k][0]) is the key boolean.  the key boolean should be set to 1(use the key) or
+             *     0(do not use key).  the actual key bytes(key[k][1 to max_key_bytes_]) follow the key boolean.  thus, 1 to
+             *     num_keys_ keys may be used in any given search.  only one key is necessary to find the data node.  each key
+             *     must be unique within it's key index(0 - NUM_KEYS-1).
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     DNODE *dnodep;
+             *
+             *     dnodep = rdx->search_dnode((unsigned char *)key);
+             *
+             * Returns:
+             *     1. DNODE *dnodep - if search is successful
+             *     2. DNODE *NULL - if any key boolean is not 0 or 1
+             *     3. DNODE *NULL - if two key searches end at different data nodes
+             *     4. DNODE *NULL - if any key search does not end at a data node
+             *     5. DNODE *NULL - if no key boolean is 1 then no keys are used
+             *    
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *
+             * Comments:
+             *     1. this routine is identical to the search() member function except for the return statement which returns
+             *        a pointer to the data node(DNODE *) instead of a pointer to the application data struct(app_data *).
+             *        it is a private function used for accessing any data values in the DNODE which users should not be able to access.
+             *
+             *     2.
+             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
+             *
+             *          example 1:
+             *          in key[][]:
+             *             key number  key
+             *             0           01 aa bb cc dd    
+             *             1           01 ee ee ee ee
+             *             2           01 ff ff ff ff
+             *
+             *             use all three keys(0,1,2) in the search
+             *
+             *          example 2:
+             *          in key[][]:
+             *             0           00 aa bb cc dd
+             *             1           01 ee ee ee ee
+             *             2           00 ff ff ff ff
+             *
+             *             use only key 1 in the search
+             *
+             *          example 3:
+             *          in key[][]:
+             *             0           01 00 00 00 01
+             *             1           01 00 00 00 01
+             *             2           01 00 00 00 01
+             *
+             *             inserted successfuly - a. all key booleans 1  b. each key unique in it's own key index(0 - 2)
+             */
+
+                DNODE *
+            search_dnode
+                (
+                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // BNODE *search_c_;           // BNODE *search_c_[num_keys_];
+                // unsigned char *search_ky_;  // unsigned char search_ky_[num_keys_][1+max_key_bytes_];
+
+                BNODE *csav = NULL;  // save first key data node address and make sure all key searches end at the same data node
+
+                bool firsttime = true;  // every search() call
+
+
+                int n = 0;  // sum of key booleans that are 1 - must be >=1
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    #if DEBUG_S
+                    debug("DEBUG_S: k = %d\n", k);
+                    #endif
+
+                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
+                    {
+                        continue;  // if key boolean is 0 skip key
+                    }
+                    else if ( key[k*(1+max_key_bytes_)+0] == 1 )
+                    {
+                        n++;  // if key boolean is 1 use key
+                    }
+                    else
+                    {
+                        return NULL;  // if a key boolean is not 0 or 1
+                    }
+
+                    // copy key to storage with extra byte for comparison
+                    search_ky_[k*(1+max_key_bytes_)+0] = 0;
+                    memmove( &search_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+
+                    // a non-unique key index only selects among the data nodes found with the other keys
+                    if ( nonunique_[k] )
+                    {
+                        continue;
+                    }
+
+                    // search for key in rdx trie
+                    search_c_ = (BNODE *)(rdx_.head[k]->l);
+                    while ( search_c_->id == 0 )
+                    {
+                        search_c_ = ( gbit( &search_ky_[k*(1+max_key_bytes_)+0], search_c_->b ) ) ? (BNODE *)(search_c_->r) : (BNODE *)(search_c_->l);
+                    }
+
+                    #if DEBUG_S
+                    debug("DEBUG_S: search_c_ = %p \n", (void *)search_c_ );
+                    debug("DEBUG_S: ((DNODE *)search_c_)->key = %p \n", (void *)((DNODE *)search_c_)->key );
+                    #endif
+
+                    // check if all keys end at the same data node - if not return NULL
+                    if ( firsttime == true )
+                    {
+                        csav = search_c_;
+                        firsttime = false;
+                    }
+                    else
+                    {
+                        if ( search_c_ != csav )
+                        {
+                            return NULL;  // a key does not end at the same data node as a previous key
+                        }
+                    }
+
+                    #if DEBUG_S
+                    debug("%s", "\n");
+                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    {
+                        printf("%X ", *(&search_ky_[k*(1+max_key_bytes_)+0]+i) );
+                    }
+                    printf("\n");
+
+                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    {
+                        printf("DEBUG_S: %p\n",  (void *)(&((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i) );
+                        printf("DEBUG_S: %X\n", *( &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i ) );
+                    }
+                    printf("\n");
+
+                    printf("DEBUG_S: dna = %p\n", (void *)(DNODE *)search_c_ );
+                    #endif
+
+                    // if key not found return NULL
+                    if ( memcmp( &search_ky_[k*(1+max_key_bytes_)+0], &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) != 0 )
+                    {
+                        #if DEBUG_S
+                        debug("%s", "DEBUG_S: k = exit2\n");
+                        #endif
+
+                        return NULL;  // key not found
+                    }
+                }
+
+                if ( n == 0 )
+                {
+                    #if DEBUG_S
+                    debug("%s", "DEBUG_S: k = exit3\n");
+                    #endif
+
+                    return NULL;  // no keys are used(all key booleans are 0)
+                }
+
+                if ( num_nonunique_ != 0 && (search_c_ = (BNODE *)nonunique_dnode(key, search_ky_, (DNODE *)csav)) == NULL )
+                {
+                    return NULL;  // a non-unique key index key is not found
+                }
+
+                // success - all keys found in the same data node - return data node pointer
+                return (DNODE *)(search_c_);
+            }  // search_dnode()
+
+            /*
+             *======================================================================================================================
+             *     initialize()
+             *
+             * Purpose: 
+             *     Initialize the defined PNODE_ data structure.  This includes setting the data and branch node sequence
+             *     numbers and data node allocated status(to 0).  Set total allocated nodes to 0, and allocated status of
+             *     root node to 1.  Set the branch node free list up for each key and the data node free list.
+             *
+             * Usage:
+             *     initialize();
+             *
+             * Returns:
+             *     None
+             *
+             * Parameters:
+             *     None
+             *
+             * Comments:
+             *     1. remember that the data structure has 1+max_rdx_nodes_ nodes(each of which has one data and
+             *        num_keys_ branch nodes).  the first is the always allocated impossible key root node.  the rest
+             *        are the max_rdx_nodes_ user usable nodes.
+             *
+             *     2. certain pointers in the root node, such as parent pointers, are set to zero and permanently
+             *        remain so since they have nothing to point to.  in root node printouts they should be zero.
+             */
+
+                void
+            initialize
+                (
+                )
+            {
+                // set data and branch node sequence numbers and node allocated status
+                for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                {
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        rdx_.bnodes[n*num_keys_+k].nsn = n;
+                    }
+
+                    rdx_.dnodes[n].nsn = n;
+                    rdx_.dnodes[n].alloc = 0;
+
+                    // clear any expiry time, wheel links and clock reference bit left from before a clear()
+                    if ( expiry_ ) { expire_at_[n] = 0; wheel_nx_[n] = 0; wheel_pv_[n] = 0; }
+                    if ( evict_ ) { clock_ref_[n] = 0; }
+                }
+                rdx_.dnodes[0].alloc = 1;  // root impossible key(0xff) node
+
+                // reset total allocated nodes
+                rdx_.alloc_nodes = 0;
+
+                // for each key set various branch/data/head fields and pointers
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // set rdx trie head pointer(s)
+                    rdx_.head[k] = &(rdx_.bnodes[0*num_keys_+k]);
+
+                    // init head branch node
+                    rdx_.bnodes[0*num_keys_+k].id = 0;
+                    rdx_.bnodes[0*num_keys_+k].br = 0;
+                    rdx_.bnodes[0*num_keys_+k].p = NULL;
+                    rdx_.bnodes[0*num_keys_+k].b = max_key_bytes_*8;
+                    rdx_.bnodes[0*num_keys_+k].l = &rdx_.dnodes[0];
+                    rdx_.bnodes[0*num_keys_+k].r = NULL;
+
+                    // build the branch node free list
+                    rdx_.bfree_head[k] = &(rdx_.bnodes[1*num_keys_+k]);
+                    for ( int n = 1 ; n < max_rdx_nodes_ ; n++ )
+                    {
+                        rdx_.bnodes[n*num_keys_+k].id = 0;
+                        rdx_.bnodes[n*num_keys_+k].br = 0;
+                        rdx_.bnodes[n*num_keys_+k].p = &rdx_.bnodes[(n+1)*num_keys_+k];
+                        rdx_.bnodes[n*num_keys_+k].b = 0;
+                        rdx_.bnodes[n*num_keys_+k].l = NULL;
+                        rdx_.bnodes[n*num_keys_+k].r = NULL;
+                    }
+                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].id = 0;
+                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].br = 0;
+                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].p = NULL;
+                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].b = 0;
+                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].l = NULL;
+                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].r = NULL;
+
+                    // locality aware - the free list is doubly linked and every branch node but the head is marked free
+                    for ( int n = 1 ; locality_ && n <= max_rdx_nodes_ ; n++ )
+                    {
+                        rdx_.bnodes[n*num_keys_+k].l = ( n > 1 ) ? &rdx_.bnodes[(n-1)*num_keys_+k] : NULL;
+                        bfree_map_[k*map_words_ + n/64] |= 1ULL << (n%64);
+                    }
+
+                    // init data node fields
+                    for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                    {
+                        rdx_.dnodes[n].br[k] = 0;
+                        rdx_.dnodes[n].p[k] = 0;
+                        memset( &rdx_.dnodes[n].key[k*(1+max_key_bytes_)], 0, max_key_bytes_+1 );
+
+                        if ( num_nonunique_ != 0 )
+                        {
+                            rdx_.dnodes[n].nx[k] = &rdx_.dnodes[n];
+                            rdx_.dnodes[n].pv[k] = &rdx_.dnodes[n];
+                        }
+                    }
+
+                    // set data node parent pointers of root node to branch nodes for each key
+                    rdx_.dnodes[0].p[k] = &rdx_.bnodes[0*num_keys_+k];
+
+                    // init head data node key to impossible value, (the extra high order 0xff byte).
+                    memset( &rdx_.dnodes[0].key[k*(1+max_key_bytes_)], 0xff, max_key_bytes_+1 );
+                }
+
+                // build the data node free list - use DNODE nnfp as pointer to next node
+                rdx_.dnodes[0].id = 1;
+
+                rdx_.dfree_head = &rdx_.dnodes[1];
+
+                for ( int n = 1 ; n < max_rdx_nodes_ ; n++ )
+                {
+                    rdx_.dnodes[n].nnfp = (BNODE *)(&rdx_.dnodes[n+1]);
+                    rdx_.dnodes[n].id = 1;
+                }
+                rdx_.dnodes[max_rdx_nodes_].nnfp = NULL;
+                rdx_.dnodes[max_rdx_nodes_].id = 1;
+
+                // every free node is linked into its free list
+                dfresh_ = max_rdx_nodes_+1;
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    bfresh_[k] = max_rdx_nodes_+1;
+                }
+
+                // empty expiry wheel lists - each list head points to itself
+                for ( int l = 0 ; expiry_ && l < WHEEL_LISTS ; l++ )
+                {
+                    wheel_nx_[max_rdx_nodes_+1+l] = max_rdx_nodes_+1+l;
+                    wheel_pv_[max_rdx_nodes_+1+l] = max_rdx_nodes_+1+l;
+                }
+            }  // initialize()
+
+            /*
+             *======================================================================================================================
+             *     bulk_link()
+             *
+             * Purpose:
+             *     Build the key index k trie bottom up from n already allocated data nodes.  The data node pointers are sorted
+             *     by key k(unless already in order) and each new branch node bit is the first differing bit of two adjacent
+             *     keys.  The branch nodes are linked with a stack holding the right edge of the partially built trie - the
+             *     classic linear time cartesian tree construction - thus, each data node and branch node is touched a
+             *     constant number of times.
+             *
+             * Usage:
+             *     vector<DNODE *> dnodeps;
+             *     int return_code;
+             *
+             *     return_code = bulk_link(k, dnodeps, order);
+             *
+             * Returns:
+             *     1. int return_code = 0 - the key index k trie was built
+             *     2. int return_code = 1 - two data nodes have the same key k - nothing was linked
+             *
+             * Parameters:
+             *     const int k                - key index(0 - NUM_KEYS-1)
+             *     vector<DNODE *> dnodeps    - the allocated data nodes(passed by value - sorted here)
+             *     const unsigned int *order  - NULL or the order of identical keys by data node sequence number - lowest
+             *                                  first
+             *
+             * Comments:
+             *     1. the key index k trie must be empty on entry.  only the key index k fields of branch and data nodes, the
+             *        rdx_.head[k] trie and the rdx_.bfree_head[k] free list are modified.  thus, bulk_link() may be run
+             *        in parallel threads for different key indexes.
+             *
+             *     2. identical keys of a non-unique key index are listed in dnodeps order unless order is given.
+             */
+
+                int
+            bulk_link
+                (
+                    const int k,
+                    vector<DNODE *> dnodeps,
+                    const unsigned int *order = NULL
+                )
+            {
+                int n = dnodeps.size();
+                const int kbytes = 1+max_key_bytes_;  // key bytes including the extra prefix byte
+
+                vector<BNODE *> stack;  // branch nodes whose right child is not yet linked - b decreasing to the top
+                BNODE *c;               // the completed subtree holding the keys up to the current data node
+                BNODE *bna;             // branch node address assigned from the free queue head
+
+
+                auto key_less = [k, kbytes, order](const DNODE *a, const DNODE *b)
+                                {
+                                    int c = memcmp( &a->key[k*kbytes], &b->key[k*kbytes], kbytes );
+
+                                    return c < 0 || ( c == 0 && order != NULL && order[a->nsn] < order[b->nsn] );
+                                };
+
+                // keys already in key k order need only the linear check.  the sort is stable so that identical keys in a
+                // non-unique key index stay in key[][][] order when no order is given
+                if ( !std::is_sorted(dnodeps.begin(), dnodeps.end(), key_less) )
+                {
+                    std::stable_sort(dnodeps.begin(), dnodeps.end(), key_less);
+                }
+
+                if ( nonunique_[k] )
+                {
+                    // in sorted order identical keys are adjacent - only the first data node of each key is linked into
+                    // the trie and the rest are listed after it
+                    int m = 0;  // number of different keys
+
+                    for ( int i = 0 ; i < n ; i++ )
+                    {
+                        if ( m > 0 && memcmp( &dnodeps[m-1]->key[k*kbytes], &dnodeps[i]->key[k*kbytes], kbytes ) == 0 )
+                        {
+                            append_dnode( dnodeps[i], k, dnodeps[m-1] );
+                        }
+                        else
+                        {
+                            dnodeps[m] = dnodeps[i];
+                            dnodeps[m]->nx[k] = dnodeps[m];
+                            dnodeps[m]->pv[k] = dnodeps[m];
+                            m++;
+                        }
+                    }
+
+                    dnodeps.resize(m);
+                    n = m;
+                }
+                else
+                {
+                    // keys must be unique within their key index - in sorted order identical keys are adjacent
+                    for ( int i = 0 ; i < n-1 ; i++ )
+                    {
+                        if ( memcmp( &dnodeps[i]->key[k*kbytes], &dnodeps[i+1]->key[k*kbytes], kbytes ) == 0 )
+                        {
+                            return 1;
+                        }
+                    }
+                }
+
+                stack.reserve(n);
+                c = (BNODE *)dnodeps[0];
+                for ( int i = 0 ; i < n-1 ; i++ )
+                {
+                    unsigned int b = diff_bit( &dnodeps[i]->key[k*kbytes], &dnodeps[i+1]->key[k*kbytes] );
+
+                    // branch nodes testing lower bits than b are complete and become the left subtree of the new branch node
+                    while ( !stack.empty() && stack.back()->b < b )
+                    {
+                        link_child(stack.back(), 1, c, k);
+                        c = stack.back();
+                        stack.pop_back();
+
+                        if ( order_stats_ )
+                        {
+                            set_count(c, k);
+                        }
+                    }
+
+                    // allocate new branch node from free list
+                    bna = pop_bnode(k);
+
+                    bna->b = b;
+                    link_child(bna, 0, c, k);
+                    stack.push_back(bna);
+
+                    c = (BNODE *)dnodeps[i+1];
+                }
+
+                while ( !stack.empty() )
+                {
+                    link_child(stack.back(), 1, c, k);
+                    c = stack.back();
+                    stack.pop_back();
+
+                    if ( order_stats_ )
+                    {
+                        set_count(c, k);
+                    }
+                }
+
+                // link the built trie and the root impossible key data node under a branch node testing the extra prefix
+                // byte bit - the same branch node insert() creates with the first data node inserted
+                bna = pop_bnode(k);
+
+                bna->b = max_key_bytes_*8;
+                link_child(bna, 0, c, k);
+                link_child(bna, 1, (BNODE *)&rdx_.dnodes[0], k);
+                link_child(rdx_.head[k], 0, bna, k);
+
+                if ( order_stats_ )
+                {
+                    set_count(bna, k);
+                }
+
+                return 0;
+            }  // bulk_link()
+
+            // build every key index trie from the allocated data nodes dnodeps - in parallel threads if more than one key.
+            // identical keys of key index k are listed by order[k*(max_rdx_nodes_+1)+nsn] when order is not NULL, else in
+            // dnodeps order.  1 if any key is duplicated within a unique key index - the trie is then returned to its empty
+            // state.
+            // used by: bulk_load(), load(), copy_dnodes()
+                int
+            bulk_link_all
+                (
+                    vector<DNODE *> &dnodeps,
+                    const unsigned int *order = NULL
+                )
+            {
+                vector<int> return_codes(num_keys_, 0);  // bulk_link() return code for each key index
+
+
+                if ( num_keys_ == 1 )
+                {
+                    return_codes[0] = bulk_link(0, dnodeps, order);
+                }
+                else
+                {
+                    vector<std::thread> threads;
+
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        const unsigned int *ko = ( order != NULL ) ? &order[(size_t)k*(max_rdx_nodes_+1)] : NULL;
+
+                        threads.push_back( std::thread( [this, k, ko, &dnodeps, &return_codes]()
+                                                        {
+                                                            return_codes[k] = bulk_link(k, dnodeps, ko);
+                                                        } ) );
+                    }
+
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        threads[k].join();
+                    }
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    if ( return_codes[k] != 0 )
+                    {
+                        // duplicate key - return the trie to its empty state
+                        initialize();
+                        return 1;
+                    }
+                }
+
+                return 0;
+            }  // bulk_link_all()
+
+            // set order[k*(max_rdx_nodes_+1)+nsn], for each non-unique key index k, to the position of data node nsn in its
+            // list of data nodes with the same key index k key - 0 for the data node linked into the trie.  every other
+            // entry is 0.  each list is walked once from the data node linked into the trie.
+            // used by: dump(), chg_max_rdx_nodes(), merge_tries()
+                void
+            list_order
+                (
+                    vector<unsigned int> &order
+                ) const
+            {
+                order.assign( (size_t)num_keys_*(max_rdx_nodes_+1), 0 );
+
+                for ( int k = 0 ; num_nonunique_ != 0 && k < num_keys_ ; k++ )
+                {
+                    if ( !nonunique_[k] )
+                    {
+                        continue;
+                    }
+
+                    for ( unsigned int n = 1 ; n < dfresh_ ; n++ )
+                    {
+                        const DNODE *r = &rdx_.dnodes[n];  // the data node linked into the trie
+
+                        if ( r->alloc == 1 && r->p[k] != NULL )
+                        {
+                            unsigned int i = 0;
+
+                            for ( const DNODE *d = r ; i == 0 || d != r ; d = d->nx[k] )
+                            {
+                                order[(size_t)k*(max_rdx_nodes_+1) + d->nsn] = i++;
+                            }
+                        }
+                    }
+                }
+            }  // list_order()
+
+            // allocate a data node of this empty trie for each data node srcs[i], of this or another trie of the same
+            // NUM_KEYS and MAX_KEY_BYTES, copy its keys and copy construct its app_data, then build the key index tries
+            // with bulk_link_all().  identical keys of a non-unique key index k are listed by rank[i*num_keys_+k].
+            // dnodeps[i] is the copy of srcs[i].  1 if any key is duplicated within a unique key index - the trie is then
+            // left empty.
+            // used by: chg_max_rdx_nodes(), merge_tries()
+                int
+            copy_dnodes
+                (
+                    const vector<const DNODE *> &srcs,
+                    const vector<unsigned int> &rank,
+                    vector<DNODE *> &dnodeps
+                )
+            {
+                const int kbytes = 1+max_key_bytes_;  // key bytes including the extra prefix byte
+
+                vector<unsigned int> order;  // rank of data node nsn in key index k by k*(max_rdx_nodes_+1)+nsn
+
+
+                if ( srcs.empty() )
+                {
+                    return 0;
+                }
+
+                if ( num_nonunique_ != 0 )
+                {
+                    order.assign( (size_t)num_keys_*(max_rdx_nodes_+1), 0 );
+                }
+
+                dnodeps.reserve( srcs.size() );
+                for ( size_t i = 0 ; i < srcs.size() ; i++ )
+                {
+                    construct_data( rdx_.dfree_head, srcs[i]->data );
+
+                    DNODE *dna = pop_dnode();
+
+                    // the keys with their extra prefix byte
+                    memmove( &dna->key[0], &srcs[i]->key[0], (size_t)num_keys_*kbytes );
+
+                    dna->alloc = 1;
+                    if ( evict_ )
+                    {
+                        clock_ref_[dna->nsn] = 1;
+                    }
+
+                    for ( int k = 0 ; num_nonunique_ != 0 && k < num_keys_ ; k++ )
+                    {
+                        order[(size_t)k*(max_rdx_nodes_+1) + dna->nsn] = rank[i*num_keys_+k];
+                    }
+
+                    dnodeps.push_back(dna);
+                }
+                rdx_.alloc_nodes = srcs.size();
+
+                return bulk_link_all( dnodeps, order.empty() ? NULL : order.data() );
+            }  // copy_dnodes()
+
+            // call visit(d, NULL)(in_a true) or visit(NULL, d)(in_a false) for every data node d of the key index k
+            // subtree headed by node c of trie t in key order.  return !0 if visit() stopped the walk.
+            // used by: diff_subtrees()
+                template <typename visitor>
+                static int
+            diff_walk
+                (
+                    MKRdxPat<app_data, allocator> *t,
+                    BNODE *c,
+                    const int k,
+                    const bool in_a,
+                    visitor &visit
+                )
+            {
+                DNODE *end = t->next_dnode(c, k);  // the data node following the subtree or NULL
+
+
+                for ( DNODE *d = t->leftmost_dnode(c) ; d != end ; d = t->next_in_order(d, k) )
+                {
+                    if ( visit( in_a ? d : NULL, in_a ? NULL : d ) != 0 )
+                    {
+                        return 1;
+                    }
+                }
+
+                return 0;
+            }  // diff_walk()
+
+            // call visit(da, db) for the data nodes with the same key index k key - da of trie a and db of trie b.  the
+            // lists of data nodes sharing the key in a non-unique key index are paired in list order and the data nodes
+            // left over in the longer list are visited with NULL for the other.  return !0 if visit() stopped the walk.
+            // used by: diff_subtrees()
+                template <typename visitor>
+                static int
+            diff_lists
+                (
+                    MKRdxPat<app_data, allocator> *a,
+                    DNODE *da,
+                    MKRdxPat<app_data, allocator> *b,
+                    DNODE *db,
+                    const int k,
+                    visitor &visit
+                )
+            {
+                while ( da != NULL || db != NULL )
+                {
+                    if ( visit(da, db) != 0 )
+                    {
+                        return 1;
+                    }
+
+                    da = ( da != NULL && a->nonunique_[k] && da->nx[k]->p[k] == NULL ) ? da->nx[k] : NULL;
+                    db = ( db != NULL && b->nonunique_[k] && db->nx[k]->p[k] == NULL ) ? db->nx[k] : NULL;
+                }
+
+                return 0;
+            }  // diff_lists()
+
+            // walk the key index k subtree headed by node x of trie a and the one headed by node y of trie b in lockstep
+            // and call visit(da, db) in key order for the data nodes only in a(db NULL), only in b(da NULL) or in both.
+            // a subtree covers the keys sharing all the bits above its branch bit(-1 for a data node).  one key of each
+            // subtree gives the first bit the subtrees differ at - above both branch bits the subtrees are disjoint and
+            // each is walked whole with no key compares, otherwise the subtree with the lower branch bit lies within one
+            // child of the other and only that child is descended with it.  return !0 if visit() stopped the walk.
+            // used by: diff(), set_union(), set_intersection()
+                template <typename visitor>
+                static int
+            diff_subtrees
+                (
+                    MKRdxPat<app_data, allocator> *a,
+                    BNODE *x,
+                    MKRdxPat<app_data, allocator> *b,
+                    BNODE *y,
+                    const int k,
+                    visitor &visit
+                )
+            {
+                const int kbytes = 1+a->max_key_bytes_;  // key bytes including the key boolean/extra prefix byte
+
+                int bx = ( x->id == 0 ) ? (int)x->b : -1;  // branch bit of x
+                int by = ( y->id == 0 ) ? (int)y->b : -1;  // branch bit of y
+                unsigned char *kx = &a->leftmost_dnode(x)->key[k*kbytes];  // a key of subtree x
+                unsigned char *ky = &b->leftmost_dnode(y)->key[k*kbytes];  // a key of subtree y
+                int d = ( memcmp( kx, ky, kbytes ) == 0 ) ? -1 : (int)a->diff_bit( kx, ky );  // first differing bit
+
+
+                if ( d > bx && d > by )
+                {
+                    if ( a->gbit( kx, d ) == 0 )
+                    {
+                        return ( diff_walk(a, x, k, true, visit) != 0 || diff_walk(b, y, k, false, visit) != 0 );
+                    }
+
+                    return ( diff_walk(b, y, k, false, visit) != 0 || diff_walk(a, x, k, true, visit) != 0 );
+                }
+
+                if ( bx == by )
+                {
+                    if ( bx < 0 )
+                    {
+                        return diff_lists(a, (DNODE *)x, b, (DNODE *)y, k, visit);
+                    }
+
+                    return ( diff_subtrees(a, (BNODE *)(x->l), b, (BNODE *)(y->l), k, visit) != 0 ||
+                             diff_subtrees(a, (BNODE *)(x->r), b, (BNODE *)(y->r), k, visit) != 0 );
+                }
+
+                if ( bx > by )
+                {
+                    if ( a->gbit( ky, bx ) == 0 )
+                    {
+                        return ( diff_subtrees(a, (BNODE *)(x->l), b, y, k, visit) != 0 ||
+                                 diff_walk(a, (BNODE *)(x->r), k, true, visit) != 0 );
+                    }
+
+                    return ( diff_walk(a, (BNODE *)(x->l), k, true, visit) != 0 ||
+                             diff_subtrees(a, (BNODE *)(x->r), b, y, k, visit) != 0 );
+                }
+
+                if ( b->gbit( kx, by ) == 0 )
+                {
+                    return ( diff_subtrees(a, x, b, (BNODE *)(y->l), k, visit) != 0 ||
+                             diff_walk(b, (BNODE *)(y->r), k, false, visit) != 0 );
+                }
+
+                return ( diff_walk(b, (BNODE *)(y->l), k, false, visit) != 0 ||
+                         diff_subtrees(a, x, b, (BNODE *)(y->r), k, visit) != 0 );
+            }  // diff_subtrees()
+
+            // walk key index k of tries a and b with diff_subtrees() - an empty trie has all the data nodes of the other
+            // visited.  return !0 if visit() stopped the walk.
+            // used by: diff(), set_union(), set_intersection()
+                template <typename visitor>
+                static int
+            diff_tries
+                (
+                    MKRdxPat<app_data, allocator> *a,
+                    MKRdxPat<app_data, allocator> *b,
+                    const int k,
+                    visitor &visit
+                )
+            {
+                // the top branch node tests the extra prefix byte - its left subtree holds every key
+                BNODE *x = ( a->rdx_.alloc_nodes == 0 ) ? NULL : (BNODE *)(((BNODE *)(a->rdx_.head[k]->l))->l);
+                BNODE *y = ( b->rdx_.alloc_nodes == 0 ) ? NULL : (BNODE *)(((BNODE *)(b->rdx_.head[k]->l))->l);
+
+
+                if ( x == NULL && y == NULL )
+                {
+                    return 0;
+                }
+
+                if ( x == NULL )
+                {
+                    return diff_walk(b, y, k, false, visit);
+                }
+
+                if ( y == NULL )
+                {
+                    return diff_walk(a, x, k, true, visit);
+                }
+
+                return diff_subtrees(a, x, b, y, k, visit);
+            }  // diff_tries()
+
+            // return a new trie of new_max_rdx_nodes data nodes built from copies of the data nodes diff_tries() visits in
+            // key index k of tries a and b - all of them(intersect false) or only those with the key in both(intersect
+            // true).  a data node in both tries is copied from trie a.  identical keys of a non-unique key index are listed
+            // in the order of trie a and then of trie b.  NULL if two of the data nodes have the same key in a unique key
+            // index.
+            // used by: set_union(), set_intersection()
+                static MKRdxPat<app_data, allocator> *
+            merge_tries
+                (
+                    MKRdxPat<app_data, allocator> *a,
+                    MKRdxPat<app_data, allocator> *b,
+                    const int k,
+                    const int new_max_rdx_nodes,
+                    const bool intersect
+                )
+            {
+                vector<const DNODE *> srcs;    // the data nodes copied
+                vector<unsigned int> order_a;  // list_order() of trie a
+                vector<unsigned int> order_b;  // list_order() of trie b
+                vector<unsigned int> rank;     // rank[i*NUM_KEYS+j] - the list position of srcs[i] in key index j
+                vector<DNODE *> dnodeps;       // the copies of srcs in the new trie
+                MKRdxPat<app_data, allocator> *rdx;
+
+
+                a->list_order(order_a);
+                b->list_order(order_b);
+
+                auto visit = [&](DNODE *da, DNODE *db) -> int
+                {
+                    if ( intersect && (da == NULL || db == NULL) )
+                    {
+                        return 0;
+                    }
+
+                    srcs.push_back( ( da != NULL ) ? da : db );
+
+                    // the data nodes of trie b are listed after those of trie a
+                    for ( int j = 0 ; j < a->num_keys_ ; j++ )
+                    {
+                        rank.push_back( ( da != NULL ) ? order_a[(size_t)j*(a->max_rdx_nodes_+1) + da->nsn] :
+                                                         a->max_rdx_nodes_+1 + order_b[(size_t)j*(b->max_rdx_nodes_+1) + db->nsn] );
+                    }
+
+                    return 0;
+                };
+
+                diff_tries(a, b, k, visit);
+
+                rdx = new MKRdxPat<app_data, allocator>(new_max_rdx_nodes, a->num_keys_, a->max_key_bytes_, a->options(),
+                                                        a->nonunique_, a->alloc_);
+                if ( rdx->copy_dnodes(srcs, rank, dnodeps) != 0 )
+                {
+                    delete rdx;
+                    return NULL;
+                }
+
+                return rdx;
+            }  // merge_tries()
+
+            #if MKRDXPAT_SNAPSHOT
+            // add d bytes to link p unless it is NULL
+            // used by: relocate()
+                template <typename T>
+                static void
+            relocate_link
+                (
+                    T *&p,
+                    const ptrdiff_t d
+                )
+            {
+                if ( p != NULL )
+                {
+                    p = (T *)( (uintptr_t)p + d );
+                }
+            }  // relocate_link()
+
+            // add d bytes to every link of the trie - the full trie storage image of a snapshot is mapped d bytes from the
+            // address it was saved from.  the DNODE pointers into the full trie storage are set by layout_storage().
+            // used by: MKRdxPat() of map()
+                void
+            relocate
+                (
+                    const ptrdiff_t d
+                )
+            {
+                relocate_link( rdx_.dfree_head, d );
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    relocate_link( rdx_.head[k], d );
+                    relocate_link( rdx_.bfree_head[k], d );
+                }
+
+                for ( int n = 0 ; n < (max_rdx_nodes_+1) * num_keys_ ; n++ )
+                {
+                    relocate_link( rdx_.bnodes[n].p, d );
+                    relocate_link( rdx_.bnodes[n].l, d );
+                    relocate_link( rdx_.bnodes[n].r, d );
+                }
+
+                for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                {
+                    relocate_link( rdx_.dnodes[n].nnfp, d );
+
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        relocate_link( rdx_.dnodes[n].p[k], d );
+
+                        if ( num_nonunique_ != 0 )
+                        {
+                            relocate_link( rdx_.dnodes[n].nx[k], d );
+                            relocate_link( rdx_.dnodes[n].pv[k], d );
+                        }
+                    }
+                }
+            }  // relocate()
+            #endif
+
+            // the 64 bit FNV-1a hash of the n bytes at p continued from hash h - the snapshot and dump checksum
+            // used by: save(), map(), dump(), load()
+                static unsigned long long
+            snapshot_sum
+                (
+                    const unsigned char *p,
+                    const size_t n,
+                    unsigned long long h = 0xcbf29ce484222325ULL
+                )
+            {
+                for ( size_t i = 0 ; i < n ; i++ )
+                {
+                    h = (h ^ p[i]) * 0x100000001b3ULL;
+                }
+
+                return h;
+            }  // snapshot_sum()
+
+            #if MKRDXPAT_SNAPSHOT
+            // write the n bytes at p to file descriptor fd at offset off.  false if any write fails.
+            // used by: save()
+                static bool
+            write_all
+                (
+                    const int fd,
+                    const unsigned char *p,
+                    size_t n,
+                    off_t off
+                )
+            {
+                while ( n > 0 )
+                {
+                    ssize_t w = pwrite( fd, p, n, off );
+                    if ( w <= 0 )
+                    {
+                        return false;
+                    }
+
+                    p += w;
+                    n -= w;
+                    off += w;
+                }
+
+                return true;
+            }  // write_all()
+            #endif
+
+            // store v at p as 8 bytes, least significant first
+            // used by: dump()
+                static void
+            put_le64
+                (
+                    unsigned char *p,
+                    unsigned long long v
+                )
+            {
+                for ( int i = 0 ; i < 8 ; i++ )
+                {
+                    p[i] = (unsigned char)( v >> (8*i) );
+                }
+            }  // put_le64()
+
+            // the 8 bytes at p, least significant first
+            // used by: load()
+                static unsigned long long
+            get_le64
+                (
+                    const unsigned char *p
+                )
+            {
+                unsigned long long v = 0;
+
+
+                for ( int i = 7 ; i >= 0 ; i-- )
+                {
+                    v = (v << 8) | p[i];
+                }
+
+                return v;
+            }  // get_le64()
+
+            // store v at p as 4 bytes, least significant first
+            // used by: dump()
+                static void
+            put_le32
+                (
+                    unsigned char *p,
+                    unsigned int v
+                )
+            {
+                for ( int i = 0 ; i < 4 ; i++ )
+                {
+                    p[i] = (unsigned char)( v >> (8*i) );
+                }
+            }  // put_le32()
+
+            // the 4 bytes at p, least significant first
+            // used by: load()
+                static unsigned int
+            get_le32
+                (
+                    const unsigned char *p
+                )
+            {
+                unsigned int v = 0;
+
+
+                for ( int i = 3 ; i >= 0 ; i-- )
+                {
+                    v = (v << 8) | p[i];
+                }
+
+                return v;
+            }  // get_le32()
+
+            #if MKRDXPAT_SNAPSHOT
+            // the trie of a snapshot with header h whose full trie storage image is mapped at image, lead bytes into its
+            // first page.  throws as MKRdxPat() if the header sizes or node counts are out of range or do not give the
+            // image size.
+            // used by: map()
+            MKRdxPat( const SNAPSHOT &h, unsigned char *image, const size_t lead )
+                : max_rdx_nodes_(h.max_rdx_nodes), num_keys_(h.num_keys), max_key_bytes_(h.max_key_bytes),
+                  order_stats_(h.order_stats != 0), expiry_(h.expiry != 0), evict_(h.evict != 0), locality_(h.locality != 0),
+                  alloc_(allocator())
+            {
+                check_sizes();
+
+                num_nonunique_ = h.num_nonunique;
+                if ( num_nonunique_ < 0 || num_nonunique_ > num_keys_ )
+                {
+                    throw "MKRdxPat.hpp: snapshot num_nonunique out of range";
+                }
+
+                size_storage();
+                if ( rdx_.bsize != h.bsize )
+                {
+                    throw "MKRdxPat.hpp: snapshot image size does not match its header";
+                }
+
+                free_ptr_ = (void *)image;
+                map_bytes_ = lead + rdx_.bsize;
+
+                // the links in the image need no fix up if it is mapped at the address it was saved from
+                const ptrdiff_t d = (ptrdiff_t)( (uintptr_t)image - (uintptr_t)h.base );
+
+                layout_storage( image, d != 0 );
+
+                // the watermarks and the free data node list head index the image - out of range, a corrupt header
+                // would send insert() or the clock outside it
+                if ( h.dfresh == 0 || h.dfresh > (unsigned int)max_rdx_nodes_+1 || h.alloc_nodes >= h.dfresh ||
+                     h.clock_hand > (unsigned int)max_rdx_nodes_ )
+                {
+                    throw "MKRdxPat.hpp: snapshot node counts out of range";
+                }
+
+                if ( h.dfree_head != 0 )
+                {
+                    // the saved address of the data nodes array and the free list head offset from it
+                    const uintptr_t dbase = (uintptr_t)rdx_.dnodes - (uintptr_t)d;
+                    const unsigned long long off = h.dfree_head - (unsigned long long)dbase;
+
+                    if ( dbase > h.dfree_head || off % sizeof(DNODE) != 0 || off / sizeof(DNODE) == 0 ||
+                         off / sizeof(DNODE) > (unsigned long long)max_rdx_nodes_ )
+                    {
+                        throw "MKRdxPat.hpp: snapshot free data node list head out of range";
+                    }
+                }
+
+                rdx_.dfree_head = (DNODE *)(uintptr_t)h.dfree_head;
+                if ( d != 0 )
+                {
+                    relocate( d );
+                }
+
+                rdx_.alloc_nodes = h.alloc_nodes;
+                rdx_.app_data_ptrs_cnt = 0;
+                dfresh_ = h.dfresh;
+                wheel_time_ = h.wheel_time;
+                clock_hand_ = h.clock_hand;
+            }  // MKRdxPat()
+            #endif
+
+        public:
+
+            //
+            // iterators
+            //
+
+            // a data node handle - the data node sequence number(1 - MAX_RDX_NODES) or 0 for no data node.  a handle is
+            // returned by insert() and search() and gives data(), remove(), keys() and rekey() the data node with no
+            // search at all.  it stays valid while its data node is in the trie - after remove() the number is reused
+            // by a later insert().
+            typedef unsigned int node_handle;
+
+            // in-order iterator over the data nodes of one key index - iterator steps in key ascending order and
+            // reverse_iterator in key descending order.  an iterator holds only the trie, the key index and the current
+            // data node.  each step follows the branch/data node parent pointers, thus, no memory is allocated and
+            // reading m data nodes costs m steps however large the trie.  an iterator is invalidated by remove() of its
+            // data node, by bulk_load() and by chg_max_rdx_nodes().  see begin(), end(), rbegin() and rend().
+            template <bool reverse> class dnode_iterator
+            {
+                public:
+                    typedef std::forward_iterator_tag iterator_category;
+                    typedef app_data value_type;
+                    typedef std::ptrdiff_t difference_type;
+                    typedef app_data *pointer;
+                    typedef app_data &reference;
+
+                    dnode_iterator() : rdxp_(NULL), k_(0), dnodep_(NULL)
+                    {
+                    }
+
+                        app_data &
+                    operator*
+                        (
+                        ) const
+                    {
+                        return dnodep_->data;
+                    }
+
+                        app_data *
+                    operator->
+                        (
+                        ) const
+                    {
+                        return &dnodep_->data;
+                    }
+
+                    // the key index k key bytes(MAX_KEY_BYTES bytes - no key boolean) of the current data node
+                        const unsigned char *
+                    key
+                        (
+                        ) const
+                    {
+                        return &dnodep_->key[k_*(1+rdxp_->max_key_bytes_)+1];
+                    }
+
+                    // the handle of the current data node
+                        node_handle
+                    handle
+                        (
+                        ) const
+                    {
+                        return dnodep_->nsn;
+                    }
+
+                        dnode_iterator &
+                    operator++
+                        (
+                        )
+                    {
+                        dnodep_ = reverse ? rdxp_->prev_in_order(dnodep_, k_) : rdxp_->next_in_order(dnodep_, k_);
+                        return *this;
+                    }
+
+                        dnode_iterator
+                    operator++
+                        (
+                            int
+                        )
+                    {
+                        dnode_iterator it = *this;
+                        ++*this;
+                        return it;
+                    }
+
+                        bool
+                    operator==
+                        (
+                            const dnode_iterator &it
+                        ) const
+                    {
+                        return dnodep_ == it.dnodep_;
+                    }
+
+                        bool
+                    operator!=
+                        (
+                            const dnode_iterator &it
+                        ) const
+                    {
+                        return dnodep_ != it.dnodep_;
+                    }
+
+                private:
+                    friend class MKRdxPat;
+
+                    dnode_iterator( MKRdxPat *rdxp, int k, DNODE *dnodep ) : rdxp_(rdxp), k_(k), dnodep_(dnodep)
+                    {
+                    }
+
+                    MKRdxPat *rdxp_;  // trie iterated over
+                    int k_;           // key index(0 - NUM_KEYS-1)
+                    DNODE *dnodep_;   // current data node - NULL at end
+            };
+
+            typedef dnode_iterator<false> iterator;
+            typedef dnode_iterator<true> reverse_iterator;
+
+
+            MKRdxPat( int mnrn, int nk, int nkb, unsigned int op = 0, const unsigned char *nu = NULL, const allocator &al = allocator() )
+                : max_rdx_nodes_(mnrn), num_keys_(nk), max_key_bytes_(nkb), order_stats_((op & RDX_ORDER_STATS) != 0),
+                  expiry_((op & RDX_EXPIRY) != 0), evict_((op & RDX_EVICT) != 0), locality_((op & RDX_LOCALITY) != 0), alloc_(al)
+            {
+                unsigned char *fptr;  // pointer to rdx data structure calloc()'ed memory - freed in destructor
+
+
+                if ( (op & ~(unsigned int)(RDX_ORDER_STATS | RDX_EXPIRY | RDX_EVICT | RDX_LOCALITY)) != 0 )
+                {
+                    throw "MKRdxPat.hpp: options not RDX_ORDER_STATS, RDX_EXPIRY, RDX_EVICT or RDX_LOCALITY";
+                }
+
+                check_sizes();
+
+                // count the non-unique key indices
+                num_nonunique_ = 0;
+                for ( int k = 0 ; nu != NULL && k < num_keys_ ; k++ )
+                {
+                    if ( nu[k] == 1 )
+                    {
+                        num_nonunique_++;
+                    }
+                    else if ( nu[k] != 0 )
+                    {
+                        throw "MKRdxPat.hpp: nonunique[k] not 0 or 1";
+                    }
+                }
+
+                size_storage();
+
+                // exception object for throw()'ing calloc() error
+                class MKRdxPatConstructorExc: public std::exception
+                {
+                    virtual const char* what() const throw()
+                    {
+                        return "MKRdxPat MKRdxPat() calloc() failure.";
+                    }
+                } MKRdxPatConstructorExc;
+
+                fptr = arena_alloc( rdx_.bsize );
+                if ( fptr == NULL )
+                {
+                    throw MKRdxPatConstructorExc;
+                }
+
+                free_ptr_ = (void *)fptr;
+                map_bytes_ = 0;
+
+
+                layout_storage( fptr, true );
+
+                if ( nu != NULL )
+                {
+                    memmove( nonunique_, nu, num_keys_ );
+                }
+
+                wheel_time_ = 0;
+                clock_hand_ = 0;
+
+                initialize();
+            }  // MKRdxPat()
+
+
+            ~MKRdxPat()
+            {
+                // destroy the app_data of the allocated and removed data nodes
+                for ( int n = 1 ; !std::is_trivially_destructible<app_data>::value && n < max_rdx_nodes_+1 ; n++ )
+                {
+                    destroy_data( &rdx_.dnodes[n] );
+                }
+
+                #if MKRDXPAT_SNAPSHOT
+                if ( map_bytes_ != 0 )
+                {
+                    munmap( (unsigned char *)free_ptr_ - (map_bytes_ - rdx_.bsize), map_bytes_ );
+                    return;
+                }
+                #endif
+
+                arena_free( (unsigned char *)free_ptr_, rdx_.bsize );
+            }  // ~MKRdxPat()
+
+            /*
+             *======================================================================================================================
+             *     insert()
+             *
+             * Purpose: 
+             *     remove a data node from the free list in the PNODE_ data structure and insert this node into the trie with keys
+             *     key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte for all keys(key[k][0]) is the key boolean.
+             *     the key boolean should always be set to 1 since all keys are needed for insertion.  the actual key bytes
+             *     (key[k][1 to MAX_KEY_BYTES]) follow the key boolean.  each key must be unique within it's key
+             *     index(0 to NUM_KEYS-1).
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     int return_code;
+             *
+             *     return_code = rdx->insert((unsigned char *)key, &app_datap);
+             *
+             * Returns:
+             *     1. int return_code = 0, app_data *app_datap - if insertion is successful
+             *     2. int return_code = 1, app_data *app_datap - if any key is found to already exist
+             *     3. int return_code = 2, app_data *NULL - if no data nodes are on the free list and the object was not
+             *                                              constructed with RDX_EVICT
+             *     4. int return_code = 3, app_data *NULL - if any key boolean is not 1
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     app_data **app_datapp                              - pointer to pointer to the inserted data node app_data struct
+             *                                                          or NULL if insertion fails
+             *
+             * Comments:
+             *     1. each key index is descended once.  the data node the descent ends at is the duplicate check and the
+             *        new branch node is linked by climbing its parent pointers to the first branch node testing a higher
+             *        bit than the first bit the keys differ at.
+             *     2. a key need not be unique in a key index declared non-unique(constructor NONUNIQUE[k] = 1).  a data node
+             *        whose key already exists in that index is added to the end of the list of data nodes sharing the key.
+             *     3. with constructor option RDX_EVICT an insert() into a full trie first removes a data node not recently
+             *        used and reuses it - a CLOCK hand sweeps the data nodes clearing the one byte reference bit that
+             *        insert(), search(), search_hint(), upsert() and data() set, and evicts the first data node whose bit is
+             *        already clear.  the app_data of the evicted data node is lost - copy anything needed out of it before
+             *        relying on a full trie to make room.
+             *     4. with constructor option RDX_LOCALITY each new branch node is the free branch node nearest in
+             *        storage to the branch node it is linked under - searched within 256 nodes either side in a bitmap of
+             *        the free branch nodes - rather than the one most recently freed.  after many removes and inserts the
+             *        branch nodes a search descends through stay close together in memory.  the free lists are then doubly
+             *        linked and the bitmap costs one bit per branch node.
+             */
+
+                int
+            insert
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    app_data **app_datapp
+                )
+            {
+                return insert_dnode(key, app_datapp, NULL);
+            }  // insert()
+
+            /*
+             *======================================================================================================================
+             *     insert()
+             *
+             * Purpose:
+             *     insert() as above and also return the handle of the data node.  the handle gives data(), remove(), keys()
+             *     and rekey() the data node with no search.
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     MKRdxPat<app_data>::node_handle handle;
+             *     int return_code;
+             *
+             *     return_code = rdx->insert((unsigned char *)key, &app_datap, &handle);
+             *
+             * Returns:
+             *     1. int return_code = 0 to 3, app_data *app_datap - as insert() above
+             *     2. node_handle handle - the handle of the inserted data node(return_code = 0) or of the data node with the
+             *                             key found to already exist(return_code = 1), 0 otherwise
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     app_data **app_datapp                              - pointer to pointer to the inserted data node app_data struct
+             *                                                          or NULL if insertion fails
+             *     node_handle *handle                                - pointer to the data node handle
+             *
+             * Comments:
+             */
+
+                int
+            insert
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    app_data **app_datapp,
+                    node_handle *handle
+                )
+            {
+                int return_code = insert(key, app_datapp);
+
+                *handle = ( *app_datapp == NULL ) ? 0 : dnode_handle(*app_datapp);
+
+                return return_code;
+            }  // insert()
+
+            /*
+             *======================================================================================================================
+             *     insert_hint()
+             *
+             * Purpose:
+             *     insert() starting the search of each key index from the data node with handle hint rather than from the
+             *     top of the trie, and return the handle of the data node in hint for the next call.  the search climbs the
+             *     parent pointers from the hint data node to the deepest branch node that is on the search path of the new
+             *     key and descends from there, so a stream of nearly sequential keys(e.g. a sorted routing table or a log
+             *     replay) visits only the few branch nodes near the previous key instead of descending the whole trie for
+             *     each key.
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     MKRdxPat<app_data>::node_handle hint = 0;
+             *     int return_code;
+             *
+             *     return_code = rdx->insert_hint((unsigned char *)key, &app_datap, &hint);
+             *
+             * Returns:
+             *     1. int return_code = 0 to 3, app_data *app_datap - as insert()
+             *     2. node_handle hint - the handle of the inserted data node(return_code = 0) or of the data node with the
+             *                           key found to already exist(return_code = 1), unchanged otherwise
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     app_data **app_datapp                              - pointer to pointer to the inserted data node app_data struct
+             *                                                          or NULL if insertion fails
+             *     node_handle *hint                                  - pointer to the handle of the data node to start the
+             *                                                          search from - a handle from any earlier call or 0 to
+             *                                                          start from the top of the trie
+             *
+             * Comments:
+             *     1. a hint that is no longer the handle of a data node in the trie is ignored.  any data node in the trie
+             *        is a correct hint - a distant one only costs more parent pointer steps than a plain insert().
+             */
+
+                int
+            insert_hint
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    app_data **app_datapp,
+                    node_handle *hint
+                )
+            {
+                int return_code = insert_dnode(key, app_datapp, handle_dnode(*hint));
+
+                if ( *app_datapp != NULL )
+                {
+                    *hint = dnode_handle(*app_datapp);
+                }
+
+                return return_code;
+            }  // insert_hint()
+
+            /*
+             *======================================================================================================================
+             *     emplace()
+             *
+             * Purpose:
+             *     insert() and construct the app_data of the new data node in place from args - any app_data constructor -
+             *     with no temporary app_data copied or moved into the trie.  an app_data with std::string or std::vector
+             *     members is kept in the data node itself.
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         app_data(int i, const char *s) : id(i), name(s) {}
+             *
+             *         int id;
+             *         std::string name;
+             *     }
+             *
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     int return_code;
+             *
+             *     return_code = rdx->emplace((unsigned char *)key, &app_datap, 1, "name");
+             *
+             * Returns:
+             *     1. int return_code = 0 to 3, app_data *app_datap - as insert()
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     app_data **app_datapp                              - pointer to pointer to the inserted data node app_data struct
+             *                                                          or NULL if insertion fails
+             *     Args&&... args                                     - the app_data constructor arguments
+             *
+             * Comments:
+             *     1. args are only used if the data node is inserted(return_code 0).  if the app_data constructor throws the
+             *        exception is passed on and the data node is not inserted - a data node evicted to make room(constructor
+             *        option RDX_EVICT) stays removed.
+             *
+             *     2. insert(), insert_hint() and upsert() default construct the app_data of a new data node and bulk_load()
+             *        copy constructs it.  the app_data of a removed data node is destroyed when the data node is reused or
+             *        the trie is deleted.
+             */
+
+                template <typename... Args>
+                int
+            emplace
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    app_data **app_datapp,
+                    Args&&... args
+                )
+            {
+                return insert_dnode(key, app_datapp, NULL, std::forward<Args>(args)...);
+            }  // emplace()
+
+            /*
+             *======================================================================================================================
+             *     upsert()
+             *
+             * Purpose: 
+             *     return the data node with keys key[NUM_KEYS][1+MAX_KEY_BYTES] if it is already in the trie, otherwise remove
+             *     a data node from the free list and insert it into the trie with these keys.  each key index is descended
+             *     once - the data node the descent ends at is both the duplicate check and the starting point of the link
+             *     of the new data node - so an upsert costs the same as a search() whether or not the data node existed.
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     bool inserted;
+             *     int return_code;
+             *
+             *     return_code = rdx->upsert((unsigned char *)key, &app_datap, &inserted);
+             *
+             * Returns:
+             *     1. int return_code = 0, app_data *app_datap, bool inserted = true - if the data node is inserted
+             *     2. int return_code = 0, app_data *app_datap, bool inserted = false - if all keys are found in the same
+             *                                                                           data node
+             *     3. int return_code = 1, app_data *app_datap, bool inserted = false - if some keys are found but not all of
+             *                                                                           them in the same data node -
+             *                                                                           app_datap is the data node of the
+             *                                                                           first key found
+             *     4. int return_code = 2, app_data *NULL, bool inserted = false - if no data nodes are on the free list and
+             *                                                                      the object was not constructed with
+             *                                                                      RDX_EVICT
+             *     5. int return_code = 3, app_data *NULL, bool inserted = false - if any key boolean is not 1
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     app_data **app_datapp                              - pointer to pointer to the found or inserted data node
+             *                                                          app_data struct or NULL if the upsert fails
+             *     bool *inserted                                     - pointer to true if the data node is inserted, false
+             *                                                          otherwise
+             *
+             * Comments:
+             *     1. the app_data of an inserted data node is not initialized.  when inserted is true set it as after an
+             *        insert(), otherwise update it in place.
+             *     2. with RDX_EVICT a full trie evicts as in insert() and a data node found with all the keys is marked
+             *        referenced as in search().
+             */
+
+                int
+            upsert
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    app_data **app_datapp,
+                    bool *inserted
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // BNODE **insert_c_;          // BNODE *insert_c_[num_keys_];
+                // unsigned char *insert_ky_;  // unsigned char insert_ky_[num_keys_][1+max_key_bytes_];
+
+                DNODE *dna;           // data node address assigned from the free queue head
+                DNODE *found = NULL;  // data node of the first key found
+                int nfound = 0;       // number of keys found in data node found
+
+
+                *inserted = false;
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // for upsert all key booleans must be 1
+                    if ( key[k*(1+max_key_bytes_)+0] != 1 )
+                    {
+                        *app_datapp = NULL;
+                        return 3;
+                    }
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // copy key to storage with extra byte for comparison
+                    insert_ky_[k*(1+max_key_bytes_)+0] = 0;
+                    memmove( &insert_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+
+                    // search for key in rdx trie - the data node reached is kept for the link if the key is not found
+                    insert_c_[k] = (BNODE *)(rdx_.head[k]->l);
+                    while ( insert_c_[k]->id == 0 )
+                    {
+                        insert_c_[k] = ( gbit( &insert_ky_[k*(1+max_key_bytes_)], insert_c_[k]->b ) ) ? (BNODE *)(insert_c_[k]->r) : (BNODE *)(insert_c_[k]->l);
+                    }
+
+                    // a non-unique key index only selects among the data nodes found with the other keys
+                    if ( nonunique_[k] )
+                    {
+                        continue;
+                    }
+
+                    if ( memcmp( &insert_ky_[k*(1+max_key_bytes_)], &((DNODE *)insert_c_[k])->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) == 0 )
+                    {
+                        if ( found == NULL )
+                        {
+                            found = (DNODE *)insert_c_[k];
+                        }
+
+                        if ( (DNODE *)insert_c_[k] == found )
+                        {
+                            nfound++;
+                        }
+                        else
+                        {
+                            *app_datapp = &( found->data );
+                            return 1;  // two keys found in different data nodes
+                        }
+                    }
+                }
+
+                if ( found != NULL )
+                {
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        if ( nonunique_[k] &&
+                             memcmp( &insert_ky_[k*(1+max_key_bytes_)], &found->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) == 0 )
+                        {
+                            nfound++;
+                        }
+                    }
+
+                    if ( evict_ && nfound == num_keys_ )
+                    {
+                        clock_ref_[found->nsn] = 1;  // referenced - see evict_dnode()
+                    }
+
+                    *app_datapp = &( found->data );
+                    return ( nfound == num_keys_ ) ? 0 : 1;
+                }
+
+                // with only non-unique key indices the data node with all the keys may be on the key index 0 list
+                if ( num_nonunique_ == num_keys_ && (found = nonunique_dnode(key, insert_ky_, NULL)) != NULL )
+                {
+                    if ( evict_ )
+                    {
+                        clock_ref_[found->nsn] = 1;  // referenced - see evict_dnode()
+                    }
+
+                    *app_datapp = &( found->data );
+                    return 0;
+                }
+
+                if ( evict_ && rdx_.dfree_head == NULL )
+                {
+                    // full trie - evict a data node not recently used.  the data node the search ended at may be the one
+                    // evicted, thus, each key index is searched again from the top.
+                    evict_dnode();
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        insert_c_[k] = descend( k, &insert_ky_[k*(1+max_key_bytes_)], NULL );
+                    }
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // if no nodes free set app_datapp to NULL and return 2
+                    if ( rdx_.bfree_head[k] == NULL || rdx_.dfree_head == NULL )
+                    {
+                        *app_datapp = NULL;
+                        return 2;
+                    }
+                }
+
+                construct_data( rdx_.dfree_head );
+
+                dna = pop_dnode();
+                rdx_.alloc_nodes++;
+
+                if ( evict_ )
+                {
+                    clock_ref_[dna->nsn] = 1;
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // set child key and link it below the data node the search ended at or, in a non-unique key index
+                    // that has the key, add it to the list of data nodes with the key
+                    memmove( &(dna->key[k*(1+max_key_bytes_)]), &insert_ky_[k*(1+max_key_bytes_)], max_key_bytes_+1 );
+                    if ( nonunique_[k] &&
+                         memcmp( &insert_ky_[k*(1+max_key_bytes_)], &((DNODE *)insert_c_[k])->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) == 0 )
+                    {
+                        append_dnode(dna, k, (DNODE *)insert_c_[k]);
+                        if ( order_stats_ )
+                        {
+                            add_count( ((DNODE *)insert_c_[k])->p[k], k, 1 );
+                        }
+                    }
+                    else
+                    {
+                        link_dnode(dna, k, insert_c_[k]);
+                    }
+                }
+
+                // set node to allocated status
+                dna->alloc = 1;
+
+                *app_datapp = &( dna->data );
+                *inserted = true;
+
+                return 0;
+            }  // upsert()
+
+            /*
+             *======================================================================================================================
+             *     insert_batch()
+             *
+             * Purpose:
+             *     insert() n data nodes with the keys key[n][NUM_KEYS][1+MAX_KEY_BYTES].  the items are applied in key index
+             *     0 key order rather than array order so that consecutive insertions descend the same upper trie branch
+             *     nodes while they are still in cache, and the keys of the item BATCH_PREFETCH items ahead are prefetched.
+             *
+             * Usage:
+             *     unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap[n];
+             *     int return_code[n];
+             *     int ninserted;
+             *
+             *     ninserted = rdx->insert_batch((unsigned char *)key, n, app_datap, return_code);
+             *
+             * Returns:
+             *     1. int ninserted = the number of data nodes inserted(return_code[i] = 0)
+             *     2. int ninserted = -1 - if n < 0
+             *     3. int return_code[i], app_data *app_datap[i] - the insert() return code and app_data pointer of item i
+             *
+             * Parameters:
+             *     const unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES] - n items of NUM_KEYS keys - one byte key boolean and
+             *                                                             MAX_KEY_BYTES key bytes
+             *     const int n                                           - number of items
+             *     app_data *app_datap[n]                                - the insert() app_data pointer of each item
+             *     int return_code[n]                                    - the insert() return code of each item
+             *
+             * Comments:
+             *     1. since the items are inserted in key index 0 order, if the free list runs out it is the items with the
+             *        highest key index 0 keys that get return_code 2.  of items with the same keys the first in the array is
+             *        inserted and the rest get return_code 1.
+             */
+
+                int
+            insert_batch
+                (
+                    const unsigned char *key,  // unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES]
+                    const int n,
+                    app_data **app_datapp,     // app_data *app_datapp[n]
+                    int *return_code           // int return_code[n]
+                )
+            {
+                const size_t item_bytes = num_keys_*(1+max_key_bytes_);  // bytes in one item of key[]
+
+                std::vector<int> order;  // the items in key index 0 order
+                int ninserted = 0;
+
+
+                if ( n < 0 )
+                {
+                    return -1;
+                }
+
+                batch_order(key, n, order);
+
+                for ( int i = 0 ; i < n ; i++ )
+                {
+                    if ( i+BATCH_PREFETCH < n )
+                    {
+                        __builtin_prefetch( &key[order[i+BATCH_PREFETCH]*item_bytes] );
+                    }
+
+                    int j = order[i];
+                    return_code[j] = insert( &key[j*item_bytes], &app_datapp[j] );
+                    if ( return_code[j] == 0 )
+                    {
+                        ninserted++;
+                    }
+                }
+
+                return ninserted;
+            }  // insert_batch()
+
+            /*
+             *======================================================================================================================
+             *     search()
+             *
+             * Purpose: 
+             *     search trie for the data node with the keys key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte
+             *     for all keys(key[k][0]) is the key boolean.  the key boolean should be set to 1(use the key) or
+             *     0(do not use key).  the actual key bytes(key[k][1 to max_key_bytes_]) follow the key boolean.  thus, 1 to
+             *     num_keys_ keys may be used in any given search.  only one key is necessary to find the data node.  each key
+             *     must be unique within it's key index(0 - NUM_KEYS-1).
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *
+             *     app_datap = rdx->search((unsigned char *)key);
+             *
+             * Returns:
+             *     1. app_data *app_datap - if search is successful
+             *     2. app_data *NULL - if any key boolean is not 0 or 1
+             *     3. app_data *NULL - if two key searches end at different data nodes
+             *     4. app_data *NULL - if any key search does not end at a data node
+             *     5. app_data *NULL - if no key boolean is 1 then no keys are used
+             *    
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *
+             * Comments:
+             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
+             *
+             *          example 1:
+             *          in key[][]:
+             *             key number  key
+             *             0           01 aa bb cc dd    
+             *             1           01 ee ee ee ee
+             *             2           01 ff ff ff ff
+             *
+             *             use all three keys(0,1,2) in the search
+             *
+             *          example 2:
+             *          in key[][]:
+             *             0           00 aa bb cc dd
+             *             1           01 ee ee ee ee
+             *             2           00 ff ff ff ff
+             *
+             *             use only key 1 in the search
+             *
+             *          example 3:
+             *          in key[][]:
+             *             0           01 00 00 00 01
+             *             1           01 00 00 00 01
+             *             2           01 00 00 00 01
+             *
+             *             inserted successfuly - a. all key booleans 1  b. each key unique in it's own key index(0 - 2)
+             *
+             *     note: a key in a non-unique key index(constructor NONUNIQUE[k] = 1) may be the key of many data nodes.  the data
+             *     node returned is the first one in key index order matching all the keys used.  equal_range() lists all of them.
+             *
+             *     note: with constructor option RDX_EVICT a data node found is marked referenced and is passed over by the next
+             *     sweep of the insert() CLOCK hand.
+             */
+
+                app_data *
+            search
+                (
+                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // BNODE *search_c_;           // BNODE *search_c_[num_keys_];
+                // unsigned char *search_ky_;  // unsigned char search_ky_[num_keys_][1+max_key_bytes_];
+
+                BNODE *csav = NULL;  // save first key data node address and make sure all key searches end at the same data node
+
+                bool firsttime = true;  // every search() call
+
+
+                int n = 0;  // sum of key booleans that are 1 - must be >=1
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    #if DEBUG_S
+                    debug("DEBUG_S: k = %d\n", k);
+                    #endif
+
+                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
+                    {
+                        continue;  // if key boolean is 0 skip key
+                    }
+                    else if ( key[k*(1+max_key_bytes_)+0] == 1 )
+                    {
+                        n++;  // if key boolean is 1 use key
+                    }
+                    else
+                    {
+                        return NULL;  // if a key boolean is not 0 or 1
+                    }
+
+                    // copy key to storage with extra byte for comparison
+                    search_ky_[k*(1+max_key_bytes_)+0] = 0;
+                    memmove( &search_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+
+                    // a non-unique key index only selects among the data nodes found with the other keys
+                    if ( nonunique_[k] )
+                    {
+                        continue;
+                    }
+
+                    // search for key in rdx trie
+                    search_c_ = (BNODE *)(rdx_.head[k]->l);
+                    while ( search_c_->id == 0 )
+                    {
+                        search_c_ = ( gbit( &search_ky_[k*(1+max_key_bytes_)+0], search_c_->b ) ) ? (BNODE *)(search_c_->r) : (BNODE *)(search_c_->l);
+                    }
+
+                    #if DEBUG_S
+                    debug("DEBUG_S: search_c_ = %p \n", (void *)search_c_ );
+                    debug("DEBUG_S: ((DNODE *)search_c_)->key = %p \n", (void *)((DNODE *)search_c_)->key );
+                    #endif
+
+                    // check if all keys end at the same data node - if not return NULL
+                    if ( firsttime == true )
+                    {
+                        csav = search_c_;
+                        firsttime = false;
+                    }
+                    else
+                    {
+                        if ( search_c_ != csav )
+                        {
+                            return NULL;  // a key does not end at the same data node as a previous key
+                        }
+                    }
+
+                    #if DEBUG_S
+                    debug("%s", "\n");
+                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    {
+                        printf("%X ", *(&search_ky_[k*(1+max_key_bytes_)+0]+i) );
+                    }
+                    printf("\n");
+
+                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    {
+                        printf("DEBUG_S: %p\n",  (void *)(&((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i) );
+                        printf("DEBUG_S: %X\n", *( &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i ) );
+                    }
+                    printf("\n");
+
+                    printf("DEBUG_S: dna = %p\n", (void *)(DNODE *)search_c_ );
+                    #endif
+
+                    // if key not found return NULL
+                    if ( memcmp( &search_ky_[k*(1+max_key_bytes_)+0], &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) != 0 )
+                    {
+                        #if DEBUG_S
+                        debug("%s", "DEBUG_S: k = exit2\n");
+                        #endif
+
+                        return NULL;  // key not found
+                    }
+                }
+
+                if ( n == 0 )
+                {
+                    #if DEBUG_S
+                    debug("%s", "DEBUG_S: k = exit3\n");
+                    #endif
+
+                    return NULL;  // no keys are used(all key booleans are 0)
+                }
+
+                if ( num_nonunique_ != 0 && (search_c_ = (BNODE *)nonunique_dnode(key, search_ky_, (DNODE *)csav)) == NULL )
+                {
+                    return NULL;  // a non-unique key index key is not found
+                }
+
+                if ( evict_ )
+                {
+                    clock_ref_[((DNODE *)search_c_)->nsn] = 1;  // referenced - see evict_dnode()
+                }
+
+                // success - all keys found in the same data node - return app_datap pointer
+                return &( ((DNODE *)(search_c_))->data );
+            }  // search()
+
+            /*
+             *======================================================================================================================
+             *     search()
+             *
+             * Purpose:
+             *     search() as above and also return the handle of the data node found.
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     MKRdxPat<app_data>::node_handle handle;
+             *
+             *     app_datap = rdx->search((unsigned char *)key, &handle);
+             *
+             * Returns:
+             *     1. app_data *app_datap - as search() above
+             *     2. node_handle handle - the handle of the data node found, 0 if app_datap is NULL
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     node_handle *handle                                - pointer to the data node handle
+             *
+             * Comments:
+             */
+
+                app_data *
+            search
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    node_handle *handle
+                )
+            {
+                app_data *app_datap = search(key);
+
+                *handle = ( app_datap == NULL ) ? 0 : dnode_handle(app_datap);
+
+                return app_datap;
+            }  // search()
+
+            /*
+             *======================================================================================================================
+             *     search_hint()
+             *
+             * Purpose:
+             *     search() starting the search of each key index from the data node with handle hint rather than from the
+             *     top of the trie, and return the handle of the data node found in hint for the next call.  see
+             *     insert_hint().
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     MKRdxPat<app_data>::node_handle hint = 0;
+             *
+             *     app_datap = rdx->search_hint((unsigned char *)key, &hint);
+             *
+             * Returns:
+             *     1. app_data *app_datap - as search()
+             *     2. node_handle hint - the handle of the data node found, unchanged if app_datap is NULL
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     node_handle *hint                                  - pointer to the handle of the data node to start the
+             *                                                          search from - a handle from any earlier call or 0 to
+             *                                                          start from the top of the trie
+             *
+             * Comments:
+             *     1. a hint that is no longer the handle of a data node in the trie is ignored.
+             */
+
+                app_data *
+            search_hint
+                (
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    node_handle *hint
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // BNODE *search_c_;           // BNODE *search_c_[num_keys_];
+                // unsigned char *search_ky_;  // unsigned char search_ky_[num_keys_][1+max_key_bytes_];
+
+                DNODE *h = handle_dnode(*hint);  // hint data node or NULL
+                BNODE *csav = NULL;              // first key data node - all key searches must end at the same data node
+                int n = 0;                       // sum of key booleans that are 1 - must be >=1
+
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
+                    {
+                        continue;  // if key boolean is 0 skip key
+                    }
+                    else if ( key[k*(1+max_key_bytes_)+0] == 1 )
+                    {
+                        n++;  // if key boolean is 1 use key
+                    }
+                    else
+                    {
+                        return NULL;  // if a key boolean is not 0 or 1
+                    }
+
+                    // copy key to storage with extra byte for comparison
+                    search_ky_[k*(1+max_key_bytes_)+0] = 0;
+                    memmove( &search_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+
+                    // a non-unique key index only selects among the data nodes found with the other keys
+                    if ( nonunique_[k] )
+                    {
+                        continue;
+                    }
+
+                    search_c_ = descend( k, &search_ky_[k*(1+max_key_bytes_)], h );
+
+                    if ( csav == NULL )
+                    {
+                        csav = search_c_;
+                    }
+                    else if ( search_c_ != csav )
+                    {
+                        return NULL;  // a key does not end at the same data node as a previous key
+                    }
+
+                    // if key not found return NULL
+                    if ( memcmp( &search_ky_[k*(1+max_key_bytes_)+0], &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) != 0 )
+                    {
+                        return NULL;  // key not found
+                    }
+                }
+
+                if ( n == 0 )
+                {
+                    return NULL;  // no keys are used(all key booleans are 0)
+                }
+
+                if ( num_nonunique_ != 0 && (csav = (BNODE *)nonunique_dnode(key, search_ky_, (DNODE *)csav)) == NULL )
+                {
+                    return NULL;  // a non-unique key index key is not found
+                }
+
+                *hint = ((DNODE *)csav)->nsn;
+
+                if ( evict_ )
+                {
+                    clock_ref_[*hint] = 1;  // referenced - see evict_dnode()
+                }
+
+                return &( ((DNODE *)csav)->data );
+            }  // search_hint()
+
+            /*
+             *======================================================================================================================
+             *     data()
+             *
+             * Purpose:
+             *     return the app_data of the data node with handle handle.  no key index is searched.
+             *
+             * Usage:
+             *     MKRdxPat<app_data>::node_handle handle;
+             *     app_data *app_datap;
+             *
+             *     app_datap = rdx->data(handle);
+             *
+             * Returns:
+             *     1. app_data *app_datap - if handle is the handle of a data node in the trie
+             *     2. app_data *NULL - if not
+             *
+             * Parameters:
+             *     const node_handle handle - data node handle from insert(), search() or an iterator
+             *
+             * Comments:
+             */
+
+                app_data *
+            data
+                (
+                    const node_handle handle
+                )
+            {
+                DNODE *d = handle_dnode(handle);
+
+                if ( d == NULL )
+                {
+                    return NULL;
+                }
+
+                if ( evict_ )
+                {
+                    clock_ref_[handle] = 1;  // referenced - see evict_dnode()
+                }
+
+                return &d->data;
+            }  // data()
+
+            /*
+             *======================================================================================================================
+             *     remove()
+             *
+             * Purpose: 
+             *     remove trie data node with the keys key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte for all
+             *     keys(key[k][0]) is the key boolean.  the key boolean should be set to 1(use the key) or 0(do not use key).
+             *     the actual key bytes(key[k][1 to MAX_KEY_BYTES]) follow the key boolean.  thus, 1 to NUM_KEYS keys may be used
+             *     for any given remove.  only one key is necessary to remove the data node.  each key must be unique within it's
+             *     key index(0 - NUM_KEYS-1).
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *
+             *     app_datap = rdx->remove((unsigned char *)key);
+             *
+             * Returns:
+             *     1. app_data *app_datap - if search is successful
+             *     2. app_data *NULL - if any key boolean is not 0 or 1
+             *     3. app_data *NULL - if two key searches end at different data nodes
+             *     4. app_data *NULL - if any key search does not end at a data node
+             *     5. app_data *NULL - if no key boolean is 1 then no keys are used
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *
+             * Comments:
+             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
+             *
+             *          example 1:
+             *          in key[][]:
+             *             key number  key
+             *             0           01 aa bb cc dd    
+             *             1           01 ee ee ee ee
+             *             2           01 ff ff ff ff
+             *
+             *             use all three keys(0,1,2) in the search
+             *
+             *          example 2:
+             *          in key[][]:
+             *             0           00 aa bb cc dd
+             *             1           01 ee ee ee ee
+             *             2           00 ff ff ff ff
+             *
+             *             use only one key(1) in the search
+             *
+             *     note: the data node removed for keys only in non-unique key indices is the first data node in key index order
+             *     with those keys.  equal_range() lists all of them.
+             *
+             *     note: the app_data returned is not destroyed until the data node is reused by an insert() or the trie is
+             *     deleted - read or move from it before then.
+             */
+
+                app_data *
+            remove
+                (
+                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // BNODE *remove_c_;           // BNODE *remove_c_[num_keys_];
+                // unsigned char *remove_ky_;  // unsigned char remove_ky_[num_keys_][1+max_key_bytes_];
+
+                BNODE *csav = NULL;  // save first key data node address and make sure all key searches end at the same data node
+
+                bool firsttime = true;  // every remove() call
+
+
+                int n = 0;  // sum of key booleans that are 1 - must be >=1
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    #if DEBUG_R
+                    debug("DEBUG_R: key boolean = %X\n", key[k*(1+max_key_bytes_)+0]);
+                    #endif
+
+                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
+                    {
+                        continue;
+                    }
+                    else if ( key[k*(1+max_key_bytes_)+0] == 1 )
+                    {
+                        n++;  // if key boolean is 1 use key
+                    }
+                    else
+                    {
+                        #if DEBUG_R
+                        debug("%s", "DEBUG_R: k = exit0\n");
+                        #endif
+
+                        return NULL;  // if a key boolean is not 0 or 1
+                    }
+
+                    #if DEBUG_R
+                    debug("DEBUG_R: k = %d\n", k);
+                    printf("DEBUG_R: max_rdx_nodes_ = %d\n", max_rdx_nodes_);
+                    printf("DEBUG_R: num_keys_ = %d\n", num_keys_);
+                    printf("DEBUG_R: max_key_bytes_ = %d\n", max_key_bytes_);
+                    #endif
+
+
+                    // copy key to storage with extra byte for comparison
+                    remove_ky_[k*(1+max_key_bytes_)+0] = 0;
+                    memmove( &remove_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+
+                    // a non-unique key index only selects among the data nodes found with the other keys
+                    if ( nonunique_[k] )
+                    {
+                        continue;
+                    }
+
+                    // search for key in rdx trie
+                    remove_c_ = (BNODE *)(rdx_.head[k]->l);
+                    while ( remove_c_->id == 0 )
+                    {
+                        remove_c_ = ( gbit( &remove_ky_[k*(1+max_key_bytes_)+0], remove_c_->b ) ) ? (BNODE *)(remove_c_->r) : (BNODE *)(remove_c_->l);
+                    }
+
+                    // check if all keys end at the same data node - if not return NULL
+                    if ( firsttime == true )
+                    {
+                        csav = remove_c_;
+                        firsttime = false;
+                    }
+                    else
+                    {
+                        if ( remove_c_ != csav )
+                        {
+                            return NULL;  // a key does not end at the same data node as a previous key
+                        }
+                    }
+
+                    #if DEBUG_R
+                    debug("%s", "\n");
+                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    {
+                        printf("DEBUG_R: %X ", *(&remove_ky_[k*(1+max_key_bytes_)+0]+i) );
+                    }
+                    printf("\n");
+
+                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    {
+                        printf("DEBUG_R: %p\n",  (void *)(&((DNODE *)remove_c_)->key[k*(1+max_key_bytes_)]+i) );
+                        printf("DEBUG_R: %X\n", *( &((DNODE *)remove_c_)->key[k*(1+max_key_bytes_)]+i ) );
+                    }
+                    printf("\n");
+                    #endif
+
+                    // if key not found return NULL
+                    if ( memcmp( &remove_ky_[k*(1+max_key_bytes_)+0], &((DNODE *)remove_c_)->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) != 0 )
+                    {
+                        return NULL;  // key not found
+                    }
+                }
+
+                if ( n == 0 )
+                {
+                    #if DEBUG_R
+                    debug("%s", "DEBUG_R: k = exit3\n");
+                    #endif
+
+                    return NULL;  // no keys are used(all key booleans are 0)
+                }
+
+                if ( num_nonunique_ != 0 && (remove_c_ = (BNODE *)nonunique_dnode(key, remove_ky_, (DNODE *)csav)) == NULL )
+                {
+                    return NULL;  // a non-unique key index key is not found
+                }
+
+                // for each key remove the data node and its parent branch node from the trie and free the data node
+                remove_dnode( (DNODE *)remove_c_ );
+
+                // set return pointer to removed node app_data
+                return &( ((DNODE *)(remove_c_))->data );
+            }  // remove()
+
+            /*
+             *======================================================================================================================
+             *     remove()
+             *
+             * Purpose:
+             *     remove the data node with handle handle.  the data node and its parent branch nodes are unlinked from every
+             *     key index trie with the data node parent pointers - no key index is searched.
+             *
+             * Usage:
+             *     MKRdxPat<app_data>::node_handle handle;
+             *     app_data *app_datap;
+             *
+             *     app_datap = rdx->remove(handle);
+             *
+             * Returns:
+             *     1. app_data *app_datap - if handle is the handle of a data node in the trie
+             *     2. app_data *NULL - if not
+             *
+             * Parameters:
+             *     const node_handle handle - data node handle from insert(), search() or an iterator
+             *
+             * Comments:
+             *     1. handle is invalid after the remove.
+             *     2. the app_data returned is not destroyed until the data node is reused by an insert() or the trie is
+             *        deleted - read or move from it before then.
+             */
+
+                app_data *
+            remove
+                (
+                    const node_handle handle
+                )
+            {
+                DNODE *d = handle_dnode(handle);
+
+                if ( d == NULL )
+                {
+                    return NULL;
+                }
+
+                // for each key remove the data node and its parent branch node from the trie and free the data node
+                remove_dnode( d );
+
+                return &( d->data );
+            }  // remove()
+
+            /*
+             *======================================================================================================================
+             *     clear()
+             *
+             * Purpose:
+             *     remove all the data nodes from the trie in constant time.  the key index tries are reset to empty and the
+             *     free lists restart at the first node, but no data or branch node is visited - each one is reset only when
+             *     a later insert() takes it off its free list.  clearing a trie of millions of data nodes costs the same as
+             *     clearing an empty one, unlike a remove() per data node or deleting and constructing the object again.
+             *
+             * Usage:
+             *     rdx->clear();
+             *
+             * Returns:
+             *     None
+             *
+             * Parameters:
+             *     None
+             *
+             * Comments:
+             *     1. all handles and iterators are invalid after the clear.
+             *
+             *     2. the app_data of the cleared data nodes is destroyed as after remove() - when the data node is reused or
+             *        the trie is deleted.
+             *
+             *     3. print() and verify() complete the reset of the free nodes first, thus, each of them walks all the
+             *        nodes.
+             */
+
+                void
+            clear
+                (
+                )
+            {
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // the empty trie - the head branch node left child is the root impossible key data node
+                    rdx_.head[k]->l = &rdx_.dnodes[0];
+                    rdx_.head[k]->r = NULL;
+                    rdx_.dnodes[0].p[k] = rdx_.head[k];
+                    rdx_.dnodes[0].br[k] = 0;
+
+                    // the branch node free list is every branch node in subscript order
+                    rdx_.bfree_head[k] = &rdx_.bnodes[1*num_keys_+k];
+                    bfresh_[k] = 1;
+                }
+
+                // the data node free list is every data node in subscript order
+                rdx_.dfree_head = &rdx_.dnodes[1];
+                dfresh_ = 1;
+
+                rdx_.alloc_nodes = 0;
+
+                // empty expiry wheel lists
+                for ( int l = 0 ; expiry_ && l < WHEEL_LISTS ; l++ )
+                {
+                    wheel_nx_[max_rdx_nodes_+1+l] = max_rdx_nodes_+1+l;
+                    wheel_pv_[max_rdx_nodes_+1+l] = max_rdx_nodes_+1+l;
+                }
+
+                clock_hand_ = 0;
+            }  // clear()
+
+            /*
+             *======================================================================================================================
+             *     remove_batch()
+             *
+             * Purpose:
+             *     remove() n data nodes with the keys key[n][NUM_KEYS][1+MAX_KEY_BYTES].  the items are applied in key index
+             *     0 key order rather than array order so that consecutive removals descend the same upper trie branch nodes
+             *     while they are still in cache, and the keys of the item BATCH_PREFETCH items ahead are prefetched.
+             *
+             * Usage:
+             *     unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap[n];
+             *     int nremoved;
+             *
+             *     nremoved = rdx->remove_batch((unsigned char *)key, n, app_datap);
+             *
+             * Returns:
+             *     1. int nremoved = the number of data nodes removed
+             *     2. int nremoved = -1 - if n < 0
+             *     3. app_data *app_datap[i] - the remove() return of item i - the removed data node app_data or NULL
+             *
+             * Parameters:
+             *     const unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES] - n items of NUM_KEYS keys - one byte key boolean and
+             *                                                             MAX_KEY_BYTES key bytes - as in remove()
+             *     const int n                                           - number of items
+             *     app_data *app_datap[n]                                - the remove() return of each item
+             *
+             * Comments:
+             *     1. the items are sorted by the key index 0 key bytes whether or not the key index 0 key boolean is 1.
+             */
+
+                int
+            remove_batch
+                (
+                    const unsigned char *key,  // unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES]
+                    const int n,
+                    app_data **app_datapp      // app_data *app_datapp[n]
+                )
+            {
+                const size_t item_bytes = num_keys_*(1+max_key_bytes_);  // bytes in one item of key[]
+
+                std::vector<int> order;  // the items in key index 0 order
+                int nremoved = 0;
+
+
+                if ( n < 0 )
+                {
+                    return -1;
+                }
+
+                batch_order(key, n, order);
+
+                for ( int i = 0 ; i < n ; i++ )
+                {
+                    if ( i+BATCH_PREFETCH < n )
+                    {
+                        __builtin_prefetch( &key[order[i+BATCH_PREFETCH]*item_bytes] );
+                    }
+
+                    int j = order[i];
+                    app_datapp[j] = remove( &key[j*item_bytes] );
+                    if ( app_datapp[j] != NULL )
+                    {
+                        nremoved++;
+                    }
+                }
+
+                return nremoved;
+            }  // remove_batch()
+
+            /*
+             *======================================================================================================================
+             *     remove_prefix()
+             *
+             * Purpose:
+             *     remove all the data nodes with a key in key index k whose leading prefix_bits bits are the same as the
+             *     leading prefix_bits bits of prefix.  the subtree holding these keys is found with one descent and detached
+             *     from the key index k trie with one splice.  the subtree is then walked once - its branch nodes are returned
+             *     to the free list and each data node is unlinked from the other key index tries with its parent pointers
+             *     and returned to the free list - no search of any key index is needed per data node.
+             *
+             * Usage:
+             *     unsigned char prefix[MAX_KEY_BYTES];
+             *     int prefix_bits;
+             *     int return_code;
+             *
+             *     return_code = rdx->remove_prefix(k, prefix, prefix_bits);
+             *
+             * Returns:
+             *     1. int return_code = n - the number of data nodes removed
+             *     2. int return_code = -1 - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *     3. int return_code = -2 - if prefix_bits is out of range(0 - MAX_KEY_BYTES*8)
+             *
+             * Parameters:
+             *     const int k                  - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *prefix  - the leading key bytes(no key boolean) - at least (prefix_bits+7)/8 bytes are
+             *                                    used
+             *     const int prefix_bits        - the number of leading key bits to match(0 - MAX_KEY_BYTES*8).  0 removes
+             *                                    every data node.
+             *
+             * Comments:
+             *     1. the app_data of the removed data nodes is not returned.  use for_each_prefix() first if it is needed.
+             */
 
-            // insert_c_[] is declared as BNODE * but is cast to DNODE * at the end of a search.
-            // this is because all searches go through a series of BNODES and end at a DNODE.
-            // the determination of search termination is made by examining insert_c_[k]->id == 1,
-            // which indicates a data node.  since insert_c_[k] is declared a BNODE * and the id
-            // field is in both node types, then the id field must be at the start of the
-            // typedef and in the same relative position in order to get the correct value.
+                int
+            remove_prefix
+                (
+                    const int k,
+                    const unsigned char *prefix,
+                    const int prefix_bits
+                )
+            {
+                BNODE *c;         // the subtree holding all the keys with the prefix
+                BNODE *p;         // parent branch node of c - removed with the subtree
+                unsigned int br;  // parent branch indicator of c
 
-            BNODE **insert_c_;                 // BNODE *insert_c_[num_keys_];
-            unsigned char *insert_ky_;         // unsigned char insert_ky_[num_keys_][1+max_key_bytes_];
 
+                if ( k < 0 || k > num_keys_-1 )
+                {
+                    return -1;
+                }
 
-            //
-            // variables related to search()
-            //
+                if ( prefix_bits < 0 || prefix_bits > max_key_bytes_*8 )
+                {
+                    return -2;
+                }
 
-            // search_c_[] is declared as BNODE * but is cast to DNODE * at the end of a search.
-            // this is because all searches go through a series of BNODES and end at a DNODE.
-            // the determination of search termination is made by examining search_c_[k]->id == 1,
-            // which indicates a data node.  since search_c_[k] is declared a BNODE * and the id
-            // field is in both node types, then the id field must be at the start of the
-            // typedef and in the same relative position in order to get the correct value.
+                c = prefix_subtree(k, prefix, prefix_bits);
+                if ( c == NULL )
+                {
+                    return 0;
+                }
 
-            BNODE *search_c_;           // BNODE *search_c_[num_keys_];
-            unsigned char *search_ky_;  // unsigned char search_ky_[num_keys_][1+max_key_bytes_];
+                if ( c->id == 1 )
+                {
+                    // a single data node - or the list of data nodes with the same key of a non-unique key index.  each
+                    // data node removed is replaced in the trie by the next data node of the list.
+                    DNODE *d = (DNODE *)c;  // current data node of the list
+                    DNODE *nd;              // next data node of the list - NULL after the last
+                    int n = 0;
 
+                    do
+                    {
+                        nd = ( nonunique_[k] && d->nx[k] != d ) ? d->nx[k] : NULL;
 
-            //
-            // variables related to remove()
-            //
+                        for ( int j = 0 ; j < num_keys_ ; j++ )
+                        {
+                            unlink_dnode( d, j );
+                        }
+                        free_dnode( d );
+                        n++;
 
-            // remove_c_[] is declared as BNODE * but is cast to DNODE * at the end of a search.
-            // this is because all searches go through a series of BNODES and end at a DNODE.
-            // the determination of search termination is made by examining remove_c_[k]->id == 1,
-            // which indicates a data node.  since remove_c_[k] is declared a BNODE * and the id
-            // field is in both node types, then the id field must be at the start of the
-            // typedef and in the same relative position in order to get the correct value.
+                        d = nd;
+                    } while ( d != NULL );
 
-            BNODE *remove_c_;           // BNODE *remove_c_[num_keys_];
-            unsigned char *remove_ky_;  // unsigned char remove_ky_[num_keys_][1+max_key_bytes_];
+                    return n;
+                }
 
+                // splice the subtree and its parent branch node out of the key index k trie - the other child of the
+                // parent branch node takes its place
+                parent(c, k, &p, &br);
+                link_child( (BNODE *)(p->p), p->br, (BNODE *)( (br == 0) ? p->r : p->l ), k );
 
-            //
-            // variables related to print()
-            //
+                if ( order_stats_ )
+                {
+                    add_count( (BNODE *)(p->p), k, -(int)subtree_count(c, k) );
+                }
 
-            unsigned char *print_ky_;  // unsigned char print_ky_[1+max_key_bytes_];
+                push_bnode(p, k);
 
+                return free_subtree(c, k);
+            }  // remove_prefix()
 
-            //
-            // variables related to verify()
-            //
+            /*
+             *======================================================================================================================
+             *     remove_range()
+             *
+             * Purpose:
+             *     remove all the data nodes with a key in key index k in the range lo <= key < hi.  the trie is descended
+             *     once to lo and walked in order to hi.  each data node is unlinked from every key index trie with its parent
+             *     pointers and returned to the free list - no search of any key index is needed per data node.
+             *
+             * Usage:
+             *     unsigned char lo[MAX_KEY_BYTES];
+             *     unsigned char hi[MAX_KEY_BYTES];
+             *     int return_code;
+             *
+             *     return_code = rdx->remove_range(k, lo, hi);
+             *
+             * Returns:
+             *     1. int return_code = n - the number of data nodes removed
+             *     2. int return_code = -1 - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k              - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *lo  - unsigned char lo[MAX_KEY_BYTES] - lowest key in the range(no key boolean)
+             *                                or NULL for no lower bound
+             *     const unsigned char *hi  - unsigned char hi[MAX_KEY_BYTES] - first key above the range(no key boolean)
+             *                                or NULL for no upper bound
+             *
+             * Comments:
+             *     1. the app_data of the removed data nodes is not returned.  use range() first if it is needed.
+             */
 
-            // holds all of the allocated branch node addresses
-            // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
-            unsigned long *verify_bnode_addrs_;       // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
+                int
+            remove_range
+                (
+                    const int k,
+                    const unsigned char *lo,  // unsigned char lo[MAX_KEY_BYTES]
+                    const unsigned char *hi   // unsigned char hi[MAX_KEY_BYTES]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
 
-            // holds all of the unallocated branch node addresses
-            // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
-            unsigned long *verify_free_bnode_addrs_;  // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
+                DNODE *d;    // current data node of the walk
+                DNODE *nd;   // next data node - found before d is unlinked
+                int n = 0;   // number of data nodes removed
 
-            // holds all of the allocated data node addresses
-            // unsigned long dnode_addrs[max_rdx_nodes_+1]; -> dnode_addrs[n]
-            unsigned long *verify_dnode_addrs_;       // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1];
 
-            // holds all of the unallocated data node addresses
-            // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]; -> verify_free_dnode_addrs_[n]
-            unsigned long *verify_free_dnode_addrs_;  // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1];
+                if ( k < 0 || k > num_keys_-1 )
+                {
+                    return -1;
+                }
 
-            // hold all of the allocated data node keys
-            // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]; -> verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
-            unsigned char *verify_dnode_keys_;        // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_];
+                if ( lo == NULL )
+                {
+                    d = begin(k).dnodep_;
+                }
+                else
+                {
+                    // copy key to storage with extra byte for comparison
+                    range_ky_[0] = 0;
+                    memmove( &range_ky_[1], lo, max_key_bytes_ );
 
-            // holds integer indexes(0 to max_rdx_nodes_) of free and allocated nodes
-            // unsigned long verify_node_index_[2][max_rdx_nodes_+1]; -> verify_node_index_[i*(max_rdx_nodes_+1)+n]
-            unsigned long *verify_node_index_;        // unsigned long verify_node_index_[2][max_rdx_nodes_+1];
+                    d = lower_bound_dnode(k, &range_ky_[0]);
+                }
 
+                while ( d != NULL )
+                {
+                    if ( hi != NULL && memcmp( &d->key[k*(1+max_key_bytes_)+1], hi, max_key_bytes_ ) >= 0 )
+                    {
+                        break;
+                    }
 
-            // full trie calloc() free pointer
-            void *free_ptr_;
+                    nd = next_in_order( d, k );
 
-            // primary data structure
-            PNODE_ rdx_;
+                    for ( int j = 0 ; j < num_keys_ ; j++ )
+                    {
+                        unlink_dnode( d, j );
+                    }
+                    free_dnode( d );
+                    n++;
 
+                    d = nd;
+                }
 
-            //
-            // private functions
-            //
+                return n;
+            }  // remove_range()
 
-            // given a key and bit number (bytes numbered 0 from left, bits numbered 0 from right)
-            // will return that bit used by: insert(), search(), remove(), print()
-                inline unsigned int
-            gbit
+            /*
+             *======================================================================================================================
+             *     rekey()
+             *
+             * Purpose:
+             *     change the key index k key of the data node with keys key[NUM_KEYS][1+MAX_KEY_BYTES] to new_key.  the data
+             *     node is unlinked from the key index k trie only and linked again under new_key.  the branch nodes of the
+             *     other key indices and the data node app_data address are not changed.
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     unsigned char new_key[MAX_KEY_BYTES];
+             *     int return_code;
+             *
+             *     return_code = rdx->rekey((unsigned char *)key, k, new_key);
+             *
+             * Returns:
+             *     1. int return_code = 0 - if the key is changed or new_key is already the key index k key of the data node
+             *     2. int return_code = 1 - if the data node is not found - see search() for the key boolean rules
+             *     3. int return_code = 2 - if new_key is already the key index k key of another data node
+             *     4. int return_code = 3 - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key
+             *                                                          bytes - searched for as in search()
+             *     const int k                                        - key index(0 - NUM_KEYS-1) of the key to change
+             *     const unsigned char *new_key                       - unsigned char new_key[MAX_KEY_BYTES] - the new key
+             *                                                          index k key(no key boolean)
+             *
+             * Comments:
+             *     1. app_data pointers returned earlier for the data node remain valid.
+             *     2. return_code 2 is only for a unique key index.  in a non-unique key index the data node is added to the
+             *        end of the list of data nodes with new_key.
+             */
+
+                int
+            rekey
                 (
-                    unsigned char *key,
-                    unsigned int bit_num
+                    const unsigned char *key,     // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    const int k,
+                    const unsigned char *new_key  // unsigned char new_key[MAX_KEY_BYTES]
                 )
             {
-                unsigned int byte;
-                unsigned int bit;
-                unsigned char mask;
+                DNODE *d;  // data node to rekey
 
-                //
-                // the byte index set here assumes one extra prefix byte in the input parameter key(for the
-                // 0xff of the root node impossible key). thus, data nodes with keys of max_key_bytes_ will
-                // have a 0 byte prefix added, and the byte index set here is not 0 to max_key_bytes_-1 but 1
-                // to max_key_bytes_. e.g. if max_key_bytes_ = 1 and bit_num = 0 then byte is set to 1 not 0.
-                // if max_key_bytes_=16 and bit_num=0 then byte is set to 16 not 15.
-                //
-                mask = 1;                              // right most bit set - to be shifted left
-                byte = max_key_bytes_ - (bit_num>>3);  // get byte number(0 from left) that bit is in(from 1 to max_key_bytes_)
-                mask <<= bit_num%8;                    // shift mask bit to position of bit wanted
-                bit = key[byte] & mask;                // keep only bit wanted(0 or 1) - all other bits zero
-                bit >>= bit_num%8;                     // shift wanted bit right to first position in bit variable
 
-                return bit;  // bit should always be 0 or 1
-            }  // gbit()
+                if ( k < 0 || k > num_keys_-1 )
+                {
+                    return 3;
+                }
+
+                if ( (d = search_dnode(key)) == NULL )
+                {
+                    return 1;
+                }
+
+                return rekey_dnode(d, k, new_key);
+            }  // rekey()
+
+            /*
+             *======================================================================================================================
+             *     rekey()
+             *
+             * Purpose:
+             *     rekey() as above for the data node with handle handle - no search is needed to find the data node.
+             *
+             * Usage:
+             *     MKRdxPat<app_data>::node_handle handle;
+             *     unsigned char new_key[MAX_KEY_BYTES];
+             *     int return_code;
+             *
+             *     return_code = rdx->rekey(handle, k, new_key);
+             *
+             * Returns:
+             *     1. int return_code = 0 - if the key is changed or new_key is already the key index k key of the data node
+             *     2. int return_code = 1 - if handle is not the handle of a data node in the trie
+             *     3. int return_code = 2 - if new_key is already the key index k key of another data node
+             *     4. int return_code = 3 - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const node_handle handle     - data node handle from insert(), search() or an iterator
+             *     const int k                  - key index(0 - NUM_KEYS-1) of the key to change
+             *     const unsigned char *new_key - unsigned char new_key[MAX_KEY_BYTES] - the new key index k key(no key
+             *                                    boolean)
+             *
+             * Comments:
+             */
+
+                int
+            rekey
+                (
+                    const node_handle handle,
+                    const int k,
+                    const unsigned char *new_key  // unsigned char new_key[MAX_KEY_BYTES]
+                )
+            {
+                DNODE *d = handle_dnode(handle);
+
+
+                if ( k < 0 || k > num_keys_-1 )
+                {
+                    return 3;
+                }
+
+                if ( d == NULL )
+                {
+                    return 1;
+                }
+
+                return rekey_dnode(d, k, new_key);
+            }  // rekey()
+
+            /*
+             *======================================================================================================================
+             *     sort()
+             *
+             * Purpose: 
+             *     sort pointers to app_data (app_data *app_data_ptrs[max_rdx_nodes_+1]) by key index k in key ascending order
+             *
+             * Usage:
+             *     app_data **app_datapp;
+             *     int k;
+             *     int return_code;
+             *
+             *     return_code = rdx->sort(&app_datapp, k);
+             *
+             * Returns:
+             *     1. int return_code = n, app_data **app_datapp - return the number of sorted nodes and pointer
+             *        set to array of pointers to app_data
+             *     2. int return_code = 0, app_data **NULL - if there are no data nodes(no keys to sort)
+             *     3. int return_code = -1, app_data **NULL - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     app_data ***app_data - pointer to pointer to pointer to app_data
+             *     const int k          - key index(0 - NUM_KEYS-1)
+             *
+             * Comments:
+             *     1. ((app_data *)app_datapp[0 to return_code-1])->(app_data struct fields) - to access app_data data
+             *
+             *     2. sort() walks the whole trie on every call.  to read only some of the data nodes in key order use the
+             *        begin()/end() or rbegin()/rend() iterators.
+             */
+
+                int
+            sort
+                (
+                    app_data ***app_datappp,
+                    const int k
+                )
+            {
+                if ( k < 0 || k > num_keys_-1 )
+                {
+                    *app_datappp = NULL;
+                    return -1;
+                }
+
+                // set full node_ptrs array to 0xf0 - shouldn't affect anything - then 0xf0 pattern
+                // will be in array elements not allocated - makes debugging easier
+                memset( rdx_.app_data_ptrs, 0xf0, (max_rdx_nodes_+1) * sizeof(app_data *) );
+
+                rdx_.app_data_ptrs_cnt = 0;
+
+                recursive( rdx_.head[k], k );
+
+                *app_datappp = rdx_.app_data_ptrs;
+
+                if ( rdx_.app_data_ptrs_cnt-1 == 0 )
+                {
+                    *app_datappp = NULL;
+                }
 
-            // recursive routine to descend rdx_ trie
-            // used by: sort()
-                void
-            recursive
+                return rdx_.app_data_ptrs_cnt-1;
+            }  // sort()
+
+            /*
+             *======================================================================================================================
+             *     keys()
+             *
+             * Purpose: 
+             *     search for a data node with the key[][] argument which are a subset of the full set of keys and fill in
+             *     key[][] with the data node keys which were not used in the search .  set the key boolean to 0 and copy the
+             *     DNODE key to key[][].  for example, if three keys were used in the trie and the data node was found with only
+             *     the first key then fill in key[][] with the second and third keys, leaving the key booleans for these keys
+             *     set to 0.  thus, searching key[][] for key booleans of 0 will give all the keys not used in the original
+             *     search.
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     int return_code;
+             *
+             *     return_code = rdx->keys((unsigned char *)key);
+             *
+             * Returns:
+             *     1. int return_code = 0 - data node found and missing keys filled in
+             *     2. int return_code = 1 - can't find any data node with key[][]
+             *     3. int return_code = 2 - no key[][]'s are missing to copy from DNODE
+             *
+             * Parameters:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *
+             * Comments:
+             */
+
+                int
+            keys
                 (
-                    BNODE *bnode_ptr
+                    unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
                 )
             {
-                // bnode_ptr is NULL only at end of trie traversal
-                if ( bnode_ptr == NULL )
-                {
-                    return;
-                }
+                // pointer to DNODE
+                DNODE *dnodep;
 
-                // if branch node continue down trie.  if data node inc count and store node ptr
-                if ( bnode_ptr->id != 1 )
-                {
-                    recursive( (BNODE *)(bnode_ptr->l) );
-                    recursive( (BNODE *)(bnode_ptr->r) );
-                }
-                else
+                if ( (dnodep = search_dnode(key)) == NULL )
                 {
-                    rdx_.app_data_ptrs[rdx_.app_data_ptrs_cnt++] = &( ((DNODE *)(bnode_ptr))->data );
+                    return 1;  // can't find any data node with key[][]
                 }
-            }  // recursive()
 
-            // used to compare node addresses stored in unsigned longs
-            // used by: verify()
-                static int
-            unsigned_long_compare
-                (
-                    const void *a,
-                    const void *b
-                )
-            {
-                if ( *(unsigned long *)a < *(unsigned long *)b )
+                int missing_keys = 0;
+                for ( int k = 0 ; k < num_keys_ ; k++ )
                 {
-                    return -1;
+                    // copy missing keys from DNODE to key[][]
+                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
+                    {
+                        memmove( &key[k*(1+max_key_bytes_)+1], &(dnodep->key[k*(1+max_key_bytes_)+1]), max_key_bytes_ );
+                        missing_keys++;
+                    }
                 }
-                else if ( *(unsigned long *)a > *(unsigned long *)b )
+
+                if ( missing_keys == 0 )
                 {
-                    return 1;
+                    return 2;  // no key[][]'s are missing to copy from DNODE
                 }
 
                 return 0;
-            }  // unsigned_long_compare()
+            }  // keys()
 
             /*
              *======================================================================================================================
-             *     search_dnode()
+             *     keys()
              *
-             * Purpose: 
-             *     search trie for the data node with the keys key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte
-             *     for all keys(key[k][0]) is the key boolean.  the key boolean should be set to 1(use the key) or
-             *     0(do not use key).  the actual key bytes(key[k][1 to max_key_bytes_]) follow the key boolean.  thus, 1 to
-             *     num_keys_ keys may be used in any given search.  only one key is necessary to find the data node.  each key
-             *     must be unique within it's key index(0 - NUM_KEYS-1).
+             * Purpose:
+             *     copy all the keys of the data node with handle handle to key[][] and set all the key booleans to 1.  no key
+             *     index is searched.
              *
              * Usage:
+             *     MKRdxPat<app_data>::node_handle handle;
              *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
-             *     DNODE *dnodep;
+             *     int return_code;
              *
-             *     dnodep = rdx->search_dnode((unsigned char *)key);
+             *     return_code = rdx->keys(handle, (unsigned char *)key);
              *
              * Returns:
-             *     1. DNODE *dnodep - if search is successful
-             *     2. DNODE *NULL - if any key boolean is not 0 or 1
-             *     3. DNODE *NULL - if two key searches end at different data nodes
-             *     4. DNODE *NULL - if any key search does not end at a data node
-             *     5. DNODE *NULL - if no key boolean is 1 then no keys are used
-             *    
+             *     1. int return_code = 0 - data node found and all keys copied
+             *     2. int return_code = 1 - handle is not the handle of a data node in the trie
+             *
              * Parameters:
-             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     const node_handle handle                     - data node handle from insert(), search() or an iterator
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
              *
              * Comments:
-             *     1. this routine is identical to the search() member function except for the return statement which returns
-             *        a pointer to the data node(DNODE *) instead of a pointer to the application data struct(app_data *).
-             *        it is a private function used for accessing any data values in the DNODE which users should not be able to access.
+             */
+
+                int
+            keys
+                (
+                    const node_handle handle,
+                    unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                )
+            {
+                DNODE *d = handle_dnode(handle);
+
+                if ( d == NULL )
+                {
+                    return 1;
+                }
+
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    key[k*(1+max_key_bytes_)+0] = 1;
+                    memmove( &key[k*(1+max_key_bytes_)+1], &(d->key[k*(1+max_key_bytes_)+1]), max_key_bytes_ );
+                }
+
+                return 0;
+            }  // keys()
+
+            /*
+             *======================================================================================================================
+             *     bulk_load()
              *
-             *     2.
-             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
+             * Purpose:
+             *     load n data nodes into an empty trie in one operation.  the n sets of keys key[n][NUM_KEYS][1+MAX_KEY_BYTES]
+             *     need not be in any order, but keys already in order skip the sort.  for each key index the keys are sorted
+             *     and the trie is built bottom up in linear time from the first differing bits of adjacent sorted keys, instead
+             *     of n insert()s each searching the trie from the root.  the key index tries are built in parallel threads.  the
+             *     key boolean of every key must be 1.
              *
-             *          example 1:
-             *          in key[][]:
-             *             key number  key
-             *             0           01 aa bb cc dd    
-             *             1           01 ee ee ee ee
-             *             2           01 ff ff ff ff
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
              *
-             *             use all three keys(0,1,2) in the search
+             *     unsigned char key[N][NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data data[N];
+             *     int return_code;
              *
-             *          example 2:
-             *          in key[][]:
-             *             0           00 aa bb cc dd
-             *             1           01 ee ee ee ee
-             *             2           00 ff ff ff ff
+             *     return_code = rdx->bulk_load((unsigned char *)key, data, N);
+             *     return_code = rdx->bulk_load((unsigned char *)key, NULL, N);
              *
-             *             use only key 1 in the search
+             * Returns:
+             *     1. int return_code = 0 - if all n data nodes were loaded
+             *     2. int return_code = 1 - if any key is duplicated within a unique key index - the trie is left empty
+             *     3. int return_code = 2 - if n is less than 0 or more than MAX_RDX_NODES
+             *     4. int return_code = 3 - if any key boolean is not 1
+             *     5. int return_code = 4 - if the trie is not empty
              *
-             *          example 3:
-             *          in key[][]:
-             *             0           01 00 00 00 01
-             *             1           01 00 00 00 01
-             *             2           01 00 00 00 01
+             * Parameters:
+             *     const unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES] - n sets of NUM_KEYS keys - one byte key boolean and
+             *                                                             MAX_KEY_BYTES key bytes
+             *     const app_data *data                                  - array of n app_data structs copied to the data
+             *                                                             nodes in the same order as key[][][] or NULL
+             *     const int n                                           - the number of data nodes to load
              *
-             *             inserted successfuly - a. all key booleans 1  b. each key unique in it's own key index(0 - 2)
+             * Comments:
+             *     1. the data nodes are allocated in key[][][] order.  search() for the app_data of any loaded data node.
+             *     2. duplicate keys in a non-unique key index are listed in key[][][] order.
              */
 
-                DNODE *
-            search_dnode
+                int
+            bulk_load
                 (
-                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    const unsigned char *key,  // unsigned char key[n][NUM_KEYS][1+MAX_KEY_BYTES]
+                    const app_data *data,
+                    const int n
                 )
             {
-                //
-                // see private data for definitions
-                //
-                // BNODE *search_c_;           // BNODE *search_c_[num_keys_];
-                // unsigned char *search_ky_;  // unsigned char search_ky_[num_keys_][1+max_key_bytes_];
+                const int kbytes = 1+max_key_bytes_;  // key bytes including the key boolean/extra prefix byte
 
-                BNODE *csav;  // save first key data node address and make sure all key searches end at the same data node
-
-                bool firsttime = true;  // every search() call
+                DNODE *dna;  // data node address assigned from the free queue head
+                vector<DNODE *> dnodeps;  // the allocated data nodes in key[][][] order
 
 
-                int n = 0;  // sum of key booleans that are 1 - must be >=1
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                if ( rdx_.alloc_nodes != 0 )
                 {
-                    #if DEBUG_S
-                    debug("DEBUG_S: k = %d\n", k);
-                    #endif
-
-                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
-                    {
-                        continue;  // if key boolean is 0 skip key
-                    }
-                    else if ( key[k*(1+max_key_bytes_)+0] == 1 )
-                    {
-                        n++;  // if key boolean is 1 use key
-                    }
-                    else
-                    {
-                        return NULL;  // if a key boolean is not 0 or 1
-                    }
-
-                    // copy key to storage with extra byte for comparison
-                    search_ky_[k*(1+max_key_bytes_)+0] = 0;
-                    memmove( &search_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
-
-                    // search for key in rdx trie
-                    search_c_ = (BNODE *)(rdx_.head[k]->l);
-                    while ( search_c_->id == 0 )
-                    {
-                        search_c_ = ( gbit( &search_ky_[k*(1+max_key_bytes_)+0], search_c_->b ) ) ? (BNODE *)(search_c_->r) : (BNODE *)(search_c_->l);
-                    }
+                    return 4;
+                }
 
-                    #if DEBUG_S
-                    debug("DEBUG_S: search_c_ = %p \n", (void *)search_c_ );
-                    debug("DEBUG_S: ((DNODE *)search_c_)->key = %p \n", (void *)((DNODE *)search_c_)->key );
-                    #endif
+                if ( n < 0 || n > max_rdx_nodes_ )
+                {
+                    return 2;
+                }
 
-                    // check if all keys end at the same data node - if not return NULL
-                    if ( firsttime == true )
-                    {
-                        csav = search_c_;
-                        firsttime = false;
-                    }
-                    else
+                for ( int i = 0 ; i < n ; i++ )
+                {
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
                     {
-                        if ( search_c_ != csav )
+                        // for insertion all key booleans must be 1
+                        if ( key[((size_t)i*num_keys_+k)*kbytes+0] != 1 )
                         {
-                            return NULL;  // a key does not end at the same data node as a previous key
+                            return 3;
                         }
                     }
+                }
 
-                    #if DEBUG_S
-                    debug("%s", "\n");
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
-                    {
-                        printf("%X ", *(&search_ky_[k*(1+max_key_bytes_)+0]+i) );
-                    }
-                    printf("\n");
+                if ( n == 0 )
+                {
+                    return 0;
+                }
 
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                // allocate the data nodes and set their keys and app_data
+                dnodeps.reserve(n);
+                for ( int i = 0 ; i < n ; i++ )
+                {
+                    if ( data != NULL )
                     {
-                        printf("DEBUG_S: %p\n",  (void *)(&((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i) );
-                        printf("DEBUG_S: %X\n", *( &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i ) );
+                        construct_data( rdx_.dfree_head, data[i] );
                     }
-                    printf("\n");
-
-                    printf("DEBUG_S: dna = %p\n", (void *)(DNODE *)search_c_ );
-                    #endif
-
-                    // if key not found return NULL
-                    if ( memcmp( &search_ky_[k*(1+max_key_bytes_)+0], &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) != 0 )
+                    else
                     {
-                        #if DEBUG_S
-                        debug("%s", "DEBUG_S: k = exit2\n");
-                        #endif
-
-                        return NULL;  // key not found
+                        construct_data( rdx_.dfree_head );
                     }
-                }
-
-                if ( n == 0 )
-                {
-                    #if DEBUG_S
-                    debug("%s", "DEBUG_S: k = exit3\n");
-                    #endif
 
-                    return NULL;  // no keys are used(all key booleans are 0)
+                    dna = pop_dnode();
+
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        // copy key with extra byte for comparison
+                        dna->key[k*kbytes+0] = 0;
+                        memmove( &dna->key[k*kbytes+1], &key[((size_t)i*num_keys_+k)*kbytes+1], max_key_bytes_ );
+                    }
+
+                    dna->alloc = 1;
+                    if ( evict_ )
+                    {
+                        clock_ref_[dna->nsn] = 1;
+                    }
+                    dnodeps.push_back(dna);
                 }
+                rdx_.alloc_nodes = n;
 
-                // success - all keys found in the same data node - return data node pointer
-                return (DNODE *)(search_c_);
-            }  // search_dnode()
+                return bulk_link_all(dnodeps);
+            }  // bulk_load()
 
             /*
              *======================================================================================================================
-             *     initialize()
+             *     dump()
              *
-             * Purpose: 
-             *     Initialize the defined PNODE_ data structure.  This includes setting the data and branch node sequence
-             *     numbers and data node allocated status(to 0).  Set total allocated nodes to 0, and allocated status of
-             *     root node to 1.  Set the branch node free list up for each key and the data node free list.
+             * Purpose:
+             *     write the data nodes of the trie to stream os in key index 0 order - for each data node its NUM_KEYS keys
+             *     and its app_data - after a header of NUM_KEYS, MAX_KEY_BYTES, the app_data size and the number of data
+             *     nodes.  only the data nodes are written, not the free nodes or the branch nodes, thus, the dump is the
+             *     size of the entries and not of MAX_RDX_NODES.  load() reads it into the trie of another process or host.
              *
              * Usage:
-             *     initialize();
+             *     std::ofstream os("routes.dump", std::ios::binary);
+             *     int return_code;
+             *
+             *     return_code = rdx->dump(os);
              *
              * Returns:
-             *     None
+             *     1. int return_code = n - the number of data nodes written
+             *     2. int return_code = -1 - if writing to os fails
              *
              * Parameters:
-             *     None
+             *     std::ostream &os - the stream written to - opened in binary mode
              *
              * Comments:
-             *     1. remember that the data structure has 1+max_rdx_nodes_ nodes(each of which has one data and
-             *        num_keys_ branch nodes).  the first is the always allocated impossible key root node.  the rest
-             *        are the max_rdx_nodes_ user usable nodes.
+             *     1. the key index 0 trie is walked in key order and the records are written through a 64 KB buffer, thus,
+             *        dump() takes the same memory for any number of data nodes - except that if a key index but 0 is
+             *        non-unique the position of each data node in its list of identical keys is first found, 4 bytes per
+             *        MAX_RDX_NODES per key index.
              *
-             *     2. certain pointers in the root node, such as parent pointers, are set to zero and permanently
-             *        remain so since they have nothing to point to.  in root node printouts they should be zero.
+             *     2. the list order of identical keys in a non-unique key index is kept by load() - key index 0 by the
+             *        record order and any other key index by the record ranks.
+             *
+             *     3. the header fields, the ranks and the checksum are little endian and the keys are bytes on any host.
+             *        app_data must be trivially copyable and is written as its bytes - it is portable between hosts only if
+             *        its layout and byte order are the same on both.
              */
 
-                void
-            initialize
+                int
+            dump
                 (
+                    std::ostream &os
                 )
             {
-                // set data and branch node sequence numbers and node allocated status
-                for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                static_assert( std::is_trivially_copyable<app_data>::value, "MKRdxPat.hpp: dump() needs a trivially copyable app_data" );
+
+                const int kbytes = 1+max_key_bytes_;  // key bytes including the key boolean/extra prefix byte
+
+                bool ranked = false;         // any key index but 0 non-unique
+                vector<unsigned int> order;  // list position of data node nsn in key index k by k*(max_rdx_nodes_+1)+nsn
+                size_t used = 0;             // bytes of buf filled
+                unsigned long long sum = snapshot_sum( NULL, 0 );
+                int n = 0;
+
+
+                for ( int k = 1 ; k < num_keys_ ; k++ )
                 {
-                    for ( int k = 0 ; k < num_keys_ ; k++ )
-                    {
-                        rdx_.bnodes[n*num_keys_+k].nsn = n;
-                    }
+                    ranked = ranked || nonunique_[k];
+                }
 
-                    rdx_.dnodes[n].nsn = n;
-                    rdx_.dnodes[n].alloc = 0;
+                if ( ranked )
+                {
+                    list_order(order);
                 }
-                rdx_.dnodes[0].alloc = 1;  // root impossible key(0xff) node
 
-                // reset total allocated nodes
-                rdx_.alloc_nodes = 0;
+                const size_t rbytes = (size_t)num_keys_*max_key_bytes_ + ( ranked ? (size_t)(num_keys_-1)*4 : 0 ) +
+                                      sizeof(app_data);  // bytes in one record
 
-                // for each key set various branch/data/head fields and pointers
-                for ( int k = 0 ; k < num_keys_ ; k++ )
-                {
-                    // set rdx trie head pointer(s)
-                    rdx_.head[k] = &(rdx_.bnodes[0*num_keys_+k]);
+                vector<unsigned char> buf( ( rbytes > DUMP_BUFFER ) ? rbytes : DUMP_BUFFER );
 
-                    // init head branch node
-                    rdx_.bnodes[0*num_keys_+k].id = 0;
-                    rdx_.bnodes[0*num_keys_+k].br = 0;
-                    rdx_.bnodes[0*num_keys_+k].p = NULL;
-                    rdx_.bnodes[0*num_keys_+k].b = max_key_bytes_*8;
-                    rdx_.bnodes[0*num_keys_+k].l = &rdx_.dnodes[0];
-                    rdx_.bnodes[0*num_keys_+k].r = NULL;
 
-                    // build the branch node free list
-                    rdx_.bfree_head[k] = &(rdx_.bnodes[1*num_keys_+k]);
-                    for ( int n = 1 ; n < max_rdx_nodes_ ; n++ )
+                put_le64( &buf[0*8], DUMP_MAGIC );
+                put_le64( &buf[1*8], DUMP_VERSION );
+                put_le64( &buf[2*8], num_keys_ );
+                put_le64( &buf[3*8], max_key_bytes_ );
+                put_le64( &buf[4*8], sizeof(app_data) );
+                put_le64( &buf[5*8], rdx_.alloc_nodes );
+                put_le64( &buf[6*8], ranked ? 1 : 0 );
+                os.write( (const char *)&buf[0], DUMP_FIELDS*8 );
+
+                for ( iterator it = begin(0) ; it != end(0) ; ++it )
+                {
+                    const DNODE *d = it.dnodep_;
+
+                    if ( used + rbytes > buf.size() )
                     {
-                        rdx_.bnodes[n*num_keys_+k].id = 0;
-                        rdx_.bnodes[n*num_keys_+k].br = 0;
-                        rdx_.bnodes[n*num_keys_+k].p = &rdx_.bnodes[(n+1)*num_keys_+k];
-                        rdx_.bnodes[n*num_keys_+k].b = 0;
-                        rdx_.bnodes[n*num_keys_+k].l = NULL;
-                        rdx_.bnodes[n*num_keys_+k].r = NULL;
+                        sum = snapshot_sum( &buf[0], used, sum );
+                        os.write( (const char *)&buf[0], used );
+                        used = 0;
                     }
-                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].id = 0;
-                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].br = 0;
-                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].p = NULL;
-                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].b = 0;
-                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].l = NULL;
-                    rdx_.bnodes[max_rdx_nodes_*num_keys_+k].r = NULL;
 
-                    // init data node fields
-                    for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
                     {
-                        rdx_.dnodes[n].br[k] = 0;
-                        rdx_.dnodes[n].p[k] = 0;
-                        memset( &rdx_.dnodes[n].key[k*(1+max_key_bytes_)], 0, max_key_bytes_+1 );
+                        memmove( &buf[used], &d->key[k*kbytes+1], max_key_bytes_ );
+                        used += max_key_bytes_;
                     }
+                    for ( int k = 1 ; ranked && k < num_keys_ ; k++ )
+                    {
+                        put_le32( &buf[used], order[(size_t)k*(max_rdx_nodes_+1) + d->nsn] );
+                        used += 4;
+                    }
+                    memmove( &buf[used], &d->data, sizeof(app_data) );
+                    used += sizeof(app_data);
 
-                    // set data node parent pointers of root node to branch nodes for each key
-                    rdx_.dnodes[0].p[k] = &rdx_.bnodes[0*num_keys_+k];
-
-                    // init head data node key to impossible value, (the extra high order 0xff byte).
-                    memset( &rdx_.dnodes[0].key[k*(1+max_key_bytes_)], 0xff, max_key_bytes_+1 );
+                    n++;
                 }
 
-                // build the data node free list - use DNODE nnfp as pointer to next node
-                rdx_.dnodes[0].id = 1;
+                sum = snapshot_sum( &buf[0], used, sum );
+                os.write( (const char *)&buf[0], used );
 
-                rdx_.dfree_head = &rdx_.dnodes[1];
+                put_le64( &buf[0], sum );
+                os.write( (const char *)&buf[0], 8 );
 
-                for ( int n = 1 ; n < max_rdx_nodes_ ; n++ )
-                {
-                    rdx_.dnodes[n].nnfp = (BNODE *)(&rdx_.dnodes[n+1]);
-                    rdx_.dnodes[n].id = 1;
-                }
-                rdx_.dnodes[max_rdx_nodes_].nnfp = NULL;
-                rdx_.dnodes[max_rdx_nodes_].id = 1;
-            }  // initialize()
+                return os.good() ? n : -1;
+            }  // dump()
 
-        public:
-            MKRdxPat( int mnrn, int nk, int nkb ) : max_rdx_nodes_(mnrn), num_keys_(nk), max_key_bytes_(nkb)
+            /*
+             *======================================================================================================================
+             *     load()
+             *
+             * Purpose:
+             *     read a dump() from stream is into an empty trie.  the data nodes are filled as the records are read and the
+             *     key index tries are then built bottom up as bulk_load() builds them - the records are in key index 0
+             *     order, so key index 0 is built with no sort.  identical keys of a non-unique key index are listed in the
+             *     order they were listed in the trie dumped.
+             *
+             * Usage:
+             *     std::ifstream is("routes.dump", std::ios::binary);
+             *     int return_code;
+             *
+             *     return_code = rdx->load(is);
+             *
+             * Returns:
+             *     1. int return_code = 0 - if all the data nodes of the dump were loaded
+             *     2. int return_code = 1 - if any key is duplicated within a unique key index - the trie is left empty
+             *     3. int return_code = 2 - if the dump has more than MAX_RDX_NODES data nodes
+             *     4. int return_code = 4 - if the trie is not empty
+             *     5. int return_code = 5 - if is is not a dump of NUM_KEYS keys of MAX_KEY_BYTES bytes and this app_data
+             *                              size, is cut short or fails the checksum - the trie is left empty
+             *
+             * Parameters:
+             *     std::istream &is - the stream read from - opened in binary mode
+             *
+             * Comments:
+             *     1. the trie need not have been constructed with the same MAX_RDX_NODES, OPTIONS or NONUNIQUE as the trie
+             *        dumped.  no expiry times are loaded.
+             */
+
+                int
+            load
+                (
+                    std::istream &is
+                )
             {
-                unsigned char *fptr;  // pointer to rdx data structure calloc()'ed memory - freed in destructor
+                static_assert( std::is_trivially_copyable<app_data>::value, "MKRdxPat.hpp: load() needs a trivially copyable app_data" );
 
+                const int kbytes = 1+max_key_bytes_;  // key bytes including the key boolean/extra prefix byte
 
-                if ( max_rdx_nodes_ < 1 )
+                unsigned char head[DUMP_FIELDS*8];  // the header fields
+                unsigned long long sum = snapshot_sum( NULL, 0 );
+                vector<DNODE *> dnodeps;     // the allocated data nodes in record order
+                vector<unsigned int> order;  // list position of data node nsn in key index k by k*(max_rdx_nodes_+1)+nsn
+                unsigned long long n;
+                bool ranked;
+
+
+                if ( rdx_.alloc_nodes != 0 )
                 {
-                    throw "MKRdxPat.hpp: max_rdx_nodes_ < 1(must be > 0)";
+                    return 4;
                 }
 
-                if ( num_keys_ < 1 )
+                is.read( (char *)head, DUMP_FIELDS*8 );
+                if ( is.gcount() != DUMP_FIELDS*8 ||
+                     get_le64( &head[0*8] ) != DUMP_MAGIC || get_le64( &head[1*8] ) != DUMP_VERSION ||
+                     get_le64( &head[2*8] ) != (unsigned long long)num_keys_ ||
+                     get_le64( &head[3*8] ) != (unsigned long long)max_key_bytes_ ||
+                     get_le64( &head[4*8] ) != sizeof(app_data) || get_le64( &head[6*8] ) > 1 )
                 {
-                    throw "MKRdxPat.hpp: num_keys_ < 1(must be > 0)";
+                    return 5;
                 }
 
-                if ( max_key_bytes_ < 1 )
+                n = get_le64( &head[5*8] );
+                if ( n > (unsigned long long)max_rdx_nodes_ )
                 {
-                    throw "MKRdxPat.hpp: max_key_bytes_ < 1(must be > 0)";
+                    return 2;
                 }
 
-                rdx_.bsize = 0;  // the size of the trie - everything allocated by calloc()
-
-                //
-                // total calloc() segments =
-                //     5(in PNODE_) +
-                //     ( max_rdx_nodes_+1 ) * 3(in DNODE) +
-                //     6(in insert()) +
-                //     2(in search()) +
-                //     2(in remove()) +
-                //     1(in print()) +
-                //     6(in verify())
-                //
-
-                // 5(in PNODE_)
-                rdx_.bsize += (num_keys_) * sizeof(BNODE *) +                     // BNODE *head[num_keys_]
-                              (max_rdx_nodes_+1) * sizeof(app_data *) +           // app_data *app_data_ptrs[max_rdx_nodes_+1]
-                              ((max_rdx_nodes_+1) * num_keys_) * sizeof(BNODE) +  // BNODE bnodes[max_rdx_nodes_+1][num_keys_]
-                              (num_keys_) * sizeof(BNODE *) +                     // BNODE *bfree_head[num_keys_]
-                              (max_rdx_nodes_+1) * sizeof(DNODE);                 // DNODE dnodes[max_rdx_nodes_+1]
-
-                debug("BNODE *head[num_keys_]  -  (num_keys_) * sizeof(BNODE *) = %lu\n",
-                      (num_keys_) * sizeof(BNODE *));
-                debug("app_data *app_data_ptrs[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(app_data *) = %lu\n",
-                      (max_rdx_nodes_+1) * sizeof(app_data *));
-                debug("BNODE bnodes[max_rdx_nodes_+1][num_keys_]  -  ((max_rdx_nodes_+1) * num_keys_) * sizeof(BNODE) = %lu\n",
-                      ((max_rdx_nodes_+1) * num_keys_) * sizeof(BNODE));
-                debug("BNODE *bfree_head[num_keys_]  -  (num_keys_) * sizeof(BNODE *) = %lu\n",
-                      (num_keys_) * sizeof(BNODE *));
-                debug("DNODE dnodes[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(DNODE) = %lu\n\n",
-                      (max_rdx_nodes_+1) * sizeof(DNODE));
-
-                // ( max_rdx_nodes_+1 ) * 3(in DNODE)
-                rdx_.bsize += (
-                                  (num_keys_) * sizeof(unsigned int) +                      // unsigned int br[num_keys_]
-                                  (num_keys_) * sizeof(BNODE *) +                           // BNODE *p[num_keys_]
-                                  (num_keys_ * (1+max_key_bytes_)) * sizeof(unsigned char)  // unsigned char key[num_keys_][1+max_key_bytes_]
-                              ) * ( max_rdx_nodes_+1 );
-
-                debug("unsigned int br[num_keys_]  -  (num_keys_) * sizeof(unsigned int) * ( max_rdx_nodes_+1 ) = %lu\n",
-                      (num_keys_) * sizeof(unsigned int) * ( max_rdx_nodes_+1 ));
-                debug("BNODE *p[num_keys_]  -  (num_keys_) * sizeof(BNODE *) * ( max_rdx_nodes_+1 ) = %lu\n",
-                      (num_keys_) * sizeof(BNODE *) * ( max_rdx_nodes_+1 ));
-                debug("unsigned char key[num_keys_][1+max_key_bytes_]  -  (num_keys_ * (1+max_key_bytes_)) * sizeof(unsigned char) * ( max_rdx_nodes_+1 ) = %lu\n\n",
-                      (num_keys_ * (1+max_key_bytes_)) * sizeof(unsigned char) * ( max_rdx_nodes_+1 ));
-
-                // 6(in insert())
-                rdx_.bsize += num_keys_ * sizeof(BNODE *) +                            // BNODE *insert_p_[num_keys_]
-                              num_keys_ * sizeof(BNODE *) +                            // BNODE *insert_bna_[num_keys_]
-                              num_keys_ * sizeof(unsigned int) +                       // unsigned int insert_lr_[num_keys_]
-                              num_keys_ * sizeof(unsigned int) +                       // unsigned int insert_key_bit_[num_keys_]
-                              num_keys_ * sizeof(BNODE *) +                            // BNODE *insert_c_[num_keys_]
-                              num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char);  // unsigned char insert_ky_[num_keys_][1+max_key_bytes_]
-
-                debug("BNODE *insert_p_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
-                      num_keys_ * sizeof(BNODE *));
-                debug("BNODE *insert_bna_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
-                      num_keys_ * sizeof(BNODE *));
-                debug("unsigned int insert_lr_[num_keys_]  -  num_keys_ * sizeof(unsigned int) = %lu\n",
-                      num_keys_ * sizeof(unsigned int));
-                debug("unsigned int insert_key_bit_[num_keys_]  -  num_keys_ * sizeof(unsigned int) = %lu\n",
-                      num_keys_ * sizeof(unsigned int));
-                debug("BNODE *insert_c_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
-                      num_keys_ * sizeof(BNODE *));
-                debug("unsigned char insert_ky_[num_keys_][1+max_key_bytes_]  -  num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
-                      num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char));
+                ranked = get_le64( &head[6*8] ) == 1;
+                if ( ranked )
+                {
+                    order.assign( (size_t)num_keys_*(max_rdx_nodes_+1), 0 );
+                }
 
-                // 2(in search())
-                rdx_.bsize += num_keys_ * sizeof(BNODE *) +                            // BNODE *search_c_[num_keys_]
-                              num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char);  // unsigned char search_ky_[num_keys_][1+max_key_bytes_]
+                const size_t rbytes = (size_t)num_keys_*max_key_bytes_ + ( ranked ? (size_t)(num_keys_-1)*4 : 0 ) +
+                                      sizeof(app_data);  // bytes in one record
 
-                debug("BNODE *search_c_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
-                      num_keys_ * sizeof(BNODE *));
-                debug("unsigned char search_ky_[num_keys_][1+max_key_bytes_]  -  num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
-                      num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char));
+                vector<unsigned char> buf( ( rbytes > DUMP_BUFFER ) ? rbytes : DUMP_BUFFER / rbytes * rbytes );
 
-                // 2(in remove())
-                rdx_.bsize += num_keys_ * sizeof(BNODE *) +                            // BNODE *remove_c_[num_keys_]
-                              num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char);  // unsigned char remove_ky_[num_keys_][1+max_key_bytes_]
+                // allocate a data node for each record and set its keys and app_data
+                dnodeps.reserve(n);
+                while ( dnodeps.size() < n )
+                {
+                    const size_t nrec = std::min( (size_t)(n - dnodeps.size()), buf.size() / rbytes );  // records in buf
 
-                debug("BNODE *remove_c_[num_keys_]  -  num_keys_ * sizeof(BNODE *) = %lu\n",
-                      num_keys_ * sizeof(BNODE *));
-                debug("unsigned char remove_ky_[num_keys_][1+max_key_bytes_]  -  num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
-                      num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char));
+                    is.read( (char *)&buf[0], nrec*rbytes );
+                    if ( (size_t)is.gcount() != nrec*rbytes )
+                    {
+                        break;
+                    }
+                    sum = snapshot_sum( &buf[0], nrec*rbytes, sum );
 
-                // 1(in print())
-                rdx_.bsize += (1+max_key_bytes_) * sizeof(unsigned char);  // unsigned char print_ky_[1+max_key_bytes_]
+                    for ( size_t r = 0 ; r < nrec ; r++ )
+                    {
+                        const unsigned char *rec = &buf[r*rbytes];
+                        app_data data;
 
-                debug("unsigned char print_ky_[1+max_key_bytes_]  -  (1+max_key_bytes_) * sizeof(unsigned char) = %lu\n\n",
-                      (1+max_key_bytes_) * sizeof(unsigned char));
+                        memmove( (void *)&data, &rec[rbytes-sizeof(app_data)], sizeof(app_data) );
+                        construct_data( rdx_.dfree_head, data );
 
-                // 6(in verify())
-                rdx_.bsize += num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long) +                  // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]
-                              num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long) +                  // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]
-                              (max_rdx_nodes_+1) * sizeof(unsigned long) +                              // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1]
-                              (max_rdx_nodes_+1) * sizeof(unsigned long) +                              // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]
-                              num_keys_ * (max_rdx_nodes_+1) * max_key_bytes_ * sizeof(unsigned char) + // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]
-                              2 * (max_rdx_nodes_+1) * sizeof(unsigned long);                           // unsigned long verify_node_index_[2][max_rdx_nodes_+1]
+                        DNODE *dna = pop_dnode();
 
-                debug("unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]  -  num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
-                      num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long));
-                debug("unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]  -  num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
-                      num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long));
-                debug("unsigned long verify_dnode_addrs_[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
-                      (max_rdx_nodes_+1) * sizeof(unsigned long));
-                debug("unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]  -  (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n",
-                      (max_rdx_nodes_+1) * sizeof(unsigned long));
-                debug("unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]  -  num_keys_ * (max_rdx_nodes_+1) * max_key_bytes_ * sizeof(unsigned char) = %lu\n",
-                      num_keys_ * (max_rdx_nodes_+1) * max_key_bytes_ * sizeof(unsigned char));
-                debug("unsigned long verify_node_index_[2][max_rdx_nodes_+1]  -  2 * (max_rdx_nodes_+1) * sizeof(unsigned long) = %lu\n\n",
-                      2 * (max_rdx_nodes_+1) * sizeof(unsigned long));
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            // copy key with extra byte for comparison
+                            dna->key[k*kbytes+0] = 0;
+                            memmove( &dna->key[k*kbytes+1], &rec[k*max_key_bytes_], max_key_bytes_ );
+                        }
+                        for ( int k = 1 ; ranked && k < num_keys_ ; k++ )
+                        {
+                            order[(size_t)k*(max_rdx_nodes_+1) + dna->nsn] =
+                                get_le32( &rec[(size_t)num_keys_*max_key_bytes_ + (k-1)*4] );
+                        }
 
-                // exception object for throw()'ing calloc() error
-                class MKRdxPatConstructorExc: public std::exception
-                {
-                    virtual const char* what() const throw()
-                    {
-                        return "MKRdxPat MKRdxPat() calloc() failure.";
+                        dna->alloc = 1;
+                        if ( evict_ )
+                        {
+                            clock_ref_[dna->nsn] = 1;
+                        }
+                        dnodeps.push_back(dna);
                     }
-                } MKRdxPatConstructorExc;
+                }
+                rdx_.alloc_nodes = dnodeps.size();
 
-                fptr = (unsigned char *)calloc( rdx_.bsize, sizeof(unsigned char) );
-                if ( fptr == NULL )
+                if ( dnodeps.size() == n )
                 {
-                    throw MKRdxPatConstructorExc;
+                    is.read( (char *)&buf[0], 8 );
                 }
-
-                free_ptr_ = (void *)fptr;
-
-
-                // dynamic allocation for PNODE_
-                rdx_.head = (BNODE **) fptr;
-                fptr += (num_keys_) * sizeof(BNODE *);
-
-                rdx_.app_data_ptrs = (app_data **) fptr;
-                fptr += (max_rdx_nodes_+1) * sizeof(DNODE *);
-
-                rdx_.bnodes = (BNODE *) fptr;
-                fptr += ((max_rdx_nodes_+1) * num_keys_) * sizeof(BNODE);
-
-                rdx_.bfree_head = (BNODE **) fptr;
-                fptr += (num_keys_) * sizeof(BNODE *);
-
-                rdx_.dnodes = (DNODE *) fptr;
-                fptr += (max_rdx_nodes_+1) * sizeof(DNODE);
-
-
-                // dynamic allocation for DNODE
-                for ( int i = 0 ; i < max_rdx_nodes_+1 ; i++ )
+                if ( dnodeps.size() != n || is.gcount() != 8 || get_le64( &buf[0] ) != sum )
                 {
-                    rdx_.dnodes[i].br = (unsigned int *) fptr;
-                    fptr += (num_keys_) * sizeof(unsigned int);
-
-                    rdx_.dnodes[i].p = (BNODE **) fptr;
-                    fptr += (num_keys_) * sizeof(BNODE *);
-
-                    rdx_.dnodes[i].key = (unsigned char *) fptr;
-                    fptr += (num_keys_ * (1+max_key_bytes_)) * sizeof(unsigned char);
+                    // cut short or corrupt - return the trie to its empty state
+                    initialize();
+                    return 5;
                 }
 
-                // dynamic allocation for insert()
-                insert_p_ = (BNODE **) fptr;
-                fptr += num_keys_ * sizeof(BNODE *);
-
-                insert_bna_ = (BNODE **) fptr;
-                fptr += num_keys_ * sizeof(BNODE *);
-
-                insert_lr_ = (unsigned int *) fptr;
-                fptr += num_keys_ * sizeof(unsigned int);
-
-                insert_key_bit_ = (unsigned int *) fptr;
-                fptr += num_keys_ * sizeof(unsigned int);
-
-                insert_c_ = (BNODE **) fptr;
-                fptr += num_keys_ * sizeof(BNODE *);
-
-                insert_ky_ = (unsigned char *) fptr;
-                fptr += num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char);
-
-                // dynamic allocation for search()
-                search_c_ = (BNODE *) fptr;
-                fptr += num_keys_ * sizeof(BNODE *);
-
-                search_ky_ = (unsigned char *) fptr;
-                fptr += num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char);
+                if ( n == 0 )
+                {
+                    return 0;
+                }
 
-                // dynamic allocation for remove()
-                remove_c_ = (BNODE *) fptr;
-                fptr += num_keys_ * sizeof(BNODE *);
+                return bulk_link_all( dnodeps, ranked ? order.data() : NULL );
+            }  // load()
 
-                remove_ky_ = (unsigned char *) fptr;
-                fptr += num_keys_ * (1+max_key_bytes_) * sizeof(unsigned char);
+            /*
+             *======================================================================================================================
+             *     begin()
+             *
+             * Purpose:
+             *     return an iterator to the data node with the lowest key in key index k.  incrementing the iterator steps to
+             *     the data node with the next higher key.  the trie is walked incrementally - only as many data nodes are
+             *     visited as are read, so, unlike sort(), paging through the first few data nodes of a large trie is cheap
+             *     and a loop may be exited at any point.
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     MKRdxPat<app_data>::iterator it;
+             *
+             *     for ( it = rdx->begin(k) ; it != rdx->end(k) ; ++it )
+             *     {
+             *         it->data;   // the app_data of the data node
+             *         it.key();   // the MAX_KEY_BYTES key bytes(no key boolean) of key index k
+             *     }
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the lowest key data node of key index k
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if there are no data nodes or if k, the key index, is out of
+             *        range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k - key index(0 - NUM_KEYS-1)
+             *
+             * Comments:
+             *     1. an iterator is invalidated by remove() of the data node it refers to, by bulk_load() and by
+             *        chg_max_rdx_nodes().  insert()s and remove()s of other data nodes do not invalidate an iterator.
+             */
 
-                // dynamic allocation for print()
-                print_ky_ = (unsigned char *) fptr;
-                fptr += (1+max_key_bytes_) * sizeof(unsigned char);
+                iterator
+            begin
+                (
+                    const int k
+                )
+            {
+                if ( k < 0 || k > num_keys_-1 || rdx_.alloc_nodes == 0 )
+                {
+                    return iterator();
+                }
 
-                // dynamic allocation for verify()
-                verify_bnode_addrs_ = (unsigned long *) fptr;
-                fptr += num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long);
+                return iterator( this, k, leftmost_dnode( (BNODE *)(rdx_.head[k]->l) ) );
+            }  // begin()
 
-                verify_free_bnode_addrs_ = (unsigned long *) fptr;
-                fptr += num_keys_ * (max_rdx_nodes_+1) * sizeof(unsigned long);
+            /*
+             *======================================================================================================================
+             *     end()
+             *
+             * Purpose:
+             *     return the iterator one past the data node with the highest key in key index k
+             *
+             * Usage:
+             *     MKRdxPat<app_data>::iterator it = rdx->end(k);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - the end iterator - must not be dereferenced
+             *
+             * Parameters:
+             *     const int k - key index(0 - NUM_KEYS-1)
+             *
+             * Comments:
+             *     1. see begin()
+             */
 
-                verify_dnode_addrs_ = (unsigned long *) fptr;
-                fptr += (max_rdx_nodes_+1) * sizeof(unsigned long);
+                iterator
+            end
+                (
+                    const int k
+                )
+            {
+                return iterator( this, k, NULL );
+            }  // end()
 
-                verify_free_dnode_addrs_ = (unsigned long *) fptr;
-                fptr += (max_rdx_nodes_+1) * sizeof(unsigned long);
+            /*
+             *======================================================================================================================
+             *     rbegin()
+             *
+             * Purpose:
+             *     return a reverse iterator to the data node with the highest key in key index k.  incrementing the reverse
+             *     iterator steps to the data node with the next lower key.
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     MKRdxPat<app_data>::reverse_iterator rit;
+             *
+             *     for ( rit = rdx->rbegin(k) ; rit != rdx->rend(k) ; ++rit )
+             *     {
+             *         rit->data;   // the app_data of the data node
+             *         rit.key();   // the MAX_KEY_BYTES key bytes(no key boolean) of key index k
+             *     }
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::reverse_iterator - to the highest key data node of key index k
+             *     2. MKRdxPat<app_data>::reverse_iterator == rend(k) - if there are no data nodes or if k, the key index,
+             *        is out of range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k - key index(0 - NUM_KEYS-1)
+             *
+             * Comments:
+             *     1. see begin()
+             */
 
-                verify_dnode_keys_ = (unsigned char *) fptr;
-                fptr += num_keys_ * (max_rdx_nodes_+1) * max_key_bytes_ * sizeof(unsigned char);
+                reverse_iterator
+            rbegin
+                (
+                    const int k
+                )
+            {
+                if ( k < 0 || k > num_keys_-1 || rdx_.alloc_nodes == 0 )
+                {
+                    return reverse_iterator();
+                }
 
-                verify_node_index_ = (unsigned long *) fptr;
-                fptr += 2 * (max_rdx_nodes_+1) * sizeof(unsigned long);
+                // the top branch node left subtree holds all the data nodes - its right child is the root impossible key
+                DNODE *d = rightmost_dnode( (BNODE *)(((BNODE *)(rdx_.head[k]->l))->l) );
 
-                initialize();
-            }  // MKRdxPat()
+                // the last data node of the list of the highest key
+                return reverse_iterator( this, k, nonunique_[k] ? d->pv[k] : d );
+            }  // rbegin()
 
+            /*
+             *======================================================================================================================
+             *     rend()
+             *
+             * Purpose:
+             *     return the reverse iterator one past the data node with the lowest key in key index k
+             *
+             * Usage:
+             *     MKRdxPat<app_data>::reverse_iterator rit = rdx->rend(k);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::reverse_iterator - the end reverse iterator - must not be dereferenced
+             *
+             * Parameters:
+             *     const int k - key index(0 - NUM_KEYS-1)
+             *
+             * Comments:
+             *     1. see begin()
+             */
 
-            ~MKRdxPat()
+                reverse_iterator
+            rend
+                (
+                    const int k
+                )
             {
-                free( (void *)free_ptr_ );
-            }  // ~MKRdxPat()
+                return reverse_iterator( this, k, NULL );
+            }  // rend()
 
             /*
              *======================================================================================================================
-             *     insert()
+             *     range()
              *
-             * Purpose: 
-             *     remove a data node from the free list in the PNODE_ data structure and insert this node into the trie with keys
-             *     key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte for all keys(key[k][0]) is the key boolean.
-             *     the key boolean should always be set to 1 since all keys are needed for insertion.  the actual key bytes
-             *     (key[k][1 to MAX_KEY_BYTES]) follow the key boolean.  each key must be unique within it's key
-             *     index(0 to NUM_KEYS-1).
+             * Purpose:
+             *     call callback for every data node with a key in key index k in the range lo <= key < hi in key ascending
+             *     order.  the trie is descended once to lo and then walked in order until hi, thus, the cost is the trie
+             *     depth plus the number of data nodes in the range rather than a sort() of the whole trie.
              *
              * Usage:
              *     struct app_data
@@ -1197,722 +7030,973 @@ namespace MultiKeyRdxPat
              *         int data;
              *     }
              *
-             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
-             *     app_data *app_datap;
+             *     unsigned char lo[MAX_KEY_BYTES];
+             *     unsigned char hi[MAX_KEY_BYTES];
              *     int return_code;
              *
-             *     return_code = rdx->insert((unsigned char *)key, &app_datap);
+             *     return_code = rdx->range(k, lo, hi, [&](app_data *app_datap, const unsigned char *key) -> int
+             *                                         {
+             *                                             app_datap->data;  // the app_data of the data node
+             *                                             key;              // the MAX_KEY_BYTES key bytes of key index k
+             *                                             return 0;         // 0 - continue, !0 - stop
+             *                                         });
              *
              * Returns:
-             *     1. int return_code = 0, app_data *app_datap - if insertion is successful
-             *     2. int return_code = 1, app_data *app_datap - if any key is found to already exist
-             *     3. int return_code = 2, app_data *NULL - if no data nodes are on the free list
-             *     4. int return_code = 3, app_data *NULL - if any key boolean is not 1
+             *     1. int return_code = n - the number of data nodes callback was called for
+             *     2. int return_code = -1 - if k, the key index, is out of range(0 - NUM_KEYS-1)
              *
              * Parameters:
-             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
-             *     app_data **app_datapp                              - pointer to pointer to the inserted data node app_data struct
-             *                                                          or NULL if insertion fails
+             *     const int k              - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *lo  - unsigned char lo[MAX_KEY_BYTES] - lowest key in the range(no key boolean)
+             *                                or NULL for no lower bound
+             *     const unsigned char *hi  - unsigned char hi[MAX_KEY_BYTES] - first key above the range(no key boolean)
+             *                                or NULL for no upper bound
+             *     callback cb              - function, function object or lambda called as
+             *                                int cb(app_data *app_datap, const unsigned char *key) - key is the MAX_KEY_BYTES
+             *                                key bytes of key index k.  cb returns 0 to continue and !0 to stop the walk.
              *
              * Comments:
+             *     1. cb must not insert() or remove() data nodes.
+             *
+             *     2. the count returned includes the data node for which cb returned !0.
              */
 
+                template <typename callback>
                 int
-            insert
+            range
                 (
-                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
-                    app_data **app_datapp
+                    const int k,
+                    const unsigned char *lo,  // unsigned char lo[MAX_KEY_BYTES]
+                    const unsigned char *hi,  // unsigned char hi[MAX_KEY_BYTES]
+                    callback cb
                 )
             {
                 //
                 // see private data for definitions
                 //
-                // BNODE **insert_p_, **insert_bna_;  // BNODE *insert_p_[num_keys_], BNODE *insert_bna_[num_keys_];
-                // unsigned int *insert_lr_;          // unsigned int insert_lr_[num_keys_];
-                // unsigned int *insert_key_bit_;     // unsigned int insert_key_bit_[num_keys_];
-                // BNODE **insert_c_;                 // BNODE *insert_c_[num_keys_];
-                // unsigned char *insert_ky_;         // unsigned char insert_ky_[num_keys_][1+max_key_bytes_];
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
 
-                DNODE *dna;  // data node address assigned from the free queue head
+                DNODE *d;   // current data node of the walk
+                int n = 0;  // number of data nodes in the range
 
 
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                if ( k < 0 || k > num_keys_-1 )
                 {
-                    // for insertion all key booleans must be 1
-                    if ( key[k*(1+max_key_bytes_)+0] != 1 )
-                    {
-                        *app_datapp = NULL;
-                        return 3;
-                    }
+                    return -1;
                 }
 
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                if ( lo == NULL )
+                {
+                    d = begin(k).dnodep_;
+                }
+                else
                 {
                     // copy key to storage with extra byte for comparison
-                    insert_ky_[k*(1+max_key_bytes_)+0] = 0;
-                    memmove( &insert_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+                    range_ky_[0] = 0;
+                    memmove( &range_ky_[1], lo, max_key_bytes_ );
 
-                    // search for key in rdx trie
-                    insert_c_[k] = (BNODE *)(rdx_.head[k]->l);
-                    while ( insert_c_[k]->id == 0 )
+                    d = lower_bound_dnode(k, &range_ky_[0]);
+                }
+
+                while ( d != NULL )
+                {
+                    if ( hi != NULL && memcmp( &d->key[k*(1+max_key_bytes_)+1], hi, max_key_bytes_ ) >= 0 )
                     {
-                        insert_c_[k] = ( gbit( &insert_ky_[k*(1+max_key_bytes_)], insert_c_[k]->b ) ) ? (BNODE *)(insert_c_[k]->r) : (BNODE *)(insert_c_[k]->l);
+                        break;
                     }
 
-                    // if key found return node in arg and set return to 1
-                    if ( memcmp( &insert_ky_[k*(1+max_key_bytes_)], &((DNODE *)insert_c_[k])->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) == 0 )
+                    n++;
+                    if ( cb( &d->data, (const unsigned char *)&d->key[k*(1+max_key_bytes_)+1] ) != 0 )
                     {
-                        *app_datapp = &( ((DNODE *)(insert_c_[k]))->data );
-                        return 1;
+                        break;
                     }
+
+                    d = next_in_order( d, k );
                 }
 
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                return n;
+            }  // range()
+
+            /*
+             *======================================================================================================================
+             *     for_each_prefix()
+             *
+             * Purpose:
+             *     call callback for every data node with a key in key index k whose leading prefix_bits bits are the same as
+             *     the leading prefix_bits bits of prefix, in key ascending order.  the trie is descended once, only while the
+             *     branch nodes test bits within the prefix, to the subtree holding all such keys and only that subtree is
+             *     walked.  e.g. all IPv4 addresses under 10.0.0.0/8 or all MAC addresses with the same OUI(24 bits).
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     unsigned char prefix[MAX_KEY_BYTES];
+             *     int prefix_bits;
+             *     int return_code;
+             *
+             *     return_code = rdx->for_each_prefix(k, prefix, prefix_bits, [&](app_data *app_datap, const unsigned char *key) -> int
+             *                                                                {
+             *                                                                    app_datap->data;  // the app_data of the data node
+             *                                                                    key;              // the MAX_KEY_BYTES key bytes
+             *                                                                    return 0;         // 0 - continue, !0 - stop
+             *                                                                });
+             *
+             * Returns:
+             *     1. int return_code = n - the number of data nodes callback was called for
+             *     2. int return_code = -1 - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *     3. int return_code = -2 - if prefix_bits is out of range(0 - MAX_KEY_BYTES*8)
+             *
+             * Parameters:
+             *     const int k                  - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *prefix  - the leading key bytes(no key boolean) - at least (prefix_bits+7)/8 bytes are
+             *                                    used
+             *     const int prefix_bits        - the number of leading key bits to match(0 - MAX_KEY_BYTES*8).  0 matches
+             *                                    every key.
+             *     callback cb                  - function, function object or lambda called as
+             *                                    int cb(app_data *app_datap, const unsigned char *key) - key is the
+             *                                    MAX_KEY_BYTES key bytes of key index k.  cb returns 0 to continue and !0 to
+             *                                    stop the walk.
+             *
+             * Comments:
+             *     1. cb must not insert() or remove() data nodes.
+             *
+             *     2. the count returned includes the data node for which cb returned !0.
+             */
+
+                template <typename callback>
+                int
+            for_each_prefix
+                (
+                    const int k,
+                    const unsigned char *prefix,
+                    const int prefix_bits,
+                    callback cb
+                )
+            {
+                BNODE *c;    // the subtree holding all the keys with the prefix
+                DNODE *d;    // current data node of the walk
+                DNODE *end;  // the data node following the prefix subtree or NULL
+                int n = 0;   // number of data nodes with the prefix
+
+
+                if ( k < 0 || k > num_keys_-1 )
                 {
-                    // if no nodes free set app_datapp to NULL and return 2
-                    if ( rdx_.bfree_head[k] == NULL || rdx_.dfree_head == NULL )
-                    {
-                        *app_datapp = NULL;
-                        return 2;
-                    }
+                    return -1;
                 }
 
-                dna = rdx_.dfree_head;
-                rdx_.dfree_head = (DNODE *)(rdx_.dfree_head->nnfp);
-                rdx_.alloc_nodes++;
+                if ( prefix_bits < 0 || prefix_bits > max_key_bytes_*8 )
+                {
+                    return -2;
+                }
 
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                c = prefix_subtree(k, prefix, prefix_bits);
+                if ( c == NULL )
                 {
-                    // key not found in rdx trie: find leftmost bit that key is different from terminating
-                    // key actually found in trie.
-                    //
-                    // NOTE: the extra high order byte should insure that any time we arrive at this code
-                    //       ((DNODE *)c[k])->key[k] and key are different.  the maximum key bit will be the
-                    //       first bit of the extra byte.  if the keys are not different before or at bit zero
-                    //       (the furthest right most bit) then this statement will call gbit() with a negative
-                    //       value of key_bit and a memory violation will probably result or at the very least
-                    //       wholly incorrect insertion.
-                    insert_key_bit_[k] = max_key_bytes_*8;
-                    while ( gbit( &((DNODE *)insert_c_[k])->key[k*(1+max_key_bytes_)], insert_key_bit_[k] ) == gbit( &insert_ky_[k*(1+max_key_bytes_)+0], insert_key_bit_[k] ) )
-                    {
-                        insert_key_bit_[k]--;
-                    }
-
-                    // allocate new nodes from free list
-                    insert_bna_[k] = rdx_.bfree_head[k];
-                    rdx_.bfree_head[k] = (BNODE *)(rdx_.bfree_head[k]->p);
-
-                    // search for location to insert new key - c[k]->id != 0 new node will be at external trie
-                    // node insertion, insert_c_[k]->b <= insert_key_bit_ new node will be internal trie node insertion
-                    insert_lr_[k] = 0;
-                    insert_p_[k] = rdx_.head[k];
-                    insert_c_[k] = (BNODE *)(rdx_.head[k]->l);
-                    while ( insert_c_[k]->id == 0 && insert_c_[k]->b > insert_key_bit_[k] )
-                    {
-                        insert_p_[k] = insert_c_[k];
-                        if ( gbit( &insert_ky_[k*(1+max_key_bytes_)+0], insert_c_[k]->b ) )
-                        {
-                            insert_c_[k] = (BNODE *)(insert_c_[k]->r);
-                            insert_lr_[k] = 1;
-                        }
-                        else
-                        {
-                            insert_c_[k] = (BNODE *)(insert_c_[k]->l);
-                            insert_lr_[k] = 0;
-                        }
-                    }
+                    return 0;
+                }
 
-                    // set parent and child links to new branch node address
-                    if ( insert_lr_[k] == 0 )
-                    {
-                        insert_p_[k]->l = insert_bna_[k];
-                    }
-                    else
+                d = leftmost_dnode(c);
+                end = next_dnode(c, k);
+                while ( d != end )
+                {
+                    n++;
+                    if ( cb( &d->data, (const unsigned char *)&d->key[k*(1+max_key_bytes_)+1] ) != 0 )
                     {
-                        insert_p_[k]->r = insert_bna_[k];
+                        break;
                     }
 
-                    if ( insert_c_[k]->id == 0 )
-                    {
-                        ((BNODE *)insert_c_[k])->p = insert_bna_[k];
-                    }
-                    else
-                    {
-                        ((DNODE *)insert_c_[k])->p[k] = insert_bna_[k];
-                    }
+                    d = next_in_order( d, k );
+                }
 
-                    // set new branch node links and both child parent branches(dna->br[k],insert_c_[k]->br)
-                    insert_bna_[k]->br = insert_lr_[k];
-                    insert_bna_[k]->b = insert_key_bit_[k];
-                    insert_bna_[k]->p = insert_p_[k];
-                    if ( gbit( &insert_ky_[k*(1+max_key_bytes_)+0], insert_bna_[k]->b ) )
-                    {
-                        insert_bna_[k]->l = (void *)(insert_c_[k]);
-                        insert_bna_[k]->r = (void *)(dna);
-                        dna->br[k] = 1;
-                        if ( insert_c_[k]->id == 0 )
-                        {
-                            ((BNODE *)insert_c_[k])->br = 0;
-                        }
-                        else
-                        {
-                            ((DNODE *)insert_c_[k])->br[k] = 0;
-                        }
-                    }
-                    else
-                    {
-                        insert_bna_[k]->l = (void *)(dna);
-                        insert_bna_[k]->r = (void *)(insert_c_[k]);
-                        dna->br[k] = 0;
-                        if ( insert_c_[k]->id == 0 )
-                        {
-                            ((BNODE *)insert_c_[k])->br = 1;
-                        }
-                        else
-                        {
-                            ((DNODE *)insert_c_[k])->br[k] = 1;
-                        }
-                    }
+                return n;
+            }  // for_each_prefix()
 
-                    #if DEBUG_I
-                    debug("insert_ky_ k = %d\n", k);
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
-                    {
-                        printf("%X ", *(&insert_ky_[k*(1+max_key_bytes_)+0]+i));
-                    }
-                    printf("\n\n");
-                    #endif
+            /*
+             *======================================================================================================================
+             *     lower_bound()
+             *
+             * Purpose:
+             *     return an iterator to the data node with the lowest key in key index k that is >= key.  the trie is descended
+             *     once to the data node key would be found at, then the first bit key differs from that data node key and the
+             *     parent pointers give the neighbor - O(key bits).
+             *
+             * Usage:
+             *     unsigned char key[MAX_KEY_BYTES];
+             *
+             *     MKRdxPat<app_data>::iterator it = rdx->lower_bound(k, key);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the lowest key data node >= key
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if all keys are < key, there are no data nodes or if k, the key
+             *        index, is out of range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k               - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *key  - unsigned char key[MAX_KEY_BYTES] - the key bytes(no key boolean)
+             *
+             * Comments:
+             *     1. see begin().  the iterator may be incremented to walk on in key ascending order.
+             */
 
-                    // set child key
-                    memmove( &(dna->key[k*(1+max_key_bytes_)]), &insert_ky_[k*(1+max_key_bytes_)], max_key_bytes_+1 );
+                iterator
+            lower_bound
+                (
+                    const int k,
+                    const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
+
+                DNODE *d;
+
+
+                if ( k < 0 || k > num_keys_-1 )
+                {
+                    return end(k);
+                }
+
+                // copy key to storage with extra byte for comparison
+                range_ky_[0] = 0;
+                memmove( &range_ky_[1], key, max_key_bytes_ );
+
+                d = lower_bound_dnode(k, &range_ky_[0]);
+
+                return iterator( this, k, d );
+            }  // lower_bound()
+
+            /*
+             *======================================================================================================================
+             *     upper_bound()
+             *
+             * Purpose:
+             *     return an iterator to the data node with the lowest key in key index k that is > key
+             *
+             * Usage:
+             *     unsigned char key[MAX_KEY_BYTES];
+             *
+             *     MKRdxPat<app_data>::iterator it = rdx->upper_bound(k, key);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the lowest key data node > key
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if all keys are <= key, there are no data nodes or if k, the
+             *        key index, is out of range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k               - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *key  - unsigned char key[MAX_KEY_BYTES] - the key bytes(no key boolean)
+             *
+             * Comments:
+             *     1. see lower_bound()
+             */
+
+                iterator
+            upper_bound
+                (
+                    const int k,
+                    const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
+
+                DNODE *d;
 
-                    #if DEBUG_I
-                    debug("DEBUG_I: dna->key[] k = %d\n", k);
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
-                    {
-                        printf("%X ", *( &(dna->key[k*(1+max_key_bytes_)])+i ) );
-                    }
-                    printf("\n\n");
-                    #endif
 
-                    // set back pointer
-                    dna->p[k] = insert_bna_[k];
+                if ( k < 0 || k > num_keys_-1 )
+                {
+                    return end(k);
                 }
 
-                // set node to allocated status
-                dna->alloc = 1;
-
-                #if DEBUG_I
-                debug("DEBUG_I: dna = %p \n", (void *)dna );
-                #endif
+                // copy key to storage with extra byte for comparison
+                range_ky_[0] = 0;
+                memmove( &range_ky_[1], key, max_key_bytes_ );
 
-                // new node insertion successful, set return values
-                *app_datapp = &( dna->data );
+                d = lower_bound_dnode(k, &range_ky_[0]);
 
-                #if DEBUG_I
-                debug("DEBUG_I: end insert(): %d\n", dna->id);
-                #endif
+                if ( d != NULL && memcmp( &range_ky_[0], &d->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) == 0 )
+                {
+                    d = next_dnode( (BNODE *)d, k );
+                }
 
-                return 0;
-            }  // insert()
+                return iterator( this, k, d );
+            }  // upper_bound()
 
             /*
              *======================================================================================================================
-             *     search()
+             *     equal_range()
              *
-             * Purpose: 
-             *     search trie for the data node with the keys key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte
-             *     for all keys(key[k][0]) is the key boolean.  the key boolean should be set to 1(use the key) or
-             *     0(do not use key).  the actual key bytes(key[k][1 to max_key_bytes_]) follow the key boolean.  thus, 1 to
-             *     num_keys_ keys may be used in any given search.  only one key is necessary to find the data node.  each key
-             *     must be unique within it's key index(0 - NUM_KEYS-1).
+             * Purpose:
+             *     return the range of iterators [first, second) of all the data nodes with key in key index k.  in a
+             *     non-unique key index the trie is descended once to the first of the data nodes with key and the rest are
+             *     listed after it - O(key bits) plus one step per data node read.
              *
              * Usage:
-             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
-             *     app_data *app_datap;
+             *     unsigned char key[MAX_KEY_BYTES];
              *
-             *     app_datap = rdx->search((unsigned char *)key);
+             *     std::pair<MKRdxPat<app_data>::iterator, MKRdxPat<app_data>::iterator> r = rdx->equal_range(k, key);
+             *
+             *     for ( MKRdxPat<app_data>::iterator it = r.first ; it != r.second ; ++it )
+             *     {
+             *         it->data;   // the app_data of a data node with key
+             *     }
              *
              * Returns:
-             *     1. app_data *app_datap - if search is successful
-             *     2. app_data *NULL - if any key boolean is not 0 or 1
-             *     3. app_data *NULL - if two key searches end at different data nodes
-             *     4. app_data *NULL - if any key search does not end at a data node
-             *     5. app_data *NULL - if no key boolean is 1 then no keys are used
-             *    
+             *     1. std::pair<iterator, iterator> - first: the first data node with key, second: the first data node with
+             *        a higher key or end(k).  first == second if no data node has key.
+             *     2. std::pair<iterator, iterator> - first == second == end(k) - if k, the key index, is out of range(0 -
+             *        NUM_KEYS-1)
+             *
              * Parameters:
-             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     const int k               - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *key  - unsigned char key[MAX_KEY_BYTES] - the key bytes(no key boolean)
              *
              * Comments:
-             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
-             *
-             *          example 1:
-             *          in key[][]:
-             *             key number  key
-             *             0           01 aa bb cc dd    
-             *             1           01 ee ee ee ee
-             *             2           01 ff ff ff ff
-             *
-             *             use all three keys(0,1,2) in the search
-             *
-             *          example 2:
-             *          in key[][]:
-             *             0           00 aa bb cc dd
-             *             1           01 ee ee ee ee
-             *             2           00 ff ff ff ff
-             *
-             *             use only key 1 in the search
-             *
-             *          example 3:
-             *          in key[][]:
-             *             0           01 00 00 00 01
-             *             1           01 00 00 00 01
-             *             2           01 00 00 00 01
-             *
-             *             inserted successfuly - a. all key booleans 1  b. each key unique in it's own key index(0 - 2)
+             *     1. in a unique key index the range holds at most one data node.
              */
 
-                app_data *
-            search
+                std::pair<iterator, iterator>
+            equal_range
                 (
-                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    const int k,
+                    const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
                 )
             {
                 //
                 // see private data for definitions
                 //
-                // BNODE *search_c_;           // BNODE *search_c_[num_keys_];
-                // unsigned char *search_ky_;  // unsigned char search_ky_[num_keys_][1+max_key_bytes_];
-
-                BNODE *csav;  // save first key data node address and make sure all key searches end at the same data node
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
 
-                bool firsttime = true;  // every search() call
+                DNODE *d;   // first data node with key or the lowest key > key
+                DNODE *nd;  // first data node with a key > key
 
 
-                int n = 0;  // sum of key booleans that are 1 - must be >=1
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                if ( k < 0 || k > num_keys_-1 )
                 {
-                    #if DEBUG_S
-                    debug("DEBUG_S: k = %d\n", k);
-                    #endif
+                    return std::make_pair( end(k), end(k) );
+                }
 
-                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
-                    {
-                        continue;  // if key boolean is 0 skip key
-                    }
-                    else if ( key[k*(1+max_key_bytes_)+0] == 1 )
-                    {
-                        n++;  // if key boolean is 1 use key
-                    }
-                    else
-                    {
-                        return NULL;  // if a key boolean is not 0 or 1
-                    }
+                // copy key to storage with extra byte for comparison
+                range_ky_[0] = 0;
+                memmove( &range_ky_[1], key, max_key_bytes_ );
 
-                    // copy key to storage with extra byte for comparison
-                    search_ky_[k*(1+max_key_bytes_)+0] = 0;
-                    memmove( &search_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+                d = nd = lower_bound_dnode(k, &range_ky_[0]);
 
-                    // search for key in rdx trie
-                    search_c_ = (BNODE *)(rdx_.head[k]->l);
-                    while ( search_c_->id == 0 )
-                    {
-                        search_c_ = ( gbit( &search_ky_[k*(1+max_key_bytes_)+0], search_c_->b ) ) ? (BNODE *)(search_c_->r) : (BNODE *)(search_c_->l);
-                    }
+                if ( d != NULL && memcmp( &range_ky_[0], &d->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) == 0 )
+                {
+                    nd = next_dnode( (BNODE *)d, k );
+                }
 
-                    #if DEBUG_S
-                    debug("DEBUG_S: search_c_ = %p \n", (void *)search_c_ );
-                    debug("DEBUG_S: ((DNODE *)search_c_)->key = %p \n", (void *)((DNODE *)search_c_)->key );
-                    #endif
+                return std::make_pair( iterator( this, k, d ), iterator( this, k, nd ) );
+            }  // equal_range()
 
-                    // check if all keys end at the same data node - if not return NULL
-                    if ( firsttime == true )
-                    {
-                        csav = search_c_;
-                        firsttime = false;
-                    }
-                    else
-                    {
-                        if ( search_c_ != csav )
-                        {
-                            return NULL;  // a key does not end at the same data node as a previous key
-                        }
-                    }
+            /*
+             *======================================================================================================================
+             *     successor()
+             *
+             * Purpose:
+             *     return an iterator to the data node with the next key in key index k after key.  key need not be in the trie.
+             *
+             * Usage:
+             *     unsigned char key[MAX_KEY_BYTES];
+             *
+             *     MKRdxPat<app_data>::iterator it = rdx->successor(k, key);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the lowest key data node > key
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if there is no higher key or if k, the key index, is out of
+             *        range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k               - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *key  - unsigned char key[MAX_KEY_BYTES] - the key bytes(no key boolean)
+             *
+             * Comments:
+             *     1. the same as upper_bound()
+             */
 
-                    #if DEBUG_S
-                    debug("%s", "\n");
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
-                    {
-                        printf("%X ", *(&search_ky_[k*(1+max_key_bytes_)+0]+i) );
-                    }
-                    printf("\n");
+                iterator
+            successor
+                (
+                    const int k,
+                    const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+                )
+            {
+                return upper_bound(k, key);
+            }  // successor()
 
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
-                    {
-                        printf("DEBUG_S: %p\n",  (void *)(&((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i) );
-                        printf("DEBUG_S: %X\n", *( &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)]+i ) );
-                    }
-                    printf("\n");
+            /*
+             *======================================================================================================================
+             *     predecessor()
+             *
+             * Purpose:
+             *     return an iterator to the data node with the previous key in key index k before key.  key need not be in the
+             *     trie.
+             *
+             * Usage:
+             *     unsigned char key[MAX_KEY_BYTES];
+             *
+             *     MKRdxPat<app_data>::iterator it = rdx->predecessor(k, key);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the highest key data node < key
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if there is no lower key or if k, the key index, is out of
+             *        range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k               - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *key  - unsigned char key[MAX_KEY_BYTES] - the key bytes(no key boolean)
+             *
+             * Comments:
+             *     1. see lower_bound()
+             */
 
-                    printf("DEBUG_S: dna = %p\n", (void *)(DNODE *)search_c_ );
-                    #endif
+                iterator
+            predecessor
+                (
+                    const int k,
+                    const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
+                )
+            {
+                //
+                // see private data for definitions
+                //
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
 
-                    // if key not found return NULL
-                    if ( memcmp( &search_ky_[k*(1+max_key_bytes_)+0], &((DNODE *)search_c_)->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) != 0 )
-                    {
-                        #if DEBUG_S
-                        debug("%s", "DEBUG_S: k = exit2\n");
-                        #endif
+                DNODE *d;
 
-                        return NULL;  // key not found
-                    }
-                }
 
-                if ( n == 0 )
+                if ( k < 0 || k > num_keys_-1 )
                 {
-                    #if DEBUG_S
-                    debug("%s", "DEBUG_S: k = exit3\n");
-                    #endif
+                    return end(k);
+                }
 
-                    return NULL;  // no keys are used(all key booleans are 0)
+                // copy key to storage with extra byte for comparison
+                range_ky_[0] = 0;
+                memmove( &range_ky_[1], key, max_key_bytes_ );
+
+                d = lower_bound_dnode(k, &range_ky_[0]);
+
+                // the data node before the lowest key >= key - if all keys are lower it is the highest key
+                if ( d == NULL )
+                {
+                    return max(k);
                 }
 
-                // success - all keys found in the same data node - return app_datap pointer
-                return &( ((DNODE *)(search_c_))->data );
-            }  // search()
+                return iterator( this, k, prev_in_order( d, k ) );
+            }  // predecessor()
 
             /*
              *======================================================================================================================
-             *     remove()
+             *     min()
              *
-             * Purpose: 
-             *     remove trie data node with the keys key[NUM_KEYS][1+MAX_KEY_BYTES].  the second subscript first byte for all
-             *     keys(key[k][0]) is the key boolean.  the key boolean should be set to 1(use the key) or 0(do not use key).
-             *     the actual key bytes(key[k][1 to MAX_KEY_BYTES]) follow the key boolean.  thus, 1 to NUM_KEYS keys may be used
-             *     for any given remove.  only one key is necessary to remove the data node.  each key must be unique within it's
-             *     key index(0 - NUM_KEYS-1).
+             * Purpose:
+             *     return an iterator to the data node with the lowest key in key index k
              *
              * Usage:
-             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
-             *     app_data *app_datap;
+             *     MKRdxPat<app_data>::iterator it = rdx->min(k);
              *
-             *     app_datap = rdx->remove((unsigned char *)key);
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the lowest key data node
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if there are no data nodes or if k, the key index, is out of
+             *        range(0 - NUM_KEYS-1)
+             *
+             * Parameters:
+             *     const int k - key index(0 - NUM_KEYS-1)
+             *
+             * Comments:
+             *     1. the same as begin()
+             */
+
+                iterator
+            min
+                (
+                    const int k
+                )
+            {
+                return begin(k);
+            }  // min()
+
+            /*
+             *======================================================================================================================
+             *     max()
+             *
+             * Purpose:
+             *     return an iterator to the data node with the highest key in key index k
+             *
+             * Usage:
+             *     MKRdxPat<app_data>::iterator it = rdx->max(k);
              *
              * Returns:
-             *     1. app_data *app_datap - if search is successful
-             *     2. app_data *NULL - if any key boolean is not 0 or 1
-             *     3. app_data *NULL - if two key searches end at different data nodes
-             *     4. app_data *NULL - if any key search does not end at a data node
-             *     5. app_data *NULL - if no key boolean is 1 then no keys are used
+             *     1. MKRdxPat<app_data>::iterator - to the highest key data node
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if there are no data nodes or if k, the key index, is out of
+             *        range(0 - NUM_KEYS-1)
              *
              * Parameters:
-             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     const int k - key index(0 - NUM_KEYS-1)
              *
              * Comments:
-             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
+             *     1. see begin().  incrementing the iterator gives end(k) - use rbegin() to walk in key descending order.
+             */
+
+                iterator
+            max
+                (
+                    const int k
+                )
+            {
+                return iterator( this, k, rbegin(k).dnodep_ );
+            }  // max()
+
+            /*
+             *======================================================================================================================
+             *     rank()
              *
-             *          example 1:
-             *          in key[][]:
-             *             key number  key
-             *             0           01 aa bb cc dd    
-             *             1           01 ee ee ee ee
-             *             2           01 ff ff ff ff
+             * Purpose:
+             *     return the number of data nodes with a key in key index k that is lower than key - the position key has or
+             *     would have in key index k key order.  the trie is descended once to the data node key would be found at and
+             *     the parent pointers are climbed back to the top adding the subtree counts of the left subtrees the search
+             *     path went to the right of - O(key bits) instead of the walk of every lower data node.
              *
-             *             use all three keys(0,1,2) in the search
+             * Usage:
+             *     unsigned char key[MAX_KEY_BYTES];
+             *     int return_code;
              *
-             *          example 2:
-             *          in key[][]:
-             *             0           00 aa bb cc dd
-             *             1           01 ee ee ee ee
-             *             2           00 ff ff ff ff
+             *     return_code = rdx->rank(k, key);
              *
-             *             use only one key(1) in the search
+             * Returns:
+             *     1. int return_code = n - the number of data nodes with a key index k key < key(0 - alloc_nodes())
+             *     2. int return_code = -1 - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *     3. int return_code = -2 - if the object was not constructed with RDX_ORDER_STATS
+             *
+             * Parameters:
+             *     const int k               - key index(0 - NUM_KEYS-1)
+             *     const unsigned char *key  - unsigned char key[MAX_KEY_BYTES] - the key bytes(no key boolean)
+             *
+             * Comments:
+             *     1. the branch node subtree counts used by rank(), select() and sample() are only kept if the object is
+             *        constructed with the constructor option RDX_ORDER_STATS.  they add one
+             *        unsigned int per branch node and a climb of the parent pointers to every insert() and remove().
+             *        without them these member functions return an error.
              */
 
-                app_data *
-            remove
+                int
+            rank
                 (
-                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    const int k,
+                    const unsigned char *key  // unsigned char key[MAX_KEY_BYTES]
                 )
             {
                 //
                 // see private data for definitions
                 //
-                // BNODE *remove_c_;           // BNODE *remove_c_[num_keys_];
-                // unsigned char *remove_ky_;  // unsigned char remove_ky_[num_keys_][1+max_key_bytes_];
-
-                BNODE *oc;  // other child pointer
+                // unsigned char *range_ky_;  // unsigned char range_ky_[1+max_key_bytes_];
 
-                BNODE *csav;  // save first key data node address and make sure all key searches end at the same data node
-
-                bool firsttime = true;  // every remove() call
+                BNODE *c;         // descent child and then the subtree that key is lower or higher than
+                BNODE *p;         // parent branch node of c
+                unsigned int br;  // parent branch indicator of c
+                unsigned int b;   // first bit key differs from the key found
+                int n = 0;        // number of data nodes with a lower key
 
 
-                int n = 0;  // sum of key booleans that are 1 - must be >=1
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                if ( k < 0 || k > num_keys_-1 )
                 {
-                    #if DEBUG_R
-                    debug("DEBUG_R: key boolean = %X\n", key[k*(1+max_key_bytes_)+0]);
-                    #endif
-
-                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
-                    {
-                        continue;
-                    }
-                    else if ( key[k*(1+max_key_bytes_)+0] == 1 )
-                    {
-                        n++;  // if key boolean is 1 use key
-                    }
-                    else
-                    {
-                        #if DEBUG_R
-                        debug("%s", "DEBUG_R: k = exit0\n");
-                        #endif
+                    return -1;
+                }
 
-                        return NULL;  // if a key boolean is not 0 or 1
-                    }
+                if ( !order_stats_ )
+                {
+                    return -2;
+                }
 
-                    #if DEBUG_R
-                    debug("DEBUG_R: k = %d\n", k);
-                    printf("DEBUG_R: max_rdx_nodes_ = %d\n", max_rdx_nodes_);
-                    printf("DEBUG_R: num_keys_ = %d\n", num_keys_);
-                    printf("DEBUG_R: max_key_bytes_ = %d\n", max_key_bytes_);
-                    #endif
+                if ( rdx_.alloc_nodes == 0 )
+                {
+                    return 0;
+                }
 
+                // copy key to storage with extra byte for comparison
+                range_ky_[0] = 0;
+                memmove( &range_ky_[1], key, max_key_bytes_ );
 
-                    // copy key to storage with extra byte for comparison
-                    remove_ky_[k*(1+max_key_bytes_)+0] = 0;
-                    memmove( &remove_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+                c = (BNODE *)(rdx_.head[k]->l);
+                while ( c->id == 0 )
+                {
+                    c = ( gbit( &range_ky_[0], c->b ) ) ? (BNODE *)(c->r) : (BNODE *)(c->l);
+                }
 
-                    // search for key in rdx trie
-                    remove_c_ = (BNODE *)(rdx_.head[k]->l);
-                    while ( remove_c_->id == 0 )
-                    {
-                        remove_c_ = ( gbit( &remove_ky_[k*(1+max_key_bytes_)+0], remove_c_->b ) ) ? (BNODE *)(remove_c_->r) : (BNODE *)(remove_c_->l);
-                    }
+                // if key is not found it is lower or higher than all the keys of the subtree under the last branch node
+                // testing a higher bit than the first bit key differs from the key found at(see lower_bound_dnode())
+                if ( memcmp( &range_ky_[0], &((DNODE *)c)->key[k*(1+max_key_bytes_)], 1+max_key_bytes_ ) != 0 )
+                {
+                    b = diff_bit( &range_ky_[0], &((DNODE *)c)->key[k*(1+max_key_bytes_)] );
 
-                    // check if all keys end at the same data node - if not return NULL
-                    if ( firsttime == true )
-                    {
-                        csav = remove_c_;
-                        firsttime = false;
-                    }
-                    else
+                    parent(c, k, &p, &br);
+                    while ( p->b < b )
                     {
-                        if ( remove_c_ != csav )
-                        {
-                            return NULL;  // a key does not end at the same data node as a previous key
-                        }
+                        c = p;
+                        parent(c, k, &p, &br);
                     }
 
-                    #if DEBUG_R
-                    debug("%s", "\n");
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                    if ( gbit( &range_ky_[0], b ) == 1 )
                     {
-                        printf("DEBUG_R: %X ", *(&remove_ky_[k*(1+max_key_bytes_)+0]+i) );
+                        n += subtree_count(c, k);
                     }
-                    printf("\n");
+                }
 
-                    for ( int i = 0 ; i < max_key_bytes_+1 ; i++ )
+                // every data node of a left subtree the path to c went to the right of has a lower key
+                parent(c, k, &p, &br);
+                while ( p != rdx_.head[k] )
+                {
+                    if ( br == 1 )
                     {
-                        printf("DEBUG_R: %p\n",  (void *)(&((DNODE *)remove_c_)->key[k*(1+max_key_bytes_)]+i) );
-                        printf("DEBUG_R: %X\n", *( &((DNODE *)remove_c_)->key[k*(1+max_key_bytes_)]+i ) );
+                        n += subtree_count( (BNODE *)(p->l), k );
                     }
-                    printf("\n");
-                    #endif
 
-                    // if key not found return NULL
-                    if ( memcmp( &remove_ky_[k*(1+max_key_bytes_)+0], &((DNODE *)remove_c_)->key[k*(1+max_key_bytes_)], max_key_bytes_+1 ) != 0 )
-                    {
-                        return NULL;  // key not found
-                    }
+                    br = p->br;
+                    p = (BNODE *)(p->p);
                 }
 
-                if ( n == 0 )
-                {
-                    #if DEBUG_R
-                    debug("%s", "DEBUG_R: k = exit3\n");
-                    #endif
+                return n;
+            }  // rank()
 
-                    return NULL;  // no keys are used(all key booleans are 0)
-                }
+            /*
+             *======================================================================================================================
+             *     select()
+             *
+             * Purpose:
+             *     return an iterator to the data node at position i(0 - the lowest key) in key index k key order.  the trie is
+             *     descended once from the top - at each branch node going left if i is less than the subtree count of the
+             *     left child, else subtracting that count from i and going right - O(key bits).
+             *
+             * Usage:
+             *     int i;
+             *
+             *     MKRdxPat<app_data>::iterator it = rdx->select(k, i);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the data node with i lower keys in key index k
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if i is out of range(0 - alloc_nodes()-1), if k, the key
+             *        index, is out of range(0 - NUM_KEYS-1) or if the object was not constructed with RDX_ORDER_STATS
+             *
+             * Parameters:
+             *     const int k - key index(0 - NUM_KEYS-1)
+             *     const int i - the position in key index k key order(0 - alloc_nodes()-1)
+             *
+             * Comments:
+             *     1. see rank().  rdx->rank(k, rdx->select(k, i).key()) is i.
+             *     2. see begin().  the iterator may be incremented to walk on in key ascending order.
+             */
 
-                // for each key reset pointers for num_keys_ branch nodes and the data node
-                for ( int k = 0 ; k < num_keys_ ; k++ )
-                {
-                    // set ptr to other child of branch node to remove
-                    if ( ((DNODE *)remove_c_)->br[k] == 0 )
-                    {
-                        oc = ((BNODE *)((BNODE *)((DNODE *)remove_c_)->p[k])->r);
-                    }
-                    else
-                    {
-                        oc = ((BNODE *)((BNODE *)((DNODE *)remove_c_)->p[k])->l);
-                    }
+                iterator
+            select
+                (
+                    const int k,
+                    const int i
+                )
+            {
+                DNODE *d = i < 0 ? NULL : select_dnode( k, (size_t)i );
 
-                    if ( oc->id == 0 )
-                    {
-                        // other child is a branch node - repair other child ptrs
-                        ((BNODE *)oc)->p = ((BNODE *)((DNODE *)remove_c_)->p[k])->p;
-                        ((BNODE *)oc)->br = ((BNODE *)((DNODE *)remove_c_)->p[k])->br;
-                    }
-                    else
-                    {
-                        // other child is a data node - repair other child ptrs
-                        ((DNODE *)oc)->p[k] = ((BNODE*)((BNODE *)((DNODE *)remove_c_)->p[k])->p);
-                        ((DNODE *)oc)->br[k] = ((BNODE *)((DNODE *)remove_c_)->p[k])->br;
-                    }
 
-                    // repair ptr of parent of parent
-                    if ( ((BNODE *)((DNODE *)remove_c_)->p[k])->br == 0 )
-                    {
-                        ((BNODE *)((BNODE *)((DNODE *)remove_c_)->p[k])->p)->l = oc;
-                    }
-                    else
-                    {
-                        ((BNODE *)((BNODE *)((DNODE *)remove_c_)->p[k])->p)->r = oc;
-                    }
+                return d == NULL ? end(k) : iterator( this, k, d );
+            }  // select()
 
-                    // return branch nodes to free list
-                    ((BNODE *)((DNODE *)remove_c_)->p[k])->p = rdx_.bfree_head[k];
-                    rdx_.bfree_head[k] = ((DNODE *)remove_c_)->p[k];
-                }
+            /*
+             *======================================================================================================================
+             *     sample()
+             *
+             * Purpose:
+             *     return an iterator to a data node chosen uniformly at random from all the data nodes - select() of a
+             *     position drawn from gen by std::uniform_int_distribution over 0 - alloc_nodes()-1 - O(key bits).  for
+             *     monitoring a random subset of a large trie.
+             *
+             * Usage:
+             *     std::mt19937_64 gen;
+             *
+             *     MKRdxPat<app_data>::iterator it = rdx->sample(k, gen);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data>::iterator - to the data node chosen
+             *     2. MKRdxPat<app_data>::iterator == end(k) - if there are no data nodes, if k, the key index, is out of
+             *        range(0 - NUM_KEYS-1) or if the object was not constructed with RDX_ORDER_STATS
+             *
+             * Parameters:
+             *     const int k     - key index(0 - NUM_KEYS-1) - of the iterator returned
+             *     generator &gen  - a uniform random bit generator(e.g. std::mt19937_64) - advanced by each call
+             *
+             * Comments:
+             *     1. see rank().  the choice is uniform in every key index, but the same draw may choose a different data
+             *        node in each key index.
+             *     2. the position is drawn without modulo bias, so the choice stays uniform for any alloc_nodes().
+             */
 
-                // set node to free status
-                ((DNODE *)remove_c_)->alloc = 0;
+                template <typename generator>
+                iterator
+            sample
+                (
+                    const int k,
+                    generator &gen
+                )
+            {
+                DNODE *d;  // data node chosen
 
-                // return data node to free list
-                ((DNODE *)remove_c_)->nnfp = rdx_.dfree_head;
-                rdx_.dfree_head = (DNODE *)remove_c_;
 
-                // decrement total allocated nodes
-                rdx_.alloc_nodes--;
+                if ( rdx_.alloc_nodes == 0 )
+                {
+                    return end(k);
+                }
 
-                // set return pointer to removed node app_data
-                return &( ((DNODE *)(remove_c_))->data );
-            }  // remove()
+                std::uniform_int_distribution<size_t> position( 0, (size_t)rdx_.alloc_nodes-1 );
+                d = select_dnode( k, position(gen) );
+
+                return d == NULL ? end(k) : iterator( this, k, d );
+            }  // sample()
 
             /*
              *======================================================================================================================
-             *     sort()
+             *     set_expiry()
              *
-             * Purpose: 
-             *     sort pointers to app_data (app_data *app_data_ptrs[max_rdx_nodes_+1]) by key index k in key ascending order
+             * Purpose:
+             *     set the expiry time of the data node with handle handle to t or clear it(t = 0).  the data node is moved to
+             *     the hierarchical timing wheel list for t in O(1) - no key is copied and no trie is searched.  for idle
+             *     timeouts call set_expiry(handle, now + timeout) each time the data node is used.
              *
              * Usage:
-             *     app_data **app_datapp;
-             *     int k;
+             *     MKRdxPat<app_data>::node_handle handle;
+             *     unsigned long long t;
              *     int return_code;
              *
-             *     return_code = rdx->sort(&app_datapp, k);
+             *     return_code = rdx->set_expiry(handle, t);
              *
              * Returns:
-             *     1. int return_code = n, app_data **app_datapp - return the number of sorted nodes and pointer
-             *        set to array of pointers to app_data
-             *     2. int return_code = 0, app_data **NULL - if there are no data nodes(no keys to sort)
-             *     3. int return_code = -1, app_data **NULL - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *     1. int return_code = 0 - if the expiry time is set
+             *     2. int return_code = 1 - if handle is not the handle of a data node in the trie
+             *     3. int return_code = 2 - if the object was not constructed with RDX_EXPIRY
              *
              * Parameters:
-             *     app_data ***app_data - pointer to pointer to pointer to app_data
-             *     const int k          - key index(0 - NUM_KEYS-1)
+             *     const node_handle handle   - data node handle from insert(), search() or an iterator
+             *     const unsigned long long t - the expiry time in the caller's time units(e.g. seconds or milliseconds) or
+             *                                  0 for no expiry
              *
              * Comments:
-             *     ((app_data *)app_datapp[0 to return_code-1])->(app_data struct fields) - to access app_data data
+             *     1. the expiry times are kept only if the object was constructed with the constructor option
+             *        RDX_EXPIRY.  they add an 8 byte time and two 4 byte wheel list links per data node.
              *
+             *     2. a data node with no expiry time set never expires.  a time not after the now of the last expire() is
+             *        due at the next expire().
              */
 
                 int
-            sort
+            set_expiry
                 (
-                    app_data ***app_datappp,
-                    const int k
+                    const node_handle handle,
+                    const unsigned long long t
                 )
             {
-                if ( k < 0 || k > num_keys_-1 )
+                DNODE *d = handle_dnode(handle);
+
+
+                if ( !expiry_ )
                 {
-                    *app_datappp = NULL;
-                    return -1;
+                    return 2;
                 }
 
-                // set full node_ptrs array to 0xf0 - shouldn't affect anything - then 0xf0 pattern
-                // will be in array elements not allocated - makes debugging easier
-                memset( rdx_.app_data_ptrs, 0xf0, (max_rdx_nodes_+1) * sizeof(app_data *) );
+                if ( d == NULL )
+                {
+                    return 1;
+                }
 
-                rdx_.app_data_ptrs_cnt = 0;
+                if ( expire_at_[handle] != 0 )
+                {
+                    wheel_unlink( handle );
+                }
 
-                recursive( rdx_.head[k] );
+                expire_at_[handle] = t;
+                if ( t != 0 )
+                {
+                    wheel_link( handle );
+                }
 
-                *app_datappp = rdx_.app_data_ptrs;
+                return 0;
+            }  // set_expiry()
 
-                if ( rdx_.app_data_ptrs_cnt-1 == 0 )
+            /*
+             *======================================================================================================================
+             *     expiry()
+             *
+             * Purpose:
+             *     return the expiry time of the data node with handle handle
+             *
+             * Usage:
+             *     MKRdxPat<app_data>::node_handle handle;
+             *     unsigned long long t;
+             *
+             *     t = rdx->expiry(handle);
+             *
+             * Returns:
+             *     1. unsigned long long t - the expiry time of the data node
+             *     2. unsigned long long 0 - if no expiry time is set, if handle is not the handle of a data node in the trie
+             *                               or if the object was not constructed with RDX_EXPIRY
+             *
+             * Parameters:
+             *     const node_handle handle - data node handle from insert(), search() or an iterator
+             *
+             * Comments:
+             */
+
+                unsigned long long
+            expiry
+                (
+                    const node_handle handle
+                )
+            {
+                if ( !expiry_ || handle_dnode(handle) == NULL )
                 {
-                    *app_datappp = NULL;
+                    return 0;
                 }
 
-                return rdx_.app_data_ptrs_cnt-1;
-            }  // sort()
+                return expire_at_[handle];
+            }  // expiry()
 
             /*
              *======================================================================================================================
-             *     keys()
+             *     expire()
              *
-             * Purpose: 
-             *     search for a data node with the key[][] argument which are a subset of the full set of keys and fill in
-             *     key[][] with the data node keys which were not used in the search .  set the key boolean to 0 and copy the
-             *     DNODE key to key[][].  for example, if three keys were used in the trie and the data node was found with only
-             *     the first key then fill in key[][] with the second and third keys, leaving the key booleans for these keys
-             *     set to 0.  thus, searching key[][] for key booleans of 0 will give all the keys not used in the original
-             *     search.
+             * Purpose:
+             *     advance the expiry timing wheel to time now and visit at most budget of the data nodes with an expiry time
+             *     not after now.  cb is called for each data node visited and the data node is then removed unless cb kept
+             *     it.  the data nodes are unlinked from
+             *     every key index trie with their parent pointers - no key index is searched.  the wheel holds each data node
+             *     in the level of the highest bit its expiry time differs from the wheel time at, thus, advancing the wheel
+             *     visits at most WHEEL_SLOTS slots per level and moves each data node down at most once per level.  a call
+             *     costs the data nodes visited plus the data nodes moved to a lower level, whatever the size of the trie.
              *
              * Usage:
-             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     unsigned long long now;
+             *     int budget;
              *     int return_code;
              *
-             *     return_code = rdx->keys((unsigned char *)key);
+             *     return_code = rdx->expire(now, budget, [&](app_data *app_datap, MKRdxPat<app_data>::node_handle handle) -> int
+             *                                            {
+             *                                                app_datap->data;  // the app_data of the expired data node
+             *                                                return 0;         // 0 - continue, !0 - stop
+             *                                            });
              *
              * Returns:
-             *     1. int return_code = 0 - data node found and missing keys filled in
-             *     2. int return_code = 1 - can't find any data node with key[][]
-             *     3. int return_code = 2 - no key[][]'s are missing to copy from DNODE
+             *     1. int return_code = n - the number of data nodes removed(0 - budget)
+             *     2. int return_code = -1 - if the object was not constructed with RDX_EXPIRY
              *
              * Parameters:
-             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     const unsigned long long now - the current time in the units of set_expiry()
+             *     const int budget             - the maximum number of data nodes visited - removed or kept by cb
+             *     callback cb                  - function, function object or lambda called as
+             *                                    int cb(app_data *app_datap, node_handle handle) before the data node is
+             *                                    removed.  cb returns 0 to continue and !0 to stop after this data node.
              *
              * Comments:
+             *     1. the data nodes due are removed in expiry time order of the wheel slots - data nodes in the same slot
+             *        in the order they were set.  data nodes left over when budget is reached are removed by the next
+             *        expire().
+             *
+             *     2. cb may call set_expiry(handle, t) with t after now, or 0, to keep the data node - it is then not
+             *        removed or counted in the return code, but it is counted against budget, thus, a call costs at most
+             *        budget callbacks however many data nodes cb keeps.  cb must not insert() or remove() data nodes.
+             *
+             *     3. a now before the now of the last expire() does not move the wheel back.
              */
 
+                template <typename callback>
                 int
-            keys
+            expire
                 (
-                    unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    const unsigned long long now,
+                    const int budget,
+                    callback cb
                 )
             {
-                // pointer to DNODE
-                DNODE *dnodep;
+                const unsigned int h = max_rdx_nodes_+1 + WHEEL_LISTS-1;  // due list head subscript
 
-                if ( (dnodep = search_dnode(key)) == NULL )
+                int n = 0;  // number of data nodes removed
+                int v = 0;  // number of data nodes visited
+
+
+                if ( !expiry_ )
                 {
-                    return 1;  // can't find any data node with key[][]
+                    return -1;
                 }
 
-                int missing_keys = 0;
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                if ( now > wheel_time_ )
                 {
-                    // copy missing keys from DNODE to key[][]
-                    if ( key[k*(1+max_key_bytes_)+0] == 0 )
-                    {
-                        memmove( &key[k*(1+max_key_bytes_)+1], &(dnodep->key[k*(1+max_key_bytes_)+1]), max_key_bytes_ );
-                        missing_keys++;
-                    }
+                    wheel_advance( now );
                 }
 
-                if ( missing_keys == 0 )
+                for ( ; v < budget && wheel_nx_[h] != h ; v++ )
                 {
-                    return 2;  // no key[][]'s are missing to copy from DNODE
+                    unsigned int i = wheel_nx_[h];
+                    DNODE *d = &rdx_.dnodes[i];
+                    int stop = cb( &d->data, (node_handle)i );
+
+                    // not kept by cb with a later expiry time
+                    if ( expire_at_[i] != 0 && expire_at_[i] <= wheel_time_ )
+                    {
+                        remove_dnode( d );
+                        n++;
+                    }
+
+                    if ( stop != 0 )
+                    {
+                        break;
+                    }
                 }
 
-                return 0;
-            }  // keys()
+                return n;
+            }  // expire()
+
+            /*
+             *======================================================================================================================
+             *     expire()
+             *
+             * Purpose:
+             *     expire() as above with no callback
+             *
+             * Usage:
+             *     unsigned long long now;
+             *     int budget;
+             *     int return_code;
+             *
+             *     return_code = rdx->expire(now, budget);
+             *
+             * Returns:
+             *     1. int return_code = n - the number of data nodes removed(0 - budget)
+             *     2. int return_code = -1 - if the object was not constructed with RDX_EXPIRY
+             *
+             * Parameters:
+             *     const unsigned long long now - the current time in the units of set_expiry()
+             *     const int budget             - the maximum number of data nodes removed
+             *
+             * Comments:
+             */
+
+                int
+            expire
+                (
+                    const unsigned long long now,
+                    const int budget
+                )
+            {
+                return expire( now, budget, [](app_data *, node_handle) -> int { return 0; } );
+            }  // expire()
 
             /*
              *======================================================================================================================
@@ -1954,21 +8038,22 @@ namespace MultiKeyRdxPat
              *     return the size in bytes of the trie
              *
              * Usage:
-             *     int bsize;
+             *     size_t bsize;
              *
              *     bsize = rdx->bsize();
              *
              * Returns:
-             *     1. int bsize = rdx_.bsize - the size in bytes of the trie
+             *     1. size_t bsize = rdx_.bsize - the size in bytes of the trie
              *
              * Parameters:
              *     None
              *
              * Comments:
-             *     rdx trie size in bytes - includes all data and branch nodes including the root node
+             *     rdx trie size in bytes - includes all data and branch nodes including the root node.  the size is
+             *     64 bit on 64 bit hosts - a trie may be larger than 4 GB.
              */
 
-                int
+                size_t
             bsize
                 (
                 ) const
@@ -2045,1225 +8130,2178 @@ namespace MultiKeyRdxPat
              * Usage:
              *     int max_key_bytes;
              *
-             *     max_key_bytes = rdx->max_key_bytes();
+             *     max_key_bytes = rdx->max_key_bytes();
+             *
+             * Returns:
+             *     1. int max_key_bytes = max_key_bytes_ - the maximum number of bytes in any of the num_keys_ keys
+             *
+             * Parameters:
+             *     None
+             *
+             * Comments:
+             */
+
+                int
+            max_key_bytes
+                (
+                ) const
+            {
+               return max_key_bytes_;
+            }  // max_key_bytes()
+
+            /*
+             *======================================================================================================================
+             *     get_allocator()
+             *
+             * Purpose: 
+             *     return a copy of the allocator the object was constructed with
+             *
+             * Usage:
+             *     std::allocator<unsigned char> al;
+             *
+             *     al = rdx->get_allocator();
+             *
+             * Returns:
+             *     1. allocator al - the constructor ALLOC argument
+             *
+             * Parameters:
+             *     None
+             *
+             * Comments:
+             *     1. all the storage of the trie - branch nodes, data nodes, keys and the optional order statistic, expiry
+             *        and eviction arrays - is one allocation made by the constructor.  with an allocator other than
+             *        std::allocator<unsigned char> it is allocated from the allocator, rebound to std::max_align_t for
+             *        alignment, and zeroed, e.g. MKRdxPat<app_data, std::pmr::polymorphic_allocator<unsigned char> > to place
+             *        the trie in a std::pmr::memory_resource.  the default allocator uses calloc().
+             *
+             *     2. chg_max_rdx_nodes(), set_union() and set_intersection() construct their new trie with the allocator of
+             *        the originating trie.
+             */
+
+                allocator
+            get_allocator
+                (
+                ) const
+            {
+               return alloc_;
+            }  // get_allocator()
+
+            /*
+             *======================================================================================================================
+             *     chg_max_rdx_nodes()
+             *
+             * Purpose: 
+             *     create a new copy object of type MKRdxPat<app_data> with a new max_rdx_nodes_ and the same copied data.
+             *     the new max_rdx_nodes_ value may be equal to the number of currently allocated nodes or larger.  thus, the
+             *     new object can be shrunk to the size of the current number of allocated data nodes or expanded without limit.  
+             *
+             * Usage:
+             *     unsigned int new_max_rdx_nodes;
+             *
+             *     MKRdxPat<app_data> *rdx_new = rdx_old->chg_max_rdx_nodes(new_max_rdx_nodes);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data> *rdx_new - object of type MKRdxPat<app_data> containing the same data as the
+             *                                      originating object with a new size limit
+             *     2. MKRdxPat<app_data> *NULL - if new_max_rdx_nodes is less than the number of currently allocated nodes
+             *     3. MKRdxPat<app_data> *NULL - if any transfer of a data node from the originating MKRdxPat<app_data> object
+             *                                   to the new MKRdxPat<app_data> object fails
+             *
+             * Parameters:
+             *     const unsigned int new_max_rdx_nodes - the new size, max_rdx_nodes_, of the returned object
+             *
+             * Comments:
+             *     1. the originating object is not affected in any way
+             *
+             *     2. the set_expiry() times of the data nodes are kept
+             *
+             *     3. the app_data of each data node is copy constructed into the new object.  the originating object keeps
+             *        its app_data until it is deleted.
+             *
+             *     4. the key index tries of the new object are built bottom up as bulk_load() builds them.  identical keys
+             *        of a non-unique key index are listed in the same order as in the originating object, thus, search()
+             *        finds the same data node in both.
+             */
+
+                MKRdxPat<app_data, allocator> *
+            chg_max_rdx_nodes
+                (
+                    const unsigned int new_max_rdx_nodes
+                ) const
+            {
+                if ( new_max_rdx_nodes < rdx_.alloc_nodes )
+                {
+                    return NULL;
+                }
+
+                MKRdxPat<app_data, allocator> *rdx = new MKRdxPat<app_data, allocator>(new_max_rdx_nodes, num_keys_, max_key_bytes_,
+                                                                                       options(), nonunique_, alloc_);
+
+                rdx->wheel_time_ = wheel_time_;
+
+                vector<const DNODE *> srcs;   // the allocated data nodes of the originating object
+                vector<unsigned int> order;   // list_order() of the originating object
+                vector<unsigned int> rank;    // rank[i*num_keys_+k] - the list position of srcs[i] in key index k
+                vector<DNODE *> dnodeps;      // dnodeps[i] - the copy of srcs[i] in the new object
+
+
+                list_order(order);
+
+                // the allocated data nodes of the originating object - not node 0 because this is the impossible root node
+                // which will already be in the new object upon creation
+                srcs.reserve(rdx_.alloc_nodes);
+                rank.reserve( (size_t)rdx_.alloc_nodes*num_keys_ );
+                for ( unsigned int node = 1 ; node < dfresh_ ; node++ )
+                {
+                    // alloc=0 node not allocated, alloc=1 node allocated
+                    if ( rdx_.dnodes[node].alloc == 1 )
+                    {
+                        srcs.push_back( &rdx_.dnodes[node] );
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            rank.push_back( order[(size_t)k*(max_rdx_nodes_+1) + node] );
+                        }
+                    }
+                }
+
+                // copy the data nodes and build the new object bottom up - identical keys of a non-unique key index keep
+                // their list order
+                if ( rdx->copy_dnodes(srcs, rank, dnodeps) != 0 )
+                {
+                    delete rdx;
+                    return NULL;
+                }
+
+                for ( size_t i = 0 ; i < srcs.size() ; i++ )
+                {
+                    // keep the expiry time
+                    if ( expiry_ && expire_at_[srcs[i]->nsn] != 0 )
+                    {
+                        rdx->set_expiry( dnodeps[i]->nsn, expire_at_[srcs[i]->nsn] );
+                    }
+
+                    // keep the CLOCK reference bit
+                    if ( evict_ )
+                    {
+                        rdx->clock_ref_[dnodeps[i]->nsn] = clock_ref_[srcs[i]->nsn];
+                    }
+                }
+
+                return rdx;
+            }  // chg_max_rdx_nodes()
+
+            /*
+             *======================================================================================================================
+             *     diff()
+             *
+             * Purpose:
+             *     compare the key index k keys of the data nodes of trie a and trie b, e.g. two routing table snapshots, and
+             *     call on_removed for every data node with a key only in a, on_added for every data node with a key only in b
+             *     and on_both for every pair of data nodes with the same key, in key ascending order.  the two tries are
+             *     walked once in lockstep by their branch bits - no sort() and no search() of either trie.  a subtree whose
+             *     keys are all absent from the other trie is found from one key and walked with no further key compares.
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     int return_code;
+             *
+             *     return_code = MKRdxPat<app_data>::diff(rdx_a, rdx_b, k,
+             *                       [&](app_data *b_datap, const unsigned char *key) -> int { return 0; },   // on_added
+             *                       [&](app_data *a_datap, const unsigned char *key) -> int { return 0; },   // on_removed
+             *                       [&](app_data *a_datap, app_data *b_datap, const unsigned char *key) -> int
+             *                       {
+             *                           return 0;  // on_both - 0 continue, !0 stop
+             *                       });
+             *
+             * Returns:
+             *     1. int return_code = n - the number of data nodes on_added and on_removed were called for
+             *     2. int return_code = -1 - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *     3. int return_code = -2 - if a and b differ in NUM_KEYS or MAX_KEY_BYTES
+             *
+             * Parameters:
+             *     MKRdxPat<app_data> *a       - the first(old) trie
+             *     MKRdxPat<app_data> *b       - the second(new) trie
+             *     const int k                 - key index(0 - NUM_KEYS-1) compared
+             *     added_callback on_added     - function, function object or lambda called as
+             *                                   int on_added(app_data *b_datap, const unsigned char *key) for a data node of b
+             *     removed_callback on_removed - function, function object or lambda called as
+             *                                   int on_removed(app_data *a_datap, const unsigned char *key) for a data node of a
+             *     both_callback on_both       - function, function object or lambda called as
+             *                                   int on_both(app_data *a_datap, app_data *b_datap, const unsigned char *key)
+             *
+             *     key is the MAX_KEY_BYTES key bytes of key index k.  each callback returns 0 to continue and !0 to stop the
+             *     walk.
+             *
+             * Comments:
+             *     1. the callbacks must not insert() or remove() data nodes of a or b.
+             *
+             *     2. the two tries share no nodes, thus, the data nodes with keys in both are still visited once each.  the
+             *        cost is one step per data node of a and b rather than the sort()s and merge of both tries.
+             *
+             *     3. in a non-unique key index the data nodes sharing a key are paired in list order - the data nodes left
+             *        over are added or removed.
+             *
+             *     4. the count returned includes the data node for which a callback returned !0.
+             */
+
+                template <typename added_callback, typename removed_callback, typename both_callback>
+                static int
+            diff
+                (
+                    MKRdxPat<app_data, allocator> *a,
+                    MKRdxPat<app_data, allocator> *b,
+                    const int k,
+                    added_callback on_added,
+                    removed_callback on_removed,
+                    both_callback on_both
+                )
+            {
+                int n = 0;  // number of data nodes added or removed
+
+
+                if ( k < 0 || k > a->num_keys_-1 )
+                {
+                    return -1;
+                }
+
+                if ( a->num_keys_ != b->num_keys_ || a->max_key_bytes_ != b->max_key_bytes_ )
+                {
+                    return -2;
+                }
+
+                auto visit = [&](DNODE *da, DNODE *db) -> int
+                {
+                    if ( da == NULL )
+                    {
+                        n++;
+                        return on_added( &db->data, (const unsigned char *)&db->key[k*(1+a->max_key_bytes_)+1] );
+                    }
+
+                    if ( db == NULL )
+                    {
+                        n++;
+                        return on_removed( &da->data, (const unsigned char *)&da->key[k*(1+a->max_key_bytes_)+1] );
+                    }
+
+                    return on_both( &da->data, &db->data, (const unsigned char *)&da->key[k*(1+a->max_key_bytes_)+1] );
+                };
+
+                diff_tries(a, b, k, visit);
+
+                return n;
+            }  // diff()
+
+            /*
+             *======================================================================================================================
+             *     set_union()
+             *
+             * Purpose:
+             *     create a new object of type MKRdxPat<app_data> with a copy of every data node of trie a and of every data
+             *     node of trie b whose key index k key is not in a, e.g. merge per-peer routing tables.  the data nodes are
+             *     found with the lockstep walk of diff() and the new trie is built bottom up as bulk_load() builds it.
+             *
+             * Usage:
+             *     MKRdxPat<app_data> *rdx_new = MKRdxPat<app_data>::set_union(rdx_a, rdx_b, k);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data> *rdx_new - the new object of a's MAX_RDX_NODES plus b's MAX_RDX_NODES data nodes and
+             *                                      a's constructor options
+             *     2. MKRdxPat<app_data> *NULL - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *     3. MKRdxPat<app_data> *NULL - if a and b differ in NUM_KEYS or MAX_KEY_BYTES
+             *     4. MKRdxPat<app_data> *NULL - if two of the data nodes have the same key in another unique key index
+             *
+             * Parameters:
+             *     MKRdxPat<app_data> *a - the first trie - its data node is copied for a key in both tries
+             *     MKRdxPat<app_data> *b - the second trie
+             *     const int k           - key index(0 - NUM_KEYS-1) compared
+             *
+             * Comments:
+             *     1. tries a and b are not affected in any way
+             *
+             *     2. the set_expiry() times of the data nodes are not copied
+             *
+             *     3. identical keys of a non-unique key index are listed in their order in trie a followed by those of trie
+             *        b in their order in trie b
+             */
+
+                static MKRdxPat<app_data, allocator> *
+            set_union
+                (
+                    MKRdxPat<app_data, allocator> *a,
+                    MKRdxPat<app_data, allocator> *b,
+                    const int k
+                )
+            {
+                if ( k < 0 || k > a->num_keys_-1 || a->num_keys_ != b->num_keys_ || a->max_key_bytes_ != b->max_key_bytes_ )
+                {
+                    return NULL;
+                }
+
+                return merge_tries(a, b, k, a->max_rdx_nodes_ + b->max_rdx_nodes_, false);
+            }  // set_union()
+
+            /*
+             *======================================================================================================================
+             *     set_intersection()
+             *
+             * Purpose:
+             *     create a new object of type MKRdxPat<app_data> with a copy of every data node of trie a whose key index k
+             *     key is also in trie b, e.g. the routes common to two routing table snapshots.  the data nodes are found
+             *     with the lockstep walk of diff() and the new trie is built bottom up as bulk_load() builds it.
+             *
+             * Usage:
+             *     MKRdxPat<app_data> *rdx_new = MKRdxPat<app_data>::set_intersection(rdx_a, rdx_b, k);
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data> *rdx_new - the new object of the smaller of a's and b's MAX_RDX_NODES data nodes and
+             *                                      a's constructor options
+             *     2. MKRdxPat<app_data> *NULL - if k, the key index, is out of range(0 - NUM_KEYS-1)
+             *     3. MKRdxPat<app_data> *NULL - if a and b differ in NUM_KEYS or MAX_KEY_BYTES
+             *
+             * Parameters:
+             *     MKRdxPat<app_data> *a - the first trie - its data nodes are copied
+             *     MKRdxPat<app_data> *b - the second trie
+             *     const int k           - key index(0 - NUM_KEYS-1) compared
+             *
+             * Comments:
+             *     1. tries a and b are not affected in any way
+             *
+             *     2. the set_expiry() times of the data nodes are not copied
+             *
+             *     3. identical keys of a non-unique key index are listed in their order in trie a
+             */
+
+                static MKRdxPat<app_data, allocator> *
+            set_intersection
+                (
+                    MKRdxPat<app_data, allocator> *a,
+                    MKRdxPat<app_data, allocator> *b,
+                    const int k
+                )
+            {
+                if ( k < 0 || k > a->num_keys_-1 || a->num_keys_ != b->num_keys_ || a->max_key_bytes_ != b->max_key_bytes_ )
+                {
+                    return NULL;
+                }
+
+                return merge_tries(a, b, k, std::min(a->max_rdx_nodes_, b->max_rdx_nodes_), true);
+            }  // set_intersection()
+
+            /*
+             *======================================================================================================================
+             *     print()
+             *
+             * Purpose: 
+             *     Used in two modes:
+             *         a. the first arg is NULL
+             *
+             *            print all the data in branch and data nodes for the entire trie.  for each data node allocated there
+             *            will be NUM_KEYS new branch nodes allocated.  thus, for n data nodes allocated, there will be n*NUM_KEYS
+             *            branch nodes printed and n data nodes printed.  the path along branch nodes to data nodes is not
+             *            demonstrated.  useful only for small tries for debugging purposes.
+             *
+             *         b. the first arg is an array of 'unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]' of an existing allocated
+             *            data node
+             *
+             *            print the data node and each branch node for each key(1 - NUM_KEYS) that leads to the found data node.
+             *            the application data is not printed, only the trie structure data.
+             *
+             *     Setting 'unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]':
+             *
+             *     the second subscript first byte for all keys(key[k][0]) is the key boolean.  the key boolean should be set to
+             *     1(use the key) or 0(do not use key).  the actual key bytes(key[k][1 to MAX_KEY_BYTES]) follow the key boolean.
+             *     thus, 1 to NUM_KEYS keys may be used.  only one key is necessary to find the data node.  each key must be unique
+             *     within it's key index(0 - NUM_KEYS-1).
+             *
+             * Usage:
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     ofstream& os;
+             *     int return_code;
+             *
+             *     return_code = rdx->print(NULL, os);
+             *     return_code = rdx->print((unsigned char *)key, os);
              *
              * Returns:
-             *     1. int max_key_bytes = max_key_bytes_ - the maximum number of bytes in any of the num_keys_ keys
+             *     1. return_code = 0 - on success
+             *     2. return_code = 1 - if data node for key[][] not found
              *
              * Parameters:
-             *     None
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     ofstream& os                                       - output stream
              *
              * Comments:
-             */
-
-                int
-            max_key_bytes
-                (
-                ) const
-            {
-               return max_key_bytes_;
-            }  // max_key_bytes()
-
-            /*
-             *======================================================================================================================
-             *     chg_max_rdx_nodes()
-             *
-             * Purpose: 
-             *     create a new copy object of type MKRdxPat<app_data> with a new max_rdx_nodes_ and the same copied data.
-             *     the new max_rdx_nodes_ value may be equal to the number of currently allocated nodes or larger.  thus, the
-             *     new object can be shrunk to the size of the current number of allocated data nodes or expanded without limit.  
-             *
-             * Usage:
-             *     unsigned int new_max_rdx_nodes;
+             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
              *
-             *     MKRdxPat<app_data> *rdx_new = rdx_old->chg_max_rdx_nodes(new_max_rdx_nodes);
+             *          example 1:
+             *          in key[][]:
+             *             key number  key
+             *             0           01 aa bb cc dd    
+             *             1           01 ee ee ee ee
+             *             2           01 ff ff ff ff
              *
-             * Returns:
-             *     1. MKRdxPat<app_data> *rdx_new - object of type MKRdxPat<app_data> containing the same data as the
-             *                                      originating object with a new size limit
-             *     2. MKRdxPat<app_data> *NULL - if new_max_rdx_nodes is less than the number of currently allocated nodes
-             *     3. MKRdxPat<app_data> *NULL - if any transfer of a data node from the originating MKRdxPat<app_data> object
-             *                                   to the new MKRdxPat<app_data> object fails
+             *             use all three keys(0,1,2) in the search
              *
-             * Parameters:
-             *     const unsigned int new_max_rdx_nodes - the new size, max_rdx_nodes_, of the returned object
+             *          example 2:
+             *          in key[][]:
+             *             0           00 aa bb cc dd
+             *             1           01 ee ee ee ee
+             *             2           00 ff ff ff ff
              *
-             * Comments:
-             *     1. the originating object is not affected in any way
+             *             use only one key(1) in the search
              */
 
-                MKRdxPat<app_data> *
-            chg_max_rdx_nodes
+                int
+            print
                 (
-                    const unsigned int new_max_rdx_nodes
-                ) const
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    ofstream& os
+                )
             {
-                if ( new_max_rdx_nodes < rdx_.alloc_nodes )
+                //
+                // see private data for definitions
+                //
+                // unsigned char *print_ky_;  // unsigned char print_ky_[1+max_key_bytes_];
+
+                const int TMPSTR_SIZE = 256;
+                char tmpstr[TMPSTR_SIZE];
+
+                BNODE *c;
+                app_data *app_datap;
+
+
+                finish_clear();
+
+                if ( key == NULL )
                 {
-                    return NULL;
+                    os << "==========\n\n"
+                          "print(NULL, os) called with NULL first arg.\n\n"
+                          "print all the data in branch and data nodes for the entire trie.  for each data node allocated there\n"
+                          "will be num_keys_ new branch nodes allocated.  thus, for n data nodes allocated, there will be n*num_keys_\n"
+                          "branch nodes printed and n data nodes printed.  the path along branch nodes to data nodes is not\n"
+                          "demonstrated.  useful only for small tries for debugging purposes.\n\n"
+
+                          "Total nodes allocated: " << rdx_.alloc_nodes << "  Number of keys: " << num_keys_ << "  Key length: " << max_key_bytes_ << "\n\n\n"
+                          "NODE n\n\n"
+                          "Branch Node Format:\n"
+                          "  key = (key index into key array in data node)\n"
+                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
+                          "   id = (node id - 0 = branch node, 1 - data node)\n"
+                          "  bna = (branch node address)\n"
+                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
+                          "    p = (parent address)\n"
+                          "    b = (PATRICIA key bit(0 on right) at which this branch node distinguishes keys)\n"
+                          "    l = (address of left node child)\n"
+                          "    r = (address of right node child)\n"
+                          "\n"
+                          "Data Node Format:\n"
+                          "   id = (node id - 0 = branch node, 1 - data node)\n"
+                          "  dna = (data node address)\n"
+                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
+                          "    p = (parent address)\n"
+                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
+                          "alloc = (0-node not allocated, 1-node allocated)\n"
+                          "key n = (hex key value)\n"
+                          "      .\n"
+                          "      .\n"
+                          "      .\n\n\n";
+
+                    for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                    {
+                        if ( rdx_.dnodes[n].alloc != 1 )
+                        {
+                            continue;
+                        }
+
+                        os << "NODE " << n << "\n\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "  key =", k);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "  nsn =", rdx_.bnodes[n*num_keys_+k].nsn);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   id =", rdx_.bnodes[n*num_keys_+k].id);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "  bna =", (void *)&rdx_.bnodes[n*num_keys_+k]);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   br =", rdx_.bnodes[n*num_keys_+k].br);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    p =", (void *)rdx_.bnodes[n*num_keys_+k].p);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "    b =", rdx_.bnodes[n*num_keys_+k].b);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    l =", (void *)rdx_.bnodes[n*num_keys_+k].l);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    r =", (void *)rdx_.bnodes[n*num_keys_+k].r);
+                            os << tmpstr;
+                        }
+                        os << "\n\n";
+
+                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   id =", rdx_.dnodes[n].id);
+                        os << tmpstr << "\n";
+                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "  dna =", (void *)&rdx_.dnodes[n]);
+                        os << tmpstr << "\n";
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   br =", rdx_.dnodes[n].br[k]);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    p =", (void *)rdx_.dnodes[n].p[k]);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+
+                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "  nsn =", rdx_.dnodes[n].nsn);
+                        os << tmpstr << "\n";
+                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "alloc =", rdx_.dnodes[n].alloc);
+                        os << tmpstr << "\n";
+
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
+                            os << tmpstr;
+                            for ( int b = 0 ; b < max_key_bytes_ ; b++ )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "%02x ", rdx_.dnodes[n].key[k*(1+max_key_bytes_)+b+1]);
+                                os << tmpstr;
+                            }
+                            os << "\n";
+                        }
+
+                        os << "\n";
+                    }
+
+                    return 0;
                 }
+                else
+                {
+                    os << "==========\n\n"
+                          "print(key, os) called with key[][] first arg.\n\n"
+                          "print the data node and each branch node for each key(1-num_keys_) that leads to the found data node.\n"
+                                "the application data is not printed, only the trie structure data.  the number of branch nodes printed\n"
+                                "is indeterminate; it depends on the order of the data node insertion.  as few as one branch node and\n"
+                                "as many as n branch nodes(n being the total number of data nodes already inserted) could be printed.\n\n";
+
+                    os << "Search for data node with key(s)(includes key boolean):\n";
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
+                        os << tmpstr;
+                        for ( int b = 0 ; b < 1+max_key_bytes_ ; b++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%02x ", key[k*(1+max_key_bytes_)+b]);
+                            os << tmpstr;
+                        }
+                        os << "\n";
+                    }
+                    os << "\n";
+
+                    os << "Branch Node Format:\n"
+                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
+                          "   id = (node id - 0 = branch node, 1 - data node)\n"
+                          "  bna = (branch node address)\n"
+                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
+                          "    p = (parent address)\n"
+                          "    b = (PATRICIA key bit(0 on right) at which this branch node distinguishes keys)\n"
+                          "    l = (address of left node child)\n"
+                          "    r = (address of right node child)\n"
+                          "\n"
+                          "Data Node Format:\n"
+                          "   id = (node id - 0 = branch node, 1 - data node)\n"
+                          "  dna = (data node address)\n"
+                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
+                          "    p = (parent address)\n"
+                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
+                          "alloc = (0-node not allocated, 1-node allocated)\n"
+                          "key n = (hex key value)\n"
+                          "      .\n"
+                          "      .\n"
+                          "      .\n\n\n";
 
-                MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(new_max_rdx_nodes, num_keys_, max_key_bytes_);
+                    if ( (app_datap = search(key)) == NULL )
+                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "print():(file %s  line %d): Key not found.\n", __FILE__, __LINE__);
+                        os << tmpstr;
+                        return 1;
+                    }
 
-                // get size of app_data struct
-                int datasize = sizeof( rdx_.dnodes[0].data );
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        // copy key to storage with extra byte for comparison
+                        print_ky_[k*(1+max_key_bytes_)+0] = 0;
+                        memmove( &print_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
 
-                //pointer to app_data struct returned by an insert()
-                app_data *app_datap;
+                        os << "==========\n";
+                        snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
+                        os << tmpstr;
+                        for ( int b = 0 ; b < 1+max_key_bytes_ ; b++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "%02x ", key[k*(1+max_key_bytes_)+b]);
+                            os << tmpstr;
+                        }
+                        os << "\n\n";
 
-                // exception object for throw()'ing calloc() error
-                class MKRdxPatChgMaxRdxNodesExc: public std::exception
-                {
-                    virtual const char* what() const throw()
-                    {
-                        return "MKRdxPat chg_max_rdx_nodes() calloc() failure.";
-                    }
-                } MKRdxPatChgMaxRdxNodesExc;
+                        c = (BNODE *)rdx_.head[k];
+                        while ( c->id == 0 )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "  nsn = %d\n", c->nsn);
+                            os << tmpstr;
+                            snprintf(tmpstr, sizeof(tmpstr), "   id = %d\n", c->id);
+                            os << tmpstr;
+                            snprintf(tmpstr, sizeof(tmpstr), "  bna = %p\n", (void *)c);
+                            os << tmpstr;
+                            snprintf(tmpstr, sizeof(tmpstr), "   br = %d\n", c->br);
+                            os << tmpstr;
+                            snprintf(tmpstr, sizeof(tmpstr), "    p = %p\n", (void *)c->p);
+                            os << tmpstr;
+                            snprintf(tmpstr, sizeof(tmpstr), "    b = %-3d\n", c->b);
+                            os << tmpstr;
+                            snprintf(tmpstr, sizeof(tmpstr), "    l = %p\n", (void *)c->l);
+                            os << tmpstr;
+                            snprintf(tmpstr, sizeof(tmpstr), "    r = %p\n", (void *)c->r);
+                            os << tmpstr;
+                            os << "\n";
 
-                // allocate space for the keys for node insertion into the new object
-                unsigned char *rdx_key = (unsigned char *) calloc( num_keys_ * (1+max_key_bytes_) , sizeof(unsigned char) );
-                if ( rdx_key == NULL )
-                {
-                    throw MKRdxPatChgMaxRdxNodesExc;
-                }
+                            c = ( gbit( print_ky_, c->b ) ) ? (BNODE *)c->r : (BNODE *)c->l;
+                        }
 
-                // loop over all data nodes in the originating MKRdxPat<app_data> object and copy the allocated data nodes.
-                // not node 0 because this is the impossible root node which will already be in the new object upon creation
-                for ( int node = 1, return_code = 0 ; node < 1+max_rdx_nodes_ ; node++ )
-                {
-                    // alloc=0 node not allocated, alloc=1 node allocated
-                    if ( rdx_.dnodes[node].alloc == 1 )
-                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "   id = %d\n", ((DNODE *)c)->id);
+                        os << tmpstr;
+                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18p\n", "  dna =", (void *)c);
+                        os << tmpstr;
                         for ( int k = 0 ; k < num_keys_ ; k++ )
                         {
-                            rdx_key[k*(1+max_key_bytes_)+0] = 1;
-                            memmove( &rdx_key[k*(1+max_key_bytes_)+1], &rdx_.dnodes[node].key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   br =", ((DNODE *)c)->br[k]);
+                            os << tmpstr;
                         }
+                        os << "\n";
 
-                        // insert node with same keys as old object
-                        return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
-                        if ( return_code != 0 )
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
                         {
-                            return NULL;
+                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    p =", (void *)((DNODE *)c)->p[k]);
+                            os << tmpstr;
                         }
+                        os << "\n";
 
-                        // move app_data struct data to new node
-                        memmove(app_datap, &rdx_.dnodes[node].data, datasize );
+                        snprintf(tmpstr, sizeof(tmpstr), "  nsn = %d\n", ((DNODE *)c)->nsn);
+                        os << tmpstr;
+                        snprintf(tmpstr, sizeof(tmpstr), "alloc = %d\n", ((DNODE *)c)->alloc);
+                        os << tmpstr;
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
+                            os << tmpstr;
+                            for ( int b = 0 ; b < 1+max_key_bytes_ ; b++ )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "%02x ", key[k*(1+max_key_bytes_)+b]);
+                                os << tmpstr;
+                            }
+                            os << "\n";
+                        }
+                        os << "\n";
                     }
-                }
 
-                free(rdx_key);
-
-                return rdx;
-            }  // chg_max_rdx_nodes()
+                    return 0;
+                }
+            }  // print()
 
             /*
              *======================================================================================================================
-             *     print()
+             *     verify()
              *
              * Purpose: 
-             *     Used in two modes:
-             *         a. the first arg is NULL
-             *
-             *            print all the data in branch and data nodes for the entire trie.  for each data node allocated there
-             *            will be NUM_KEYS new branch nodes allocated.  thus, for n data nodes allocated, there will be n*NUM_KEYS
-             *            branch nodes printed and n data nodes printed.  the path along branch nodes to data nodes is not
-             *            demonstrated.  useful only for small tries for debugging purposes.
-             *
-             *         b. the first arg is an array of 'unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]' of an existing allocated
-             *            data node
-             *
-             *            print the data node and each branch node for each key(1 - NUM_KEYS) that leads to the found data node.
-             *            the application data is not printed, only the trie structure data.
-             *
-             *     Setting 'unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]':
-             *
-             *     the second subscript first byte for all keys(key[k][0]) is the key boolean.  the key boolean should be set to
-             *     1(use the key) or 0(do not use key).  the actual key bytes(key[k][1 to MAX_KEY_BYTES]) follow the key boolean.
-             *     thus, 1 to NUM_KEYS keys may be used.  only one key is necessary to find the data node.  each key must be unique
-             *     within it's key index(0 - NUM_KEYS-1).
+             *     verify the integrity of a PNODE_ structure.  multiple tests are used to verify the integrity of all branch and
+             *     data node structures.  the input parameter enum VERIFY_MODE may be set to either ERR_CODE, which will
+             *     return an integer error code(1-25) for each of the possible detected errors, or ERR_CODE_PRINT, which will
+             *     return the same numerical error code and print to ofstream& os a text error message and current data
+             *     structure data node addresses/keys and branch node addresses as well.
              *
              * Usage:
-             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
              *     ofstream& os;
              *     int return_code;
              *
-             *     return_code = rdx->print(NULL, os);
-             *     return_code = rdx->print((unsigned char *)key, os);
+             *     return_code = rdx->verify(ERR_CODE, os);
+             *     return_code = rdx->verify(ERR_CODE_PRINT, os);
              *
              * Returns:
-             *     1. return_code = 0 - on success
-             *     2. return_code = 1 - if data node for key[][] not found
+             *     1. return_code = 0 - if no error
+             *     2. return_code = 1-25 - for the various errors
              *
              * Parameters:
-             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
-             *     ofstream& os                                       - output stream
+             *     VERIFY_MODE vm  - enum with possible values (ERR_CODE, ERR_CODE_PRINT)
+             *     ofstream& os    - output stream
              *
              * Comments:
-             *     e.g. set NUM_KEYS=3 and MAX_KEY_BYTES=4
-             *
-             *          example 1:
-             *          in key[][]:
-             *             key number  key
-             *             0           01 aa bb cc dd    
-             *             1           01 ee ee ee ee
-             *             2           01 ff ff ff ff
-             *
-             *             use all three keys(0,1,2) in the search
-             *
-             *          example 2:
-             *          in key[][]:
-             *             0           00 aa bb cc dd
-             *             1           01 ee ee ee ee
-             *             2           00 ff ff ff ff
-             *
-             *             use only one key(1) in the search
+             *     1. all error messages have the verify() file name and line number included
+             *     2. the checks assume unique key indices.  errors may be returned for a trie with data nodes sharing a key in
+             *        a non-unique key index.
              */
 
                 int
-            print
+            verify
                 (
-                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    VERIFY_MODE vm,
                     ofstream& os
                 )
             {
                 //
                 // see private data for definitions
                 //
-                // unsigned char *print_ky_;  // unsigned char print_ky_[1+max_key_bytes_];
+                // unsigned long *verify_bnode_addrs_;       // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
+                // unsigned long *verify_free_bnode_addrs_;  // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
+                // unsigned long *verify_dnode_addrs_;       // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1];
+                // unsigned long *verify_free_dnode_addrs_;  // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1];
+                // unsigned char *verify_dnode_keys_;        // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_];
+                // unsigned long *verify_node_index_;        // unsigned long verify_node_index_[2][max_rdx_nodes_+1];
 
                 const int TMPSTR_SIZE = 256;
                 char tmpstr[TMPSTR_SIZE];
 
-                BNODE *c;
-                app_data *app_datap;
+                const unsigned int FREE = 0;  // array index of free nodes
+                const unsigned int ALLOC = 1;  // array index of allocated nodes
 
+                // verify that the sum of free and allocated nodes is max_rdx_nodes_+1 nodes
+                int tot_free_nodes;  // running total of free nodes
+                int tot_alloc_nodes;  // running total of allocated nodes
 
-                if ( key == NULL )
-                {
-                    os << "==========\n\n"
-                          "print(NULL, os) called with NULL first arg.\n\n"
-                          "print all the data in branch and data nodes for the entire trie.  for each data node allocated there\n"
-                          "will be num_keys_ new branch nodes allocated.  thus, for n data nodes allocated, there will be n*num_keys_\n"
-                          "branch nodes printed and n data nodes printed.  the path along branch nodes to data nodes is not\n"
-                          "demonstrated.  useful only for small tries for debugging purposes.\n\n"
+                BNODE *bhead; // branch node free list head pointer
+                DNODE *dhead; // data node free list head pointer
 
-                          "Total nodes allocated: " << rdx_.alloc_nodes << "  Number of keys: " << num_keys_ << "  Key length: " << max_key_bytes_ << "\n\n\n"
-                          "NODE n\n\n"
-                          "Branch Node Format:\n"
-                          "  key = (key index into key array in data node)\n"
-                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
-                          "   id = (node id - 0 = branch node, 1 - data node)\n"
-                          "  bna = (branch node address)\n"
-                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
-                          "    p = (parent address)\n"
-                          "    b = (PATRICIA key bit(0 on right) at which this branch node distinguishes keys)\n"
-                          "    l = (address of left node child)\n"
-                          "    r = (address of right node child)\n"
-                          "\n"
-                          "Data Node Format:\n"
-                          "   id = (node id - 0 = branch node, 1 - data node)\n"
-                          "  dna = (data node address)\n"
-                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
-                          "    p = (parent address)\n"
-                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
-                          "alloc = (0-node not allocated, 1-node allocated)\n"
-                          "key n = (hex key value)\n"
-                          "      .\n"
-                          "      .\n"
-                          "      .\n\n\n";
 
-                    for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+
+                // link the free nodes above the clear() watermarks into their free lists
+                finish_clear();
+
+                // accumulate all the free and allocated branch and data node addresses, the node indexes on
+                // each free/alloc node and the total number of free and allocated nodes
+                tot_free_nodes = 0;
+                tot_alloc_nodes = 0;
+                for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                {
+                    if ( rdx_.dnodes[n].alloc == 0 )
                     {
-                        if ( rdx_.dnodes[n].alloc != 1 )
+                        verify_node_index_[FREE*(max_rdx_nodes_+1)+tot_free_nodes] = n;
+                        verify_free_dnode_addrs_[tot_free_nodes] = (unsigned long)&rdx_.dnodes[n];
+                        for ( int k = 0 ; k < num_keys_ ; k++ )
                         {
-                            continue;
+                            verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+tot_free_nodes] = (unsigned long)&rdx_.bnodes[n*num_keys_+k];
                         }
 
-                        os << "NODE " << n << "\n\n";
-
+                        tot_free_nodes++;
+                    }
+                    else
+                    {
+                        verify_node_index_[ALLOC*(max_rdx_nodes_+1)+tot_alloc_nodes] = n;
+                        verify_dnode_addrs_[tot_alloc_nodes] = (unsigned long)&rdx_.dnodes[n];
                         for ( int k = 0 ; k < num_keys_ ; k++ )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "  key =", k);
-                            os << tmpstr;
+                            verify_bnode_addrs_[k*(max_rdx_nodes_+1)+tot_alloc_nodes] = (unsigned long)&rdx_.bnodes[n*num_keys_+k];
+                            memmove( &verify_dnode_keys_[(size_t)(k*(max_rdx_nodes_+1)+tot_alloc_nodes)*max_key_bytes_+0], &rdx_.dnodes[n].key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+                                   // verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
                         }
-                        os << "\n";
 
+                        tot_alloc_nodes++;
+                    }
+                }
+
+                // print all of the free/alloc data structure addresses, node indexes and keys
+                if ( vm == ERR_CODE_PRINT )
+                {
+                    os << "return_code = rdx->verify(ERR_CODE_PRINT, os);\n"
+                          "Free Data Node Address(DNA)/Keys and Branch Node Addresses(BNAs)\n"
+                          "node  DNA         BNA(s)  ";
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "key = %-2d  ", k);
+                        os << tmpstr;
+                    }
+                    os << "\n";
+
+                    for ( int n = 0 ; n < tot_free_nodes ; n++ )
+                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "%4ld  %08lx          ", verify_node_index_[FREE*(max_rdx_nodes_+1)+n], verify_free_dnode_addrs_[n]);
+                        os << tmpstr;
                         for ( int k = 0 ; k < num_keys_ ; k++ )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "  nsn =", rdx_.bnodes[n*num_keys_+k].nsn);
+                           snprintf(tmpstr, sizeof(tmpstr), "  %08lx", verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n]);
                             os << tmpstr;
                         }
                         os << "\n";
+                    }
+                    os << "\n";
+
+                    os << "Allocated Data Node Address(DNA)/Keys and Branch Node Addresses(BNAs)\n"
+                          "node  DNA         BNA(s)  ";
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "key = %-2d  ", k);
+                        os << tmpstr;
+                    }
+                    os << "\n";
 
+                    for ( int n = 0 ; n < tot_alloc_nodes ; n++ )
+                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "%4ld  %08lx          ", verify_node_index_[ALLOC*(max_rdx_nodes_+1)+n], verify_dnode_addrs_[n]);
+                        os << tmpstr;
                         for ( int k = 0 ; k < num_keys_ ; k++ )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   id =", rdx_.bnodes[n*num_keys_+k].id);
+                            snprintf(tmpstr, sizeof(tmpstr), "  %08lx", verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]);
                             os << tmpstr;
                         }
                         os << "\n";
 
                         for ( int k = 0 ; k < num_keys_ ; k++ )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "  bna =", (void *)&rdx_.bnodes[n*num_keys_+k]);
+                            snprintf(tmpstr, sizeof(tmpstr), "      key %-2d = ", k);
                             os << tmpstr;
+                            for ( int b = 0 ; b < max_key_bytes_ ; b++ )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "%02x ", verify_dnode_keys_[(size_t)(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]);
+                                os << tmpstr;
+                            }
+                            os << "\n";
                         }
                         os << "\n";
+                    }
+                }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                // check if certain root node values are initialized to zero - there will
+                // be num_keys_ branch nodes and one data node in the root node - these
+                // values should remain permanently invariant at zero
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    if ( rdx_.bnodes[0*num_keys_+k].id != 0 )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   br =", rdx_.bnodes[n*num_keys_+k].br);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 1): Root branch node with non-zero id - %d\n",
+                                __FILE__, __LINE__, rdx_.bnodes[0*num_keys_+k].id);
                             os << tmpstr;
                         }
-                        os << "\n";
+                        return 1;
+                    }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                    if ( rdx_.bnodes[0*num_keys_+k].br != 0 )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    p =", (void *)rdx_.bnodes[n*num_keys_+k].p);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 2): Root branch node with non-zero br - %d\n",
+                                __FILE__, __LINE__, rdx_.bnodes[0*num_keys_+k].br);
                             os << tmpstr;
                         }
-                        os << "\n";
+                        return 2;
+                    }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                    if ( rdx_.bnodes[0*num_keys_+k].p != 0 )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "    b =", rdx_.bnodes[n*num_keys_+k].b);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 3): Root branch node with non-zero p - 0x%08lx\n",
+                                __FILE__, __LINE__, (unsigned long)rdx_.bnodes[0*num_keys_+k].p);
                             os << tmpstr;
                         }
-                        os << "\n";
+                        return 3;
+                    }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                    if ( rdx_.bnodes[0*num_keys_+k].b != (unsigned int)max_key_bytes_*8 )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    l =", (void *)rdx_.bnodes[n*num_keys_+k].l);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 4): Root branch node with b not equal to"
+                                        " max_key_bytes_*8 - %d\n",
+                                __FILE__, __LINE__, rdx_.bnodes[0*num_keys_+k].b);
                             os << tmpstr;
                         }
-                        os << "\n";
+                        return 4;
+                    }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                    if ( rdx_.bnodes[0*num_keys_+k].r != 0 )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    r =", (void *)rdx_.bnodes[n*num_keys_+k].r);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 5): Root branch node with non-zero r - 0x%08lx\n",
+                                __FILE__, __LINE__, (unsigned long)rdx_.bnodes[0*num_keys_+k].r);
                             os << tmpstr;
                         }
-                        os << "\n\n";
+                        return 5;
+                    }
 
-                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   id =", rdx_.dnodes[n].id);
-                        os << tmpstr << "\n";
-                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "  dna =", (void *)&rdx_.dnodes[n]);
-                        os << tmpstr << "\n";
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                    for ( int b = 0 ; b < max_key_bytes_+1 ; b++ )
+                    {
+                        if ( rdx_.dnodes[0].key[k*(1+max_key_bytes_)+b] != 0xff )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   br =", rdx_.dnodes[n].br[k]);
-                            os << tmpstr;
+                            if ( vm == ERR_CODE_PRINT )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 6): Root data node keys not all 0xff\n",
+                                    __FILE__, __LINE__);
+                                os << tmpstr;
+                            }
+                            return 6;
                         }
-                        os << "\n";
+                    }
+                }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                // save data node, free node, branch node and key node address queues(will be unsorted),
+                // total number of free nodes and total number of allocated nodes
+                for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                {
+                    if ( rdx_.dnodes[n].id != 1 )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    p =", (void *)rdx_.dnodes[n].p[k]);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 7): Data node id not 1 in node sequence number %d\n",
+                                __FILE__, __LINE__, n);
                             os << tmpstr;
                         }
-                        os << "\n";
-
-                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "  nsn =", rdx_.dnodes[n].nsn);
-                        os << tmpstr << "\n";
-                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "alloc =", rdx_.dnodes[n].alloc);
-                        os << tmpstr << "\n";
+                        return 7;
+                    }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                    {
+                        if ( rdx_.bnodes[n*num_keys_+k].nsn != (unsigned int)n )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
-                            os << tmpstr;
-                            for ( int b = 0 ; b < max_key_bytes_ ; b++ )
+                            if ( vm == ERR_CODE_PRINT )
                             {
-                                snprintf(tmpstr, sizeof(tmpstr), "%02x ", rdx_.dnodes[n].key[k*(1+max_key_bytes_)+b+1]);
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 8): Branch node sequence number of key index %d"
+                                            " not valid - %d\n",
+                                    __FILE__, __LINE__, k, rdx_.bnodes[n*num_keys_+k].nsn);
                                 os << tmpstr;
                             }
-                            os << "\n";
+                            return 8;
                         }
+                    }
 
-                        os << "\n";
+                    if ( rdx_.dnodes[n].nsn != (unsigned int)n )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 9): Data node sequence number not valid - %d\n",
+                                __FILE__, __LINE__, rdx_.dnodes[n].nsn);
+                            os << tmpstr;
+                        }
+                        return 9;
                     }
 
-                    return 0;
+                    if ( rdx_.dnodes[n].alloc != 0 && rdx_.dnodes[n].alloc != 1 )
+                    {
+                        if ( vm == ERR_CODE_PRINT )
+                        {
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 10): Data node allocated boolean not 0/1"
+                                        " in node sequence number %d\n",
+                                __FILE__, __LINE__, rdx_.dnodes[n].nsn);
+                            os << tmpstr;
+                        }
+                        return 10;
+                    }
                 }
-                else
+
+                // verify that the sum of free and allocated nodes is max_rdx_nodes_+1 nodes
+                if ( (tot_alloc_nodes + tot_free_nodes) != max_rdx_nodes_+1 )
                 {
-                    os << "==========\n\n"
-                          "print(key, os) called with key[][] first arg.\n\n"
-                          "print the data node and each branch node for each key(1-num_keys_) that leads to the found data node.\n"
-                                "the application data is not printed, only the trie structure data.  the number of branch nodes printed\n"
-                                "is indeterminate; it depends on the order of the data node insertion.  as few as one branch node and\n"
-                                "as many as n branch nodes(n being the total number of data nodes already inserted) could be printed.\n\n";
+                    if ( vm == ERR_CODE_PRINT )
+                    {
+                        snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 11): Total allocated nodes(%d) + free nodes(%d)"
+                                    " not equal max_rdx_nodes_+1(%d)\n",
+                            __FILE__, __LINE__, tot_alloc_nodes, tot_free_nodes, max_rdx_nodes_+1);
+                        os << tmpstr;
+                    }
+                    return 11;
+                }
 
-                    os << "Search for data node with key(s)(includes key boolean):\n";
-                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                // verify that the tot_alloc_nodes equals rdx_.alloc_nodes
+                if ( (unsigned int)tot_alloc_nodes != (rdx_.alloc_nodes+1) )
+                {
+                    if ( vm == ERR_CODE_PRINT )
                     {
-                        snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
+                        snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 12): Total allocated nodes(%d)"
+                                    " not equal rdx_.alloc_nodes(%d)\n",
+                            __FILE__, __LINE__, tot_alloc_nodes, rdx_.alloc_nodes);
                         os << tmpstr;
-                        for ( int b = 0 ; b < 1+max_key_bytes_ ; b++ )
-                        {
-                            snprintf(tmpstr, sizeof(tmpstr), "%02x ", key[k*(1+max_key_bytes_)+b]);
-                            os << tmpstr;
-                        }
-                        os << "\n";
                     }
-                    os << "\n";
+                    return 12;
+                }
 
-                    os << "Branch Node Format:\n"
-                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
-                          "   id = (node id - 0 = branch node, 1 - data node)\n"
-                          "  bna = (branch node address)\n"
-                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
-                          "    p = (parent address)\n"
-                          "    b = (PATRICIA key bit(0 on right) at which this branch node distinguishes keys)\n"
-                          "    l = (address of left node child)\n"
-                          "    r = (address of right node child)\n"
-                          "\n"
-                          "Data Node Format:\n"
-                          "   id = (node id - 0 = branch node, 1 - data node)\n"
-                          "  dna = (data node address)\n"
-                          "   br = (left/right branch of parent - 0 = left, 1 = right)\n"
-                          "    p = (parent address)\n"
-                          "  nsn = (node sequence number, 0-max_rdx_nodes_+1)\n"
-                          "alloc = (0-node not allocated, 1-node allocated)\n"
-                          "key n = (hex key value)\n"
-                          "      .\n"
-                          "      .\n"
-                          "      .\n\n\n";
+                // sort data node address queue
+                {
+                    int n = 0;
+                    vector<unsigned long> da;  // verify_dnode_addrs_[n]
+
+                    for ( n = 0 ; n < tot_alloc_nodes ; n++ )
+                    {
+                        // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1]; -> verify_dnode_addrs_[n]
+                        unsigned long ul = verify_dnode_addrs_[n];
+                        da.push_back(ul);
+                    }
+
+                    std::sort( da.begin(), da.end() );
+
+                    n = 0;
+                    for( vector<unsigned long>::iterator it = da.begin(); it != da.end(); ++it )
+                    {
+                        verify_dnode_addrs_[n] = *it;
+                        n++;
+                    }
+                }
+
+                // sort free node address queue
+                {
+                    int n = 0;
+                    vector<unsigned long> fda;  // verify_free_dnode_addrs_[n]
+
+                    for ( n = 0 ; n < tot_free_nodes ; n++ )
+                    {
+                        // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]; -> verify_free_dnode_addrs_[n]
+                        unsigned long ul = verify_free_dnode_addrs_[n];
+                        fda.push_back(ul);
+                    }
+
+                    std::sort( fda.begin(), fda.end() );
 
-                    if ( (app_datap = search(key)) == NULL )
+                    n = 0;
+                    for( vector<unsigned long>::iterator it = fda.begin(); it != fda.end(); ++it )
                     {
-                        snprintf(tmpstr, sizeof(tmpstr), "print():(file %s  line %d): Key not found.\n", __FILE__, __LINE__);
-                        os << tmpstr;
-                        return 1;
+                        verify_free_dnode_addrs_[n] = *it;
+                        n++;
                     }
+                }
 
-                    for ( int k = 0 ; k < num_keys_ ; k++ )
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    // sort key branch node address queue
                     {
-                        // copy key to storage with extra byte for comparison
-                        print_ky_[k*(1+max_key_bytes_)+0] = 0;
-                        memmove( &print_ky_[k*(1+max_key_bytes_)+1], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
+                        int n = 0;
+                        vector<unsigned long> ba;  // verify_bnode_addrs_[]
 
-                        os << "==========\n";
-                        snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
-                        os << tmpstr;
-                        for ( int b = 0 ; b < 1+max_key_bytes_ ; b++ )
+                        for ( n = 0 ; n < tot_alloc_nodes ; n++ )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%02x ", key[k*(1+max_key_bytes_)+b]);
-                            os << tmpstr;
+                            // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
+                            unsigned long ul = verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n];
+                            ba.push_back(ul);
                         }
-                        os << "\n\n";
 
-                        c = (BNODE *)rdx_.head[k];
-                        while ( c->id == 0 )
+                        std::sort( ba.begin(), ba.end() );
+
+                        n = 0;
+                        for( vector<unsigned long>::iterator it = ba.begin(); it != ba.end(); ++it )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "  nsn = %d\n", c->nsn);
-                            os << tmpstr;
-                            snprintf(tmpstr, sizeof(tmpstr), "   id = %d\n", c->id);
-                            os << tmpstr;
-                            snprintf(tmpstr, sizeof(tmpstr), "  bna = %p\n", (void *)c);
-                            os << tmpstr;
-                            snprintf(tmpstr, sizeof(tmpstr), "   br = %d\n", c->br);
-                            os << tmpstr;
-                            snprintf(tmpstr, sizeof(tmpstr), "    p = %p\n", (void *)c->p);
-                            os << tmpstr;
-                            snprintf(tmpstr, sizeof(tmpstr), "    b = %-3d\n", c->b);
-                            os << tmpstr;
-                            snprintf(tmpstr, sizeof(tmpstr), "    l = %p\n", (void *)c->l);
-                            os << tmpstr;
-                            snprintf(tmpstr, sizeof(tmpstr), "    r = %p\n", (void *)c->r);
-                            os << tmpstr;
-                            os << "\n";
+                            verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n] = *it;
+                            n++;
+                        }
+                    }
 
-                            c = ( gbit( print_ky_, c->b ) ) ? (BNODE *)c->r : (BNODE *)c->l;
+                    // sort key free branch node queue
+                    {
+                        int n = 0;
+                        vector<unsigned long> fba;  // verify_free_bnode_addrs_[]
+
+                        for ( n = 0 ; n < tot_free_nodes ; n++ )
+                        {
+                            // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
+                            unsigned long ul = verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n];
+                            fba.push_back(ul);
                         }
 
-                        snprintf(tmpstr, sizeof(tmpstr), "   id = %d\n", ((DNODE *)c)->id);
-                        os << tmpstr;
-                        snprintf(tmpstr, sizeof(tmpstr), "%7s %18p\n", "  dna =", (void *)c);
-                        os << tmpstr;
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        std::sort( fba.begin(), fba.end() );
+
+                        n = 0;
+                        for( vector<unsigned long>::iterator it = fba.begin(); it != fba.end(); ++it )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18d  ", "   br =", ((DNODE *)c)->br[k]);
-                            os << tmpstr;
+                            verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n] = *it;
+                            n++;
                         }
-                        os << "\n";
+                    }
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                    // sort allocated data node keys
+                    {
+                        int n = 0;
+                        vector<string> dk;  // verify_dnode_keys_[]
+
+                        for ( n = 0 ; n < tot_alloc_nodes ; n++ )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "%7s %18p  ", "    p =", (void *)((DNODE *)c)->p[k]);
-                            os << tmpstr;
+                            // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]; -> verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
+                            string s( (char *)(&verify_dnode_keys_[(size_t)(k*(max_rdx_nodes_+1)+n)*max_key_bytes_]), max_key_bytes_);
+                            dk.push_back(s);
                         }
-                        os << "\n";
 
-                        snprintf(tmpstr, sizeof(tmpstr), "  nsn = %d\n", ((DNODE *)c)->nsn);
-                        os << tmpstr;
-                        snprintf(tmpstr, sizeof(tmpstr), "alloc = %d\n", ((DNODE *)c)->alloc);
-                        os << tmpstr;
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        std::sort( dk.begin(), dk.end() );
+
+                        n = 0;
+                        for( vector<string>::iterator it = dk.begin(); it != dk.end(); ++it )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "  key %2d = ", k);
-                            os << tmpstr;
-                            for ( int b = 0 ; b < 1+max_key_bytes_ ; b++ )
+                            (*it).copy( (char *)(&verify_dnode_keys_[(size_t)(k*(max_rdx_nodes_+1)+n)*max_key_bytes_]), max_key_bytes_ );
+                            n++;
+                        }
+                    }
+                }
+
+                // check for multiple nodes with same key in a given key index - in sorted
+                // order identical keys will show up next to each other
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    for ( int n = 0 ; n < tot_alloc_nodes-1 ; n++ )
+                    {
+                        if ( memcmp( &verify_dnode_keys_[(size_t)(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+0], &verify_dnode_keys_[(size_t)(k*(max_rdx_nodes_+1)+n+1)*max_key_bytes_+0], max_key_bytes_ ) == 0 )
+                        {
+                            if ( vm == ERR_CODE_PRINT )
                             {
-                                snprintf(tmpstr, sizeof(tmpstr), "%02x ", key[k*(1+max_key_bytes_)+b]);
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 13): Multiple nodes with same key of key index %d"
+                                            " and key value\n   ",
+                                    __FILE__, __LINE__, k);
                                 os << tmpstr;
+                                for ( int b = 0 ; b < max_key_bytes_ ; b++ )
+                                {
+                                    snprintf(tmpstr, sizeof(tmpstr), "%02x ", verify_dnode_keys_[(size_t)(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]);
+                                    os << tmpstr;
+                                }
+                                os << "\n";
                             }
-                            os << "\n";
+                            return 13;
                         }
-                        os << "\n";
                     }
-
-                    return 0;
                 }
-            }  // print()
-
-            /*
-             *======================================================================================================================
-             *     verify()
-             *
-             * Purpose: 
-             *     verify the integrity of a PNODE_ structure.  multiple tests are used to verify the integrity of all branch and
-             *     data node structures.  the input parameter enum VERIFY_MODE may be set to either ERR_CODE, which will
-             *     return an integer error code(1-25) for each of the possible detected errors, or ERR_CODE_PRINT, which will
-             *     return the same numerical error code and print to ofstream& os a text error message and current data
-             *     structure data node addresses/keys and branch node addresses as well.
-             *
-             * Usage:
-             *     ofstream& os;
-             *     int return_code;
-             *
-             *     return_code = rdx->verify(ERR_CODE, os);
-             *     return_code = rdx->verify(ERR_CODE_PRINT, os);
-             *
-             * Returns:
-             *     1. return_code = 0 - if no error
-             *     2. return_code = 1-25 - for the various errors
-             *
-             * Parameters:
-             *     VERIFY_MODE vm  - enum with possible values (ERR_CODE, ERR_CODE_PRINT)
-             *     ofstream& os    - output stream
-             *
-             * Comments:
-             *     all error messages have the verify() file name and line number included
-             */
-
-                int
-            verify
-                (
-                    VERIFY_MODE vm,
-                    ofstream& os
-                )
-            {
-                //
-                // see private data for definitions
-                //
-                // unsigned long *verify_bnode_addrs_;       // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
-                // unsigned long *verify_free_bnode_addrs_;  // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1];
-                // unsigned long *verify_dnode_addrs_;       // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1];
-                // unsigned long *verify_free_dnode_addrs_;  // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1];
-                // unsigned char *verify_dnode_keys_;        // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_];
-                // unsigned long *verify_node_index_;        // unsigned long verify_node_index_[2][max_rdx_nodes_+1];
-
-                const int TMPSTR_SIZE = 256;
-                char tmpstr[TMPSTR_SIZE];
-
-                const unsigned int FREE = 0;  // array index of free nodes
-                const unsigned int ALLOC = 1;  // array index of allocated nodes
 
-                // verify that the sum of free and allocated nodes is max_rdx_nodes_+1 nodes
-                int tot_free_nodes;  // running total of free nodes
-                int tot_alloc_nodes;  // running total of allocated nodes
+                // walk branch node free list(s) - checking for valid branch node addresses.
+                // if head pointer is NULL then the free node list is empty
+                for ( int k = 0 ; k < num_keys_ ; k++ )
+                {
+                    bhead = (BNODE *)(rdx_.bfree_head[k]);
 
-                BNODE *bhead; // branch node free list head pointer
-                DNODE *dhead; // data node free list head pointer
+                    // walk data node free list
+                    while ( bhead != NULL )
+                    {
+                        void *ptr;
 
+                        // check if current pointer is in free data node list
+                        ptr = std::bsearch(
+                                              (void *)(&bhead),
+                                              (void *)(&verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
+                                              tot_free_nodes,
+                                              sizeof(unsigned long),
+                                              unsigned_long_compare
+                                          );
+                        if ( ptr == NULL )
+                        {
+                            if ( vm == ERR_CODE_PRINT )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 14): Pointer in branch node free list"
+                                            " with key index %d corrupted\n",
+                                    __FILE__, __LINE__, k);
+                                os << tmpstr;
+                            }
+                            return 14;
+                        }
+                        bhead = (BNODE *)(bhead->p);
+                    }
+                }
 
+                // walk data node free list - checking for valid data node addresses.
+                // if head pointer is NULL then the free node list is empty
+                dhead = (DNODE *)(rdx_.dfree_head);
 
-                // accumulate all the free and allocated branch and data node addresses, the node indexes on
-                // each free/alloc node and the total number of free and allocated nodes
-                tot_free_nodes = 0;
-                tot_alloc_nodes = 0;
-                for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                // walk data node free list
+                while ( dhead != NULL )
                 {
-                    if ( rdx_.dnodes[n].alloc == 0 )
-                    {
-                        verify_node_index_[FREE*(max_rdx_nodes_+1)+tot_free_nodes] = n;
-                        verify_free_dnode_addrs_[tot_free_nodes] = (unsigned long)&rdx_.dnodes[n];
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
-                        {
-                            verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+tot_free_nodes] = (unsigned long)&rdx_.bnodes[n*num_keys_+k];
-                        }
+                    void *ptr;
 
-                        tot_free_nodes++;
-                    }
-                    else
+                    // check if current pointer is in free data node list
+                    ptr = std::bsearch(
+                                          (void *)(&dhead),
+                                          (void *)(&verify_free_dnode_addrs_[0]),
+                                          tot_free_nodes,
+                                          sizeof(unsigned long),
+                                          unsigned_long_compare
+                                      );
+                    if ( ptr == NULL )
                     {
-                        verify_node_index_[ALLOC*(max_rdx_nodes_+1)+tot_alloc_nodes] = n;
-                        verify_dnode_addrs_[tot_alloc_nodes] = (unsigned long)&rdx_.dnodes[n];
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        if ( vm == ERR_CODE_PRINT )
                         {
-                            verify_bnode_addrs_[k*(max_rdx_nodes_+1)+tot_alloc_nodes] = (unsigned long)&rdx_.bnodes[n*num_keys_+k];
-                            memmove( &verify_dnode_keys_[(k*(max_rdx_nodes_+1)+tot_alloc_nodes)*max_key_bytes_+0], &rdx_.dnodes[n].key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
-                                   // verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 15): Pointer in data node free list corrupted\n",
+                                __FILE__, __LINE__);
+                            os << tmpstr;
                         }
-
-                        tot_alloc_nodes++;
+                        return 15;
                     }
+                    dhead = (DNODE *)(dhead->nnfp);
                 }
 
-                // print all of the free/alloc data structure addresses, node indexes and keys
-                if ( vm == ERR_CODE_PRINT )
+                // for each allocated node check for valid branch and data node values
+                for ( int n = 0 ; n < tot_alloc_nodes ; n++ )
                 {
-                    os << "return_code = rdx->verify(ERR_CODE_PRINT, os);\n"
-                          "Free Data Node Address(DNA)/Keys and Branch Node Addresses(BNAs)\n"
-                          "node  DNA         BNA(s)  ";
-                    for ( int k = 0 ; k < num_keys_ ; k++ )
-                    {
-                        snprintf(tmpstr, sizeof(tmpstr), "key = %-2d  ", k);
-                        os << tmpstr;
-                    }
-                    os << "\n";
+                    unsigned long ui;
+                    void *ptr, *bptr, *dptr;
 
-                    for ( int n = 0 ; n < tot_free_nodes ; n++ )
-                    {
-                        snprintf(tmpstr, sizeof(tmpstr), "%4ld  %08lx          ", verify_node_index_[FREE*(max_rdx_nodes_+1)+n], verify_free_dnode_addrs_[n]);
-                        os << tmpstr;
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
-                        {
-                           snprintf(tmpstr, sizeof(tmpstr), "  %08lx", verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n]);
-                            os << tmpstr;
-                        }
-                        os << "\n";
-                    }
-                    os << "\n";
 
-                    os << "Allocated Data Node Address(DNA)/Keys and Branch Node Addresses(BNAs)\n"
-                          "node  DNA         BNA(s)  ";
                     for ( int k = 0 ; k < num_keys_ ; k++ )
                     {
-                        snprintf(tmpstr, sizeof(tmpstr), "key = %-2d  ", k);
-                        os << tmpstr;
-                    }
-                    os << "\n";
-
-                    for ( int n = 0 ; n < tot_alloc_nodes ; n++ )
-                    {
-                        snprintf(tmpstr, sizeof(tmpstr), "%4ld  %08lx          ", verify_node_index_[ALLOC*(max_rdx_nodes_+1)+n], verify_dnode_addrs_[n]);
-                        os << tmpstr;
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        // check if bad branch node id
+                        if ( rdx_.bnodes[n*num_keys_+k].id != 0 )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "  %08lx", verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]);
-                            os << tmpstr;
+                            if ( vm == ERR_CODE_PRINT )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 16): Branch node id at key index %d and node %d not"
+                                            " valid - %d\n",
+                                    __FILE__, __LINE__, k, n, rdx_.bnodes[n*num_keys_+k].id);
+                                os << tmpstr;
+                            }
+                            return 16;
                         }
-                        os << "\n";
 
-                        for ( int k = 0 ; k < num_keys_ ; k++ )
+                        // check if bad parent branch indicator
+                        if ( rdx_.bnodes[n*num_keys_+k].br != 0 && rdx_.bnodes[n*num_keys_+k].br != 1 )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "      key %-2d = ", k);
-                            os << tmpstr;
-                            for ( int b = 0 ; b < max_key_bytes_ ; b++ )
+                            if ( vm == ERR_CODE_PRINT )
                             {
-                                snprintf(tmpstr, sizeof(tmpstr), "%02x ", verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]);
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 17): Branch node parent branch boolean of key index %d"
+                                            " and node %d not valid - %d\n",
+                                    __FILE__, __LINE__, k, n, rdx_.bnodes[n*num_keys_+k].br);
                                 os << tmpstr;
                             }
-                            os << "\n";
+                            return 17;
                         }
-                        os << "\n";
-                    }
-                }
 
-                // check if certain root node values are initialized to zero - there will
-                // be num_keys_ branch nodes and one data node in the root node - these
-                // values should remain permanently invariant at zero
-                for ( int k = 0 ; k < num_keys_ ; k++ )
-                {
-                    if ( rdx_.bnodes[0*num_keys_+k].id != 0 )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
+                        // check if branch node parent pointers are valid - the root node(i=0) will not have a parent
+                        if ( n != 0 )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 1): Root branch node with non-zero id - %d\n",
-                                __FILE__, __LINE__, rdx_.bnodes[0*num_keys_+k].id);
-                            os << tmpstr;
+                            ui = (unsigned long)rdx_.bnodes[n*num_keys_+k].p;
+                            ptr = std::bsearch(
+                                                  (void *)(&ui),
+                                                  (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
+                                                  tot_alloc_nodes,
+                                                  sizeof(unsigned long),
+                                                  unsigned_long_compare
+                                              );
+                            if ( ptr == NULL )
+                            {
+                                if ( vm == ERR_CODE_PRINT )
+                                {
+                                    snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 18): Branch node parent pointer of key index %d"
+                                                " and node %d corrupted\n",
+                                        __FILE__, __LINE__, k, n);
+                                    os << tmpstr;
+                                }
+                                return 18;
+                            }
                         }
-                        return 1;
-                    }
 
-                    if ( rdx_.bnodes[0*num_keys_+k].br != 0 )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
+                        // check if PATRICIA algorithm branch test bit number is valid
+                        if ( rdx_.bnodes[n*num_keys_+k].b > (unsigned int)max_key_bytes_*8 )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 2): Root branch node with non-zero br - %d\n",
-                                __FILE__, __LINE__, rdx_.bnodes[0*num_keys_+k].br);
-                            os << tmpstr;
+                            if ( vm == ERR_CODE_PRINT )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 19): Branch node bit number branch test value of"
+                                            " key index %d and node %d not valid - %d\n",
+                                    __FILE__, __LINE__, k, n, rdx_.bnodes[n*num_keys_+k].b);
+                                os << tmpstr;
+                            }
+                            return 19;
                         }
-                        return 2;
-                    }
 
-                    if ( rdx_.bnodes[0*num_keys_+k].p != 0 )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
+                        // check if left child pointer is another branch or data node
+                        ui = (unsigned long)rdx_.bnodes[n*num_keys_+k].l;
+                        bptr = std::bsearch(
+                                               (void *)(&ui),
+                                               (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
+                                               tot_alloc_nodes,
+                                               sizeof(unsigned long),
+                                               unsigned_long_compare
+                                           );
+                        dptr = std::bsearch(
+                                               (void *)(&ui),
+                                               (void *)(&verify_dnode_addrs_[0]),
+                                               tot_alloc_nodes,
+                                               sizeof(unsigned long),
+                                               unsigned_long_compare
+                                           );
+                        if ( bptr == NULL && dptr == NULL )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 3): Root branch node with non-zero p - 0x%08lx\n",
-                                __FILE__, __LINE__, (unsigned long)rdx_.bnodes[0*num_keys_+k].p);
-                            os << tmpstr;
+                            if ( vm == ERR_CODE_PRINT )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 20): Branch node left pointer of key index %d"
+                                            " and node %d corrupted\n",
+                                    __FILE__, __LINE__, k, n);
+                                os << tmpstr;
+                            }
+                            return 20;
                         }
-                        return 3;
-                    }
 
-                    if ( rdx_.bnodes[0*num_keys_+k].b != (unsigned int)max_key_bytes_*8 )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
+                        // check if right child pointer is another branch or data node
+                        // - the root node(i=0) will not have a right child
+                        if ( n != 0 )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 4): Root branch node with b not equal to"
-                                        " max_key_bytes_*8 - %d\n",
-                                __FILE__, __LINE__, rdx_.bnodes[0*num_keys_+k].b);
-                            os << tmpstr;
+                            ui = (unsigned long)rdx_.bnodes[n*num_keys_+k].r;
+                            bptr = std::bsearch(
+                                                   (void *)(&ui),
+                                                   (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
+                                                   tot_alloc_nodes,
+                                                   sizeof(unsigned long),
+                                                   unsigned_long_compare
+                                               );
+                            dptr = std::bsearch(
+                                                   (void *)(&ui),
+                                                   (void *)(&verify_dnode_addrs_[0]),
+                                                   tot_alloc_nodes,
+                                                   sizeof(unsigned long),
+                                                   unsigned_long_compare
+                                               );
+                            if ( bptr == NULL && dptr == NULL )
+                            {
+                                if ( vm == ERR_CODE_PRINT )
+                                {
+                                    snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 21): Branch node right pointer of key index %d"
+                                                " and node %d corrupted\n",
+                                        __FILE__, __LINE__, k, n);
+                                    os << tmpstr;
+                                }
+                                return 21;
+                            }
                         }
-                        return 4;
-                    }
 
-                    if ( rdx_.bnodes[0*num_keys_+k].r != 0 )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
+                        // check if data node parent pointers are all valid branch node addresses
+                        ui = (unsigned long)rdx_.dnodes[n].p[k];
+                        ptr = std::bsearch(
+                                              (void *)(&ui),
+                                              (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
+                                              tot_alloc_nodes,
+                                              sizeof(unsigned long),
+                                              unsigned_long_compare
+                                          );
+                        if ( ptr == NULL )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 5): Root branch node with non-zero r - 0x%08lx\n",
-                                __FILE__, __LINE__, (unsigned long)rdx_.bnodes[0*num_keys_+k].r);
-                            os << tmpstr;
+                            if ( vm == ERR_CODE_PRINT )
+                            {
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 22): Data node parent pointer of key index %d"
+                                            " and node %d corrupted\n",
+                                    __FILE__, __LINE__, k, n);
+                                os << tmpstr;
+                            }
+                            return 22;
                         }
-                        return 5;
-                    }
 
-                    for ( int b = 0 ; b < max_key_bytes_+1 ; b++ )
-                    {
-                        if ( rdx_.dnodes[0].key[k*(1+max_key_bytes_)+b] != 0xff )
+                        // check if all data node parent branch indicators are valid
+                        if ( rdx_.dnodes[n].br[k] != 0 && rdx_.dnodes[n].br[k] != 1 )
                         {
                             if ( vm == ERR_CODE_PRINT )
                             {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 6): Root data node keys not all 0xff\n",
-                                    __FILE__, __LINE__);
+                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 23): Data node parent branch boolean of key index %d and"
+                                            " node %d not valid - %d\n",
+                                    __FILE__, __LINE__, k, n, rdx_.dnodes[n].br[k]);
                                 os << tmpstr;
                             }
-                            return 6;
+                            return 23;
                         }
                     }
                 }
 
-                // save data node, free node, branch node and key node address queues(will be unsorted),
-                // total number of free nodes and total number of allocated nodes
-                for ( int n = 0 ; n < max_rdx_nodes_+1 ; n++ )
+                // retrieve all keys from all data nodes and use normal search(rdx->search())
+                // to find them - ignore root node keys
+
+                // exception object for throw()'ing calloc() error
+                class MKRdxPatVerifyExc: public std::exception
                 {
-                    if ( rdx_.dnodes[n].id != 1 )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
-                        {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 7): Data node id not 1 in node sequence number %d\n",
-                                __FILE__, __LINE__, n);
-                            os << tmpstr;
-                        }
-                        return 7;
+                    virtual const char* what() const throw()
+                    {
+                        return "MKRdxPat verify() calloc() failure.";
                     }
+                } MKRdxPatVerifyExc;
+
+                // unsigned char key[num_keys_][1+max_key_bytes_]
+                unsigned char *key = (unsigned char *)calloc( num_keys_ * (1+max_key_bytes_), sizeof(unsigned char) );
+                if ( key == NULL )
+                {
+                    throw MKRdxPatVerifyExc;
+                }
+
+                for ( int n = 1 ; n < tot_alloc_nodes ; n++ )
+                {
+                    app_data *app_datap;
 
+
+                    // get data node keys directly from allocated data node
                     for ( int k = 0 ; k < num_keys_ ; k++ )
                     {
-                        if ( rdx_.bnodes[n*num_keys_+k].nsn != (unsigned int)n )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 8): Branch node sequence number of key index %d"
-                                            " not valid - %d\n",
-                                    __FILE__, __LINE__, k, rdx_.bnodes[n*num_keys_+k].nsn);
-                                os << tmpstr;
-                            }
-                            return 8;
-                        }
+                        key[k*(1+max_key_bytes_)+0] = 1;
+                        memmove( &key[k*(1+max_key_bytes_)+1], &rdx_.dnodes[n].key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
                     }
 
-                    if ( rdx_.dnodes[n].nsn != (unsigned int)n )
+                    // search for node n keys
+                    app_datap = search(key);
+
+                    if ( app_datap == NULL )
                     {
                         if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 9): Data node sequence number not valid - %d\n",
-                                __FILE__, __LINE__, rdx_.dnodes[n].nsn);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 24): Data node %d searched for with it's keys not found\n",
+                                __FILE__, __LINE__, n);
                             os << tmpstr;
                         }
-                        return 9;
+                        return 24;
                     }
 
-                    if ( rdx_.dnodes[n].alloc != 0 && rdx_.dnodes[n].alloc != 1 )
+                    // do full compare of 'app_data data;' obtained from rdx->search() and the same data obtained from rdx_.dnodes[n].data.
+                    // if they do not match, error.
+                    if ( memcmp( app_datap, &rdx_.dnodes[n].data, sizeof(app_data) ) != 0 )
                     {
                         if ( vm == ERR_CODE_PRINT )
                         {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 10): Data node allocated boolean not 0/1"
-                                        " in node sequence number %d\n",
-                                __FILE__, __LINE__, rdx_.dnodes[n].nsn);
+                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 25): compare of 'app_data data;' obtained from rdx->search() and"
+                                        " the same data obtained from rdx_.dnodes[%d].data do not match",
+                                __FILE__, __LINE__, n);
                             os << tmpstr;
                         }
-                        return 10;
+                        return 25;
                     }
                 }
+                free(key);
 
-                // verify that the sum of free and allocated nodes is max_rdx_nodes_+1 nodes
-                if ( (tot_alloc_nodes + tot_free_nodes) != max_rdx_nodes_+1 )
-                {
-                    if ( vm == ERR_CODE_PRINT )
-                    {
-                        snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 11): Total allocated nodes(%d) + free nodes(%d)"
-                                    " not equal max_rdx_nodes_+1(%d)\n",
-                            __FILE__, __LINE__, tot_alloc_nodes, tot_free_nodes, max_rdx_nodes_+1);
-                        os << tmpstr;
-                    }
-                    return 11;
-                }
+                return 0;
+            }  // verify()
 
-                // verify that the tot_alloc_nodes equals rdx_.alloc_nodes
-                if ( (unsigned int)tot_alloc_nodes != (rdx_.alloc_nodes+1) )
+            #if MKRDXPAT_SNAPSHOT
+            /*
+             *======================================================================================================================
+             *     save()
+             *
+             * Purpose:
+             *     write a snapshot of the trie to file path - a header recording NUM_KEYS, MAX_KEY_BYTES, the other
+             *     constructor arguments, the layout version, the node sizes and a checksum, followed by an image of the full
+             *     trie storage.  map() makes a trie of the snapshot with no insert() and no parsing.
+             *
+             * Usage:
+             *     int return_code;
+             *
+             *     return_code = rdx->save("routes.snap");
+             *
+             * Returns:
+             *     1. int return_code = 0 - if the snapshot is written
+             *     2. int return_code = -1 - if the temporary file path.tmp cannot be created
+             *     3. int return_code = -2 - if any write or the rename() fails - file path is unchanged
+             *
+             * Parameters:
+             *     const char *path - the snapshot file
+             *
+             * Comments:
+             *     1. app_data must be trivially copyable and should hold no pointers - it is saved as its bytes.
+             *
+             *     2. the snapshot is written to path.tmp and rename()'d to path, thus, a trie map()'ed from path - even
+             *        this one - is not disturbed and path is never a partial snapshot.  the file is the size of the
+             *        trie(bsize()) plus a 64 KB header and up to 64 KB more to keep the image at its offset within a page.
+             */
+
+                int
+            save
+                (
+                    const char *path
+                )
+            {
+                static_assert( std::is_trivially_copyable<app_data>::value, "MKRdxPat.hpp: save() needs a trivially copyable app_data" );
+
+                SNAPSHOT h;
+
+
+                memset( &h, 0, sizeof(h) );
+                h.magic = SNAPSHOT_MAGIC;
+                h.version = SNAPSHOT_VERSION;
+                h.bnode_bytes = sizeof(BNODE);
+                h.dnode_bytes = sizeof(DNODE);
+                h.app_data_bytes = sizeof(app_data);
+                h.max_rdx_nodes = max_rdx_nodes_;
+                h.num_keys = num_keys_;
+                h.max_key_bytes = max_key_bytes_;
+                h.num_nonunique = num_nonunique_;
+                h.order_stats = order_stats_;
+                h.expiry = expiry_;
+                h.evict = evict_;
+                h.locality = locality_;
+                h.alloc_nodes = rdx_.alloc_nodes;
+                h.dfresh = dfresh_;
+                h.clock_hand = clock_hand_;
+                h.wheel_time = wheel_time_;
+                h.dfree_head = (uintptr_t)rdx_.dfree_head;
+                h.base = (uintptr_t)free_ptr_;
+                h.bsize = rdx_.bsize;
+                h.checksum = snapshot_sum( (unsigned char *)free_ptr_, rdx_.bsize );
+
+                string tmp = string(path) + ".tmp";
+
+                int fd = open( tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+                if ( fd < 0 )
                 {
-                    if ( vm == ERR_CODE_PRINT )
-                    {
-                        snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 12): Total allocated nodes(%d)"
-                                    " not equal rdx_.alloc_nodes(%d)\n",
-                            __FILE__, __LINE__, tot_alloc_nodes, rdx_.alloc_nodes);
-                        os << tmpstr;
-                    }
-                    return 12;
+                    return -1;
                 }
 
-                // sort data node address queue
+                bool ok = write_all( fd, (unsigned char *)&h, sizeof(h), 0 ) &&
+                          write_all( fd, (unsigned char *)free_ptr_, rdx_.bsize, SNAPSHOT_OFFSET + h.base % SNAPSHOT_OFFSET );
+
+                if ( close( fd ) != 0 || !ok || rename( tmp.c_str(), path ) != 0 )
                 {
-                    int n = 0;
-                    vector<unsigned long> da;  // verify_dnode_addrs_[n]
+                    unlink( tmp.c_str() );
+                    return -2;
+                }
 
-                    for ( n = 0 ; n < tot_alloc_nodes ; n++ )
-                    {
-                        // unsigned long verify_dnode_addrs_[max_rdx_nodes_+1]; -> verify_dnode_addrs_[n]
-                        unsigned long ul = verify_dnode_addrs_[n];
-                        da.push_back(ul);
-                    }
+                return 0;
+            }  // save()
 
-                    std::sort( da.begin(), da.end() );
+            /*
+             *======================================================================================================================
+             *     map()
+             *
+             * Purpose:
+             *     return a new trie of the snapshot file path written by save().  the image of the full trie storage is
+             *     mmap()'ed from the file, thus, the trie may be searched at once and its pages are read from the file as
+             *     they are first touched.  the image is mapped at the address it was saved from if that address is free -
+             *     then nothing in it is read or written until used.  otherwise every link is moved by the difference in
+             *     one pass over the nodes - this reads and writes every page of the image, as load() does.
+             *
+             * Usage:
+             *     MKRdxPat<app_data> *rdx;
+             *
+             *     rdx = MKRdxPat<app_data>::map("routes.snap");
+             *
+             *     ...
+             *
+             *     delete rdx;
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data> *rdx - the trie of the snapshot
+             *     2. MKRdxPat<app_data> *NULL - if file path cannot be opened or mmap()'ed, is not a snapshot of this
+             *                                   layout version, node and app_data sizes, is truncated or fails the checksum
+             *
+             * Parameters:
+             *     const char *path - the snapshot file
+             *     const bool check - true - compare the image with the header checksum first.  this reads the whole file.
+             *
+             * Comments:
+             *     1. the mapping is private.  insert(), remove() and the other changes to the trie are copied on write and
+             *        are not written to file path - save() the trie to keep them.  file path must not be truncated or
+             *        rewritten in place while the trie is in use.  save() rename()'s a new snapshot over it instead.
+             *
+             *     2. the trie is made with the default allocator - chg_max_rdx_nodes(), set_union() and
+             *        set_intersection() of it use it.
+             *
+             *     3. only a map() at the saved address is a warm start.  e.g. a 4,000,000 node trie(1 GB image)
+             *        map()'s in 15 ms at the saved address and in 1.5 s relocated.  the saved address is free in a
+             *        new process with the same memory layout - start it without address space layout randomization to
+             *        be sure of it - and is never free while the saved trie is in use in the same process.
+             */
 
-                    n = 0;
-                    for( vector<unsigned long>::iterator it = da.begin(); it != da.end(); ++it )
-                    {
-                        verify_dnode_addrs_[n] = *it;
-                        n++;
-                    }
-                }
+                static MKRdxPat<app_data, allocator> *
+            map
+                (
+                    const char *path,
+                    const bool check = false
+                )
+            {
+                static_assert( std::is_trivially_copyable<app_data>::value, "MKRdxPat.hpp: map() needs a trivially copyable app_data" );
 
-                // sort free node address queue
-                {
-                    int n = 0;
-                    vector<unsigned long> fda;  // verify_free_dnode_addrs_[n]
+                SNAPSHOT h;
+                struct stat st;
+                void *image;
+                int flags = MAP_PRIVATE;
+                const size_t page = (size_t)sysconf( _SC_PAGESIZE );
 
-                    for ( n = 0 ; n < tot_free_nodes ; n++ )
-                    {
-                        // unsigned long verify_free_dnode_addrs_[max_rdx_nodes_+1]; -> verify_free_dnode_addrs_[n]
-                        unsigned long ul = verify_free_dnode_addrs_[n];
-                        fda.push_back(ul);
-                    }
 
-                    std::sort( fda.begin(), fda.end() );
+                int fd = open( path, O_RDONLY );
+                if ( fd < 0 )
+                {
+                    return NULL;
+                }
 
-                    n = 0;
-                    for( vector<unsigned long>::iterator it = fda.begin(); it != fda.end(); ++it )
-                    {
-                        verify_free_dnode_addrs_[n] = *it;
-                        n++;
-                    }
+                if ( pread( fd, &h, sizeof(h), 0 ) != (ssize_t)sizeof(h) || fstat( fd, &st ) != 0 ||
+                     h.magic != SNAPSHOT_MAGIC || h.version != SNAPSHOT_VERSION || h.bnode_bytes != sizeof(BNODE) ||
+                     h.dnode_bytes != sizeof(DNODE) || h.app_data_bytes != sizeof(app_data) ||
+                     h.bsize == 0 || h.bsize > SIZE_MAX - 2*SNAPSHOT_OFFSET ||
+                     (unsigned long long)st.st_size < SNAPSHOT_OFFSET + h.base % SNAPSHOT_OFFSET + h.bsize ||
+                     page == 0 || SNAPSHOT_OFFSET % page != 0 )
+                {
+                    close( fd );
+                    return NULL;
                 }
 
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+                // the image is lead bytes into the page mapped from file offset off - as far into its page as it was in the
+                // saved trie, thus, the arrays in it are aligned as they were wherever it is mapped
+                const size_t lead = h.base % page;
+                const off_t off = SNAPSHOT_OFFSET + h.base % SNAPSHOT_OFFSET - lead;
+
+                // the address the image was saved from - then no link needs a fix up
+                #ifdef MAP_FIXED_NOREPLACE
+                flags |= MAP_FIXED_NOREPLACE;
+                #endif
+                image = mmap( (void *)(uintptr_t)(h.base - lead), lead + h.bsize, PROT_READ | PROT_WRITE, flags, fd, off );
+                if ( image == MAP_FAILED )
                 {
-                    // sort key branch node address queue
-                    {
-                        int n = 0;
-                        vector<unsigned long> ba;  // verify_bnode_addrs_[]
+                    image = mmap( NULL, lead + h.bsize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, off );
+                }
 
-                        for ( n = 0 ; n < tot_alloc_nodes ; n++ )
-                        {
-                            // unsigned long verify_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
-                            unsigned long ul = verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n];
-                            ba.push_back(ul);
-                        }
+                close( fd );
 
-                        std::sort( ba.begin(), ba.end() );
+                if ( image == MAP_FAILED )
+                {
+                    return NULL;
+                }
 
-                        n = 0;
-                        for( vector<unsigned long>::iterator it = ba.begin(); it != ba.end(); ++it )
-                        {
-                            verify_bnode_addrs_[k*(max_rdx_nodes_+1)+n] = *it;
-                            n++;
-                        }
-                    }
+                if ( check && snapshot_sum( (unsigned char *)image + lead, h.bsize ) != h.checksum )
+                {
+                    munmap( image, lead + h.bsize );
+                    return NULL;
+                }
 
-                    // sort key free branch node queue
-                    {
-                        int n = 0;
-                        vector<unsigned long> fba;  // verify_free_bnode_addrs_[]
+                try
+                {
+                    return new MKRdxPat<app_data, allocator>( h, (unsigned char *)image + lead, lead );
+                }
+                catch ( ... )
+                {
+                    munmap( image, lead + h.bsize );
+                    return NULL;
+                }
+            }  // map()
+            #endif
 
-                        for ( n = 0 ; n < tot_free_nodes ; n++ )
-                        {
-                            // unsigned long verify_free_bnode_addrs_[num_keys_][max_rdx_nodes_+1]; -> verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n]
-                            unsigned long ul = verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n];
-                            fba.push_back(ul);
-                        }
+    };  // class MKRdxPat
 
-                        std::sort( fba.begin(), fba.end() );
+    // many small tries - e.g. one per VRF or tenant - sharing the nodes and free lists of one MKRdxPat pool.  member
+    // trie t is the pool subtree whose keys all start with the trie number t, thus, the group holds as many data nodes
+    // as the pool, however they are spread over the member tries - memory follows the total data nodes, not the sum of
+    // the worst case of each member trie.
+    template <typename app_data, typename allocator = std::allocator<unsigned char> > class MKRdxPatGroup
+    {
+        private:
 
-                        n = 0;
-                        for( vector<unsigned long>::iterator it = fba.begin(); it != fba.end(); ++it )
-                        {
-                            verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+n] = *it;
-                            n++;
-                        }
-                    }
+            // the shared pool - each key index k key is the id_bytes_ byte trie number followed by the member trie key
+            MKRdxPat<app_data, allocator> *pool_;
 
-                    // sort allocated data node keys
-                    {
-                        int n = 0;
-                        vector<string> dk;  // verify_dnode_keys_[]
+            const int max_tries_;      // the number of member tries(0 - max_tries_-1)
+            const int num_keys_;       // the number of keys of a member trie
+            const int max_key_bytes_;  // the number of bytes in each key of a member trie
+            int id_bytes_;             // the number of bytes of the trie number in front of each pool key(1 - 4)
 
-                        for ( n = 0 ; n < tot_alloc_nodes ; n++ )
-                        {
-                            // unsigned char verify_dnode_keys_[num_keys_][max_rdx_nodes_+1][max_key_bytes_]; -> verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]
-                            string s( (char *)(&verify_dnode_keys_[(k*(max_rdx_nodes_+1)+0)*max_key_bytes_+(n*max_key_bytes_)]), max_key_bytes_);
-                            dk.push_back(s);
-                        }
+            // the number of data nodes in each member trie
+            vector<int> counts_;  // int counts_[max_tries_];
 
-                        std::sort( dk.begin(), dk.end() );
+            // the member trie key with the trie number after each key boolean - passed to the pool
+            vector<unsigned char> ky_;  // unsigned char ky_[num_keys_][1+id_bytes_+max_key_bytes_];
 
-                        n = 0;
-                        for( vector<string>::iterator it = dk.begin(); it != dk.end(); ++it )
-                        {
-                            (*it).copy( (char *)(&verify_dnode_keys_[(k*(max_rdx_nodes_+1)+0)*max_key_bytes_+(n*max_key_bytes_)]), max_key_bytes_ );
-                            n++;
-                        }
-                    }
-                }
 
-                // check for multiple nodes with same key in a given key index - in sorted
-                // order identical keys will show up next to each other
+            // copy key - the key[num_keys_][1+max_key_bytes_] of member trie t - to ky_ with the trie number after each
+            // key boolean
+            // used by: insert(), search(), remove()
+                void
+            pool_key
+                (
+                    const int t,
+                    const unsigned char *key
+                )
+            {
                 for ( int k = 0 ; k < num_keys_ ; k++ )
                 {
-                    for ( int n = 0 ; n < tot_alloc_nodes-1 ; n++ )
-                    {
-                        if ( memcmp( &verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+0], &verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n+1)*max_key_bytes_+0], max_key_bytes_ ) == 0 )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 13): Multiple nodes with same key of key index %d"
-                                            " and key value\n   ",
-                                    __FILE__, __LINE__, k);
-                                os << tmpstr;
-                                for ( int b = 0 ; b < max_key_bytes_ ; b++ )
-                                {
-                                    snprintf(tmpstr, sizeof(tmpstr), "%02x ", verify_dnode_keys_[(k*(max_rdx_nodes_+1)+n)*max_key_bytes_+b]);
-                                    os << tmpstr;
-                                }
-                                os << "\n";
-                            }
-                            return 13;
-                        }
-                    }
+                    unsigned char *ky = &ky_[k*(1+id_bytes_+max_key_bytes_)];
+
+                    ky[0] = key[k*(1+max_key_bytes_)+0];
+                    trie_prefix( t, &ky[1] );
+                    memmove( &ky[1+id_bytes_], &key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
                 }
+            }  // pool_key()
 
-                // walk branch node free list(s) - checking for valid branch node addresses.
-                // if head pointer is NULL then the free node list is empty
-                for ( int k = 0 ; k < num_keys_ ; k++ )
+            // the id_bytes_ bytes of trie number t, most significant first - the prefix of each pool key of member trie t
+            // used by: pool_key(), clear(), for_each()
+                void
+            trie_prefix
+                (
+                    const int t,
+                    unsigned char *prefix
+                ) const
+            {
+                for ( int i = 0 ; i < id_bytes_ ; i++ )
                 {
-                    bhead = (BNODE *)(rdx_.bfree_head[k]);
+                    prefix[i] = (unsigned char)( (unsigned int)t >> (8*(id_bytes_-1-i)) );
+                }
+            }  // trie_prefix()
 
-                    // walk data node free list
-                    while ( bhead != NULL )
-                    {
-                        void *ptr;
 
-                        // check if current pointer is in free data node list
-                        ptr = std::bsearch(
-                                              (void *)(&bhead),
-                                              (void *)(&verify_free_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
-                                              tot_free_nodes,
-                                              sizeof(unsigned long),
-                                              unsigned_long_compare
-                                          );
-                        if ( ptr == NULL )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 14): Pointer in branch node free list"
-                                            " with key index %d corrupted\n",
-                                    __FILE__, __LINE__, k);
-                                os << tmpstr;
-                            }
-                            return 14;
-                        }
-                        bhead = (BNODE *)(bhead->p);
-                    }
+        public:
+
+            MKRdxPatGroup( int mt, int mnrn, int nk, int nkb, unsigned int op = 0, const unsigned char *nu = NULL,
+                           const allocator &al = allocator() )
+                : pool_(NULL), max_tries_(mt), num_keys_(nk), max_key_bytes_(nkb)
+            {
+                // expire() and CLOCK eviction would remove data nodes behind the member trie counts
+                if ( (op & ~(unsigned int)(RDX_ORDER_STATS | RDX_LOCALITY)) != 0 )
+                {
+                    throw "MKRdxPat.hpp: group options not RDX_ORDER_STATS or RDX_LOCALITY";
                 }
 
-                // walk data node free list - checking for valid data node addresses.
-                // if head pointer is NULL then the free node list is empty
-                dhead = (DNODE *)(rdx_.dfree_head);
+                if ( max_tries_ < 1 )
+                {
+                    throw "MKRdxPat.hpp: max_tries_ < 1(must be > 0)";
+                }
 
-                // walk data node free list
-                while ( dhead != NULL )
+                if ( num_keys_ < 1 )
                 {
-                    void *ptr;
+                    throw "MKRdxPat.hpp: num_keys_ < 1(must be > 0)";
+                }
 
-                    // check if current pointer is in free data node list
-                    ptr = std::bsearch(
-                                          (void *)(&dhead),
-                                          (void *)(&verify_free_dnode_addrs_[0]),
-                                          tot_free_nodes,
-                                          sizeof(unsigned long),
-                                          unsigned_long_compare
-                                      );
-                    if ( ptr == NULL )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
-                        {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 15): Pointer in data node free list corrupted\n",
-                                __FILE__, __LINE__);
-                            os << tmpstr;
-                        }
-                        return 15;
-                    }
-                    dhead = (DNODE *)(dhead->nnfp);
+                if ( max_key_bytes_ < 1 )
+                {
+                    throw "MKRdxPat.hpp: max_key_bytes_ < 1(must be > 0)";
                 }
 
-                // for each allocated node check for valid branch and data node values
-                for ( int n = 0 ; n < tot_alloc_nodes ; n++ )
+                // the fewest bytes holding trie numbers 0 - max_tries_-1
+                id_bytes_ = 1;
+                while ( id_bytes_ < 4 && ((unsigned int)(max_tries_-1) >> (8*id_bytes_)) != 0 )
                 {
-                    unsigned long ui;
-                    void *ptr, *bptr, *dptr;
+                    id_bytes_++;
+                }
 
+                if ( max_key_bytes_ > INT_MAX - id_bytes_ )
+                {
+                    throw "MKRdxPat.hpp: id_bytes_ + max_key_bytes_ > INT_MAX";
+                }
 
-                    for ( int k = 0 ; k < num_keys_ ; k++ )
-                    {
-                        // check if bad branch node id
-                        if ( rdx_.bnodes[n*num_keys_+k].id != 0 )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 16): Branch node id at key index %d and node %d not"
-                                            " valid - %d\n",
-                                    __FILE__, __LINE__, k, n, rdx_.bnodes[n*num_keys_+k].id);
-                                os << tmpstr;
-                            }
-                            return 16;
-                        }
+                counts_.assign( max_tries_, 0 );
+                ky_.assign( (size_t)num_keys_ * (1+id_bytes_+max_key_bytes_), 0 );
 
-                        // check if bad parent branch indicator
-                        if ( rdx_.bnodes[n*num_keys_+k].br != 0 && rdx_.bnodes[n*num_keys_+k].br != 1 )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 17): Branch node parent branch boolean of key index %d"
-                                            " and node %d not valid - %d\n",
-                                    __FILE__, __LINE__, k, n, rdx_.bnodes[n*num_keys_+k].br);
-                                os << tmpstr;
-                            }
-                            return 17;
-                        }
+                pool_ = new MKRdxPat<app_data, allocator>(mnrn, num_keys_, id_bytes_+max_key_bytes_, op, nu, al);
+            }  // MKRdxPatGroup()
 
-                        // check if branch node parent pointers are valid - the root node(i=0) will not have a parent
-                        if ( n != 0 )
-                        {
-                            ui = (unsigned long)rdx_.bnodes[n*num_keys_+k].p;
-                            ptr = std::bsearch(
-                                                  (void *)(&ui),
-                                                  (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
-                                                  tot_alloc_nodes,
-                                                  sizeof(unsigned long),
-                                                  unsigned_long_compare
-                                              );
-                            if ( ptr == NULL )
-                            {
-                                if ( vm == ERR_CODE_PRINT )
-                                {
-                                    snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 18): Branch node parent pointer of key index %d"
-                                                " and node %d corrupted\n",
-                                        __FILE__, __LINE__, k, n);
-                                    os << tmpstr;
-                                }
-                                return 18;
-                            }
-                        }
 
-                        // check if PATRICIA algorithm branch test bit number is valid
-                        if ( rdx_.bnodes[n*num_keys_+k].b > (unsigned int)max_key_bytes_*8 )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 19): Branch node bit number branch test value of"
-                                            " key index %d and node %d not valid - %d\n",
-                                    __FILE__, __LINE__, k, n, rdx_.bnodes[n*num_keys_+k].b);
-                                os << tmpstr;
-                            }
-                            return 19;
-                        }
+            ~MKRdxPatGroup()
+            {
+                delete pool_;
+            }  // ~MKRdxPatGroup()
 
-                        // check if left child pointer is another branch or data node
-                        ui = (unsigned long)rdx_.bnodes[n*num_keys_+k].l;
-                        bptr = std::bsearch(
-                                               (void *)(&ui),
-                                               (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
-                                               tot_alloc_nodes,
-                                               sizeof(unsigned long),
-                                               unsigned_long_compare
-                                           );
-                        dptr = std::bsearch(
-                                               (void *)(&ui),
-                                               (void *)(&verify_dnode_addrs_[0]),
-                                               tot_alloc_nodes,
-                                               sizeof(unsigned long),
-                                               unsigned_long_compare
-                                           );
-                        if ( bptr == NULL && dptr == NULL )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 20): Branch node left pointer of key index %d"
-                                            " and node %d corrupted\n",
-                                    __FILE__, __LINE__, k, n);
-                                os << tmpstr;
-                            }
-                            return 20;
-                        }
+            /*
+             *======================================================================================================================
+             *     insert()
+             *
+             * Purpose: 
+             *     insert a data node into member trie t with keys key[NUM_KEYS][1+MAX_KEY_BYTES] - the data node is taken
+             *     from the free list shared by all the member tries.  each key must be unique within its key index of
+             *     member trie t - the same key may be in any number of member tries.
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     int t;
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *     int return_code;
+             *
+             *     return_code = group->insert(t, (unsigned char *)key, &app_datap);
+             *
+             * Returns:
+             *     1. int return_code = 0, app_data *app_datap - if insertion is successful
+             *     2. int return_code = 1, app_data *app_datap - if any key is found to already exist in member trie t
+             *     3. int return_code = 2, app_data *NULL - if no data nodes are on the shared free list
+             *     4. int return_code = 3, app_data *NULL - if any key boolean is not 1
+             *     5. int return_code = 4, app_data *NULL - if t, the member trie, is out of range(0 - MAX_TRIES-1)
+             *
+             * Parameters:
+             *     const int t                                        - member trie(0 - MAX_TRIES-1)
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *     app_data **app_datapp                              - pointer to pointer to the inserted data node app_data struct
+             *                                                          or NULL if insertion fails
+             *
+             * Comments:
+             *     1. see MKRdxPat insert().  each pool key is the member trie key after a 1 to 4 byte trie number, thus, the
+             *        descent of a member trie passes at most the log2(MAX_TRIES) branch nodes that tell the member tries
+             *        apart.
+             */
 
-                        // check if right child pointer is another branch or data node
-                        // - the root node(i=0) will not have a right child
-                        if ( n != 0 )
-                        {
-                            ui = (unsigned long)rdx_.bnodes[n*num_keys_+k].r;
-                            bptr = std::bsearch(
-                                                   (void *)(&ui),
-                                                   (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
-                                                   tot_alloc_nodes,
-                                                   sizeof(unsigned long),
-                                                   unsigned_long_compare
-                                               );
-                            dptr = std::bsearch(
-                                                   (void *)(&ui),
-                                                   (void *)(&verify_dnode_addrs_[0]),
-                                                   tot_alloc_nodes,
-                                                   sizeof(unsigned long),
-                                                   unsigned_long_compare
-                                               );
-                            if ( bptr == NULL && dptr == NULL )
-                            {
-                                if ( vm == ERR_CODE_PRINT )
-                                {
-                                    snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 21): Branch node right pointer of key index %d"
-                                                " and node %d corrupted\n",
-                                        __FILE__, __LINE__, k, n);
-                                    os << tmpstr;
-                                }
-                                return 21;
-                            }
-                        }
+                int
+            insert
+                (
+                    const int t,
+                    const unsigned char *key,  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                    app_data **app_datapp
+                )
+            {
+                if ( t < 0 || t > max_tries_-1 )
+                {
+                    *app_datapp = NULL;
+                    return 4;
+                }
+
+                pool_key( t, key );
+
+                int return_code = pool_->insert( ky_.data(), app_datapp );
+                if ( return_code == 0 )
+                {
+                    counts_[t]++;
+                }
+
+                return return_code;
+            }  // insert()
+
+            /*
+             *======================================================================================================================
+             *     search()
+             *
+             * Purpose: 
+             *     search member trie t for the data node with keys key[NUM_KEYS][1+MAX_KEY_BYTES] - as MKRdxPat search(),
+             *     the keys with key boolean 1 are used.
+             *
+             * Usage:
+             *     int t;
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *
+             *     app_datap = group->search(t, (unsigned char *)key);
+             *
+             * Returns:
+             *     1. app_data *app_datap - if search is successful
+             *     2. app_data *NULL - if no data node of member trie t is found with all the keys used, if any key boolean
+             *                         is not 0 or 1 or if no key boolean is 1
+             *     3. app_data *NULL - if t, the member trie, is out of range(0 - MAX_TRIES-1)
+             *
+             * Parameters:
+             *     const int t                                        - member trie(0 - MAX_TRIES-1)
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *
+             * Comments:
+             *     None
+             */
 
-                        // check if data node parent pointers are all valid branch node addresses
-                        ui = (unsigned long)rdx_.dnodes[n].p[k];
-                        ptr = std::bsearch(
-                                              (void *)(&ui),
-                                              (void *)(&verify_bnode_addrs_[k*(max_rdx_nodes_+1)+0]),
-                                              tot_alloc_nodes,
-                                              sizeof(unsigned long),
-                                              unsigned_long_compare
-                                          );
-                        if ( ptr == NULL )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 22): Data node parent pointer of key index %d"
-                                            " and node %d corrupted\n",
-                                    __FILE__, __LINE__, k, n);
-                                os << tmpstr;
-                            }
-                            return 22;
-                        }
+                app_data *
+            search
+                (
+                    const int t,
+                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                )
+            {
+                if ( t < 0 || t > max_tries_-1 )
+                {
+                    return NULL;
+                }
 
-                        // check if all data node parent branch indicators are valid
-                        if ( rdx_.dnodes[n].br[k] != 0 && rdx_.dnodes[n].br[k] != 1 )
-                        {
-                            if ( vm == ERR_CODE_PRINT )
-                            {
-                                snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 23): Data node parent branch boolean of key index %d and"
-                                            " node %d not valid - %d\n",
-                                    __FILE__, __LINE__, k, n, rdx_.dnodes[n].br[k]);
-                                os << tmpstr;
-                            }
-                            return 23;
-                        }
-                    }
+                pool_key( t, key );
+
+                return pool_->search( ky_.data() );
+            }  // search()
+
+            /*
+             *======================================================================================================================
+             *     remove()
+             *
+             * Purpose: 
+             *     remove the data node of member trie t with keys key[NUM_KEYS][1+MAX_KEY_BYTES] and return it to the free
+             *     list shared by all the member tries - as MKRdxPat remove(), the keys with key boolean 1 are used.
+             *
+             * Usage:
+             *     int t;
+             *     unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+             *     app_data *app_datap;
+             *
+             *     app_datap = group->remove(t, (unsigned char *)key);
+             *
+             * Returns:
+             *     1. app_data *app_datap - if the data node is found and removed
+             *     2. app_data *NULL - if no data node of member trie t is found with all the keys used, if any key boolean
+             *                         is not 0 or 1 or if no key boolean is 1
+             *     3. app_data *NULL - if t, the member trie, is out of range(0 - MAX_TRIES-1)
+             *
+             * Parameters:
+             *     const int t                                        - member trie(0 - MAX_TRIES-1)
+             *     const unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES] - NUM_KEYS keys - one byte key boolean and MAX_KEY_BYTES key bytes
+             *
+             * Comments:
+             *     1. the app_data of the removed data node may be read until the data node is reused by a later insert().
+             */
+
+                app_data *
+            remove
+                (
+                    const int t,
+                    const unsigned char *key  // unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES]
+                )
+            {
+                if ( t < 0 || t > max_tries_-1 )
+                {
+                    return NULL;
                 }
 
-                // retrieve all keys from all data nodes and use normal search(rdx->search())
-                // to find them - ignore root node keys
+                pool_key( t, key );
 
-                // exception object for throw()'ing calloc() error
-                class MKRdxPatVerifyExc: public std::exception
+                app_data *app_datap = pool_->remove( ky_.data() );
+                if ( app_datap != NULL )
                 {
-                    virtual const char* what() const throw()
-                    {
-                        return "MKRdxPat verify() calloc() failure.";
-                    }
-                } MKRdxPatVerifyExc;
+                    counts_[t]--;
+                }
 
-                // unsigned char key[num_keys_][1+max_key_bytes_]
-                unsigned char *key = (unsigned char *)calloc( num_keys_ * (1+max_key_bytes_), sizeof(unsigned char) );
-                if ( key == NULL )
+                return app_datap;
+            }  // remove()
+
+            /*
+             *======================================================================================================================
+             *     clear()
+             *
+             * Purpose: 
+             *     remove every data node of member trie t - the subtree of the pool holding member trie t is detached with
+             *     one splice and its nodes are returned to the shared free lists.  the other member tries are unchanged.
+             *
+             * Usage:
+             *     int t;
+             *     int return_code;
+             *
+             *     return_code = group->clear(t);
+             *
+             * Returns:
+             *     1. int return_code = n - the number of data nodes removed
+             *     2. int return_code = -1 - if t, the member trie, is out of range(0 - MAX_TRIES-1)
+             *
+             * Parameters:
+             *     const int t - member trie(0 - MAX_TRIES-1)
+             *
+             * Comments:
+             *     1. see MKRdxPat remove_prefix() - clear() costs the number of data nodes of member trie t.
+             */
+
+                int
+            clear
+                (
+                    const int t
+                )
+            {
+                unsigned char prefix[4];  // trie number
+
+
+                if ( t < 0 || t > max_tries_-1 )
                 {
-                    throw MKRdxPatVerifyExc;
+                    return -1;
                 }
 
-                for ( int n = 1 ; n < tot_alloc_nodes ; n++ )
+                trie_prefix( t, prefix );
+
+                int n = pool_->remove_prefix( 0, prefix, id_bytes_*8 );
+                counts_[t] = 0;
+
+                return n;
+            }  // clear()
+
+            /*
+             *======================================================================================================================
+             *     for_each()
+             *
+             * Purpose: 
+             *     call cb for each data node of member trie t in key index k key ascending order.
+             *
+             * Usage:
+             *     struct app_data
+             *     {
+             *         int data;
+             *     }
+             *
+             *     int t;
+             *     int k;
+             *     int return_code;
+             *
+             *     return_code = group->for_each(t, k, [&](app_data *app_datap, const unsigned char *key) -> int
+             *                                         {
+             *                                             app_datap->data;  // the app_data of the data node
+             *                                             key;              // the MAX_KEY_BYTES key bytes
+             *                                             return 0;         // 0 - continue, !0 - stop
+             *                                         });
+             *
+             * Returns:
+             *     1. int return_code = n - the number of data nodes callback was called for
+             *     2. int return_code = -1 - if t, the member trie, or k, the key index, is out of range
+             *
+             * Parameters:
+             *     const int t                  - member trie(0 - MAX_TRIES-1)
+             *     const int k                  - key index(0 - NUM_KEYS-1)
+             *     callback cb                  - function, function object or lambda called as
+             *                                    int cb(app_data *app_datap, const unsigned char *key) - key is the
+             *                                    MAX_KEY_BYTES key bytes of key index k.  cb returns 0 to continue and !0 to
+             *                                    stop the walk.
+             *
+             * Comments:
+             *     1. cb must not insert() or remove() data nodes.
+             */
+
+                template <typename callback>
+                int
+            for_each
+                (
+                    const int t,
+                    const int k,
+                    callback cb
+                )
+            {
+                unsigned char prefix[4];  // trie number
+                const int id_bytes = id_bytes_;
+
+
+                if ( t < 0 || t > max_tries_-1 || k < 0 || k > num_keys_-1 )
                 {
-                    app_data *app_datap;
+                    return -1;
+                }
 
+                trie_prefix( t, prefix );
 
-                    // get data node keys directly from allocated data node
-                    for ( int k = 0 ; k < num_keys_ ; k++ )
-                    {
-                        key[k*(1+max_key_bytes_)+0] = 1;
-                        memmove( &key[k*(1+max_key_bytes_)+1], &rdx_.dnodes[n].key[k*(1+max_key_bytes_)+1], max_key_bytes_ );
-                    }
+                return pool_->for_each_prefix( k, prefix, id_bytes_*8,
+                                               [&cb, id_bytes](app_data *app_datap, const unsigned char *key) -> int
+                                               {
+                                                   return cb( app_datap, key+id_bytes );
+                                               } );
+            }  // for_each()
 
-                    // search for node n keys
-                    app_datap = search(key);
+            /*
+             *======================================================================================================================
+             *     alloc_nodes()
+             *
+             * Purpose: 
+             *     return the number of data nodes in member trie t, or in all the member tries
+             *
+             * Usage:
+             *     int alloc_nodes;
+             *
+             *     alloc_nodes = group->alloc_nodes(t);
+             *     alloc_nodes = group->alloc_nodes();
+             *
+             * Returns:
+             *     1. int alloc_nodes - the number of data nodes in member trie t, or in the pool if t is -1
+             *     2. int alloc_nodes = -1 - if t, the member trie, is out of range(-1 - MAX_TRIES-1)
+             *
+             * Parameters:
+             *     const int t - member trie(0 - MAX_TRIES-1) or -1 for all the member tries
+             *
+             * Comments:
+             *     None
+             */
 
-                    if ( app_datap == NULL )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
-                        {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 24): Data node %d searched for with it's keys not found\n",
-                                __FILE__, __LINE__, n);
-                            os << tmpstr;
-                        }
-                        return 24;
-                    }
+                int
+            alloc_nodes
+                (
+                    const int t = -1
+                ) const
+            {
+                if ( t == -1 )
+                {
+                    return pool_->alloc_nodes();
+                }
 
-                    // do full compare of 'app_data data;' obtained from rdx->search() and the same data obtained from rdx_.dnodes[n].data.
-                    // if they do not match, error.
-                    if ( memcmp( app_datap, &rdx_.dnodes[n].data, sizeof(app_data) ) != 0 )
-                    {
-                        if ( vm == ERR_CODE_PRINT )
-                        {
-                            snprintf(tmpstr, sizeof(tmpstr), "rdx->verify():(file %s  line %d  ERR_CODE 25): compare of 'app_data data;' obtained from rdx->search() and"
-                                        " the same data obtained from rdx_.dnodes[%d].data do not match",
-                                __FILE__, __LINE__, n);
-                            os << tmpstr;
-                        }
-                        return 25;
-                    }
+                if ( t < 0 || t > max_tries_-1 )
+                {
+                    return -1;
                 }
-                free(key);
 
-                return 0;
-            }  // verify()
+                return counts_[t];
+            }  // alloc_nodes()
 
-    };  // class MKRdxPat
+            /*
+             *======================================================================================================================
+             *     max_tries()
+             *
+             * Purpose: 
+             *     return the number of member tries
+             *
+             * Usage:
+             *     int max_tries;
+             *
+             *     max_tries = group->max_tries();
+             *
+             * Returns:
+             *     1. int max_tries - the constructor MAX_TRIES
+             *
+             * Parameters:
+             *     None
+             *
+             * Comments:
+             *     None
+             */
+
+                int
+            max_tries
+                (
+                ) const
+            {
+                return max_tries_;
+            }  // max_tries()
+
+            /*
+             *======================================================================================================================
+             *     pool()
+             *
+             * Purpose: 
+             *     return the MKRdxPat pool shared by the member tries - for bsize(), max_rdx_nodes(), verify() and print()
+             *     of the whole group
+             *
+             * Usage:
+             *     MKRdxPat<app_data> *rdx;
+             *
+             *     rdx = group->pool();
+             *
+             * Returns:
+             *     1. MKRdxPat<app_data> *rdx - the pool.  each key index k key of the pool is the 1 to 4 byte trie number
+             *                                  followed by the MAX_KEY_BYTES bytes of the member trie key.
+             *
+             * Parameters:
+             *     None
+             *
+             * Comments:
+             *     1. insert(), remove() or clear() of the pool directly leaves the member trie counts of alloc_nodes(t)
+             *        wrong.
+             */
+
+                MKRdxPat<app_data, allocator> *
+            pool
+                (
+                ) const
+            {
+                return pool_;
+            }  // pool()
+
+    };  // class MKRdxPatGroup
 
 }  // namespace MultiKeyRdxPat
 
@@ -9,6 +9,7 @@ then
     rm -f MKRdxPat_test
     rm -f MKRdxPat.TEST?.results
     rm -f MKRdxPat.TEST??.results
+    rm -f MKRdxPat.TEST??.snap
     rm -f MKRdxPat_perf
     rm -f MKRdxPat_perf.results
     rm -f MKRdxPat_perf_bgp
@@ -25,14 +26,14 @@ CC="clang++"
 O=O
 
 # compile test program - using MKRdxPat.hpp
-$CC -$O -pedantic -Wall -o MKRdxPat_test MKRdxPat_test.cpp -lstdc++
+$CC -$O -pedantic -Wall -o MKRdxPat_test MKRdxPat_test.cpp -pthread -lstdc++
 
 # run test program
 ./MKRdxPat_test
 
 # compile perf program
-$CC -O -pedantic -Wall -o MKRdxPat_perf MKRdxPat_perf.cpp -lstdc++
+$CC -O -pedantic -Wall -o MKRdxPat_perf MKRdxPat_perf.cpp -pthread -lstdc++
 
 # compile perf_bgp program
-$CC -O -pedantic -Wall -o MKRdxPat_perf_bgp MKRdxPat_perf_bgp.cpp -lstdc++
+$CC -O -pedantic -Wall -o MKRdxPat_perf_bgp MKRdxPat_perf_bgp.cpp -pthread -lstdc++
 
@@ -37,7 +37,7 @@
  *
  * USAGE
  *
- *     ./MKRdxPat_perf [-c{1-2}] [-s{1-86400}] [-b{1-100000}]
+ *     ./MKRdxPat_perf [-c{1-3}] [-s{1-86400}] [-b{1-100000}]
  *
  * ARGUMENTS
  *
@@ -45,16 +45,19 @@
  *
  * OPTIONS
  *
- *     -c{1-2}      - option 1: repeatedly insert()(fill - monatonic keys)/remove()(empty)
+ *     -c{1-3}      - option 1: repeatedly insert()(fill - monatonic keys)/remove()(empty)
  *                              trie(1 default)
  *                    option 2: fill trie(monatonic keys) then do max_rdx_nodes search()'s
  *                              with random keys
+ *                    option 3: repeatedly bulk_load()(fill)/remove()(empty) trie - only
+ *                              the bulk_load() is timed
  *
  *     -s{1-86400}  - minimum run time(secs)(30 default)
  *
  *     -b{1-100000} - c option 1: trie will be filled/emptied this many times
  *                    c option 2: the random key set generated on filling the trie will be
  *                                searched for this many times
+ *                    c option 3: the trie will be bulk loaded/emptied this many times
  *                    (100 default)
  *
  * DESCRIPTION
@@ -230,18 +233,21 @@ main
     extern int optind;
 
     string usage =
-        "usage: ./MKRdxPat_perf [-c{1-2}] [-s{1-86400}] [-b{1-100000}]\n"
+        "usage: ./MKRdxPat_perf [-c{1-3}] [-s{1-86400}] [-b{1-100000}]\n"
         "\n"
-        "    -c{1-2}      - option 1: repeatedly insert()(fill - monatonic keys)/remove()(empty)\n"
+        "    -c{1-3}      - option 1: repeatedly insert()(fill - monatonic keys)/remove()(empty)\n"
         "                             trie(1 default)\n"
         "                   option 2: fill trie(monatonic keys) then do max_rdx_nodes search()'s\n"
         "                             with random keys\n"
+        "                   option 3: repeatedly bulk_load()(fill)/remove()(empty) trie - only\n"
+        "                             the bulk_load() is timed\n"
         "\n"
         "    -s{1-86400}  - minimum run time(secs)(30 default)\n"
         "\n"
         "    -b{1-100000} - c option 1: trie will be filled/emptied this many times\n"
         "                   c option 2: the random key set generated on filling the trie will be\n"
         "                               searched for this many times\n"
+        "                   c option 3: the trie will be bulk loaded/emptied this many times\n"
         "                   (100 default)\n";
 
     //
@@ -287,9 +293,9 @@ main
         {
             case 'c':
                 pmode_opt = atoi(optarg);
-                if ( pmode_opt < 1 || pmode_opt > 2 )
+                if ( pmode_opt < 1 || pmode_opt > 3 )
                 {
-                    cerr << usage << "-c option out of range(1 or 2): " << pmode_opt << "\n";
+                    cerr << usage << "-c option out of range(1 to 3): " << pmode_opt << "\n";
                     exit(1);
                 }
                 break;
@@ -355,6 +361,11 @@ main
         os << "PERFORMANCE TEST: Do repeated rdx->search()\n"
               "                  monatonic keys/random search\n\nlscpu:\n";
     }
+    if ( pmode_opt == 3 )
+    {
+        os << "PERFORMANCE TEST: Do repeated rdx->bulk_load()(fill trie) / rdx->remove()(empty trie)\n"
+              "                  monatonic keys\n\nlscpu:\n\n";
+    }
 
     os.close();
 
@@ -384,10 +395,10 @@ main
     os << tmpstr;
     snprintf(tmpstr, sizeof(tmpstr), "    (Modify MKRdxPat_perf.cpp with new parameters and re-compile.)\n\n");
     os << tmpstr;
-    snprintf(tmpstr, sizeof(tmpstr), "trie size = %db\n\n", rdx->bsize());
+    snprintf(tmpstr, sizeof(tmpstr), "trie size = %zub\n\n", rdx->bsize());
     os << tmpstr;
 
-    snprintf(tmpstr, sizeof(tmpstr), "-c %d - insert()/remove()(1 default) or search()(2)\n", pmode_opt);
+    snprintf(tmpstr, sizeof(tmpstr), "-c %d - insert()/remove()(1 default), search()(2) or bulk_load()(3)\n", pmode_opt);
     os << tmpstr;
     snprintf(tmpstr, sizeof(tmpstr), "-s %d - minimum run time(sec, 30 default)\n", rtime_opt);
     os << tmpstr;
@@ -515,6 +526,61 @@ main
             }
             break;
 
+        case 3:
+            {
+                long total_loads = 0;
+                struct timespec tstart={0,0}, tend={0,0}, tdiff={0,0};
+                double sec = 0;
+                int return_code;
+
+                snprintf(tmpstr, sizeof(tmpstr), "bulk_load() increments: %d(%d*max_rdx_nodes)\n\n",
+                    block_multiply_opt*max_rdx_nodes, block_multiply_opt);
+                os << tmpstr;
+
+                for (;;)
+                {
+                    for ( int i = 0 ; i < block_multiply_opt ; i++ )
+                    {
+                        // only the bulk_load() is timed
+                        clock_gettime(CLOCK_MONOTONIC, &tstart);
+
+                        return_code = rdx->bulk_load((unsigned char *)rdx_key, NULL, max_rdx_nodes);
+
+                        clock_gettime(CLOCK_MONOTONIC, &tend);
+
+                        tdiff = timespec_diff(tstart, tend);
+                        sec += tdiff.tv_sec + tdiff.tv_nsec/1E9;
+
+                        if ( return_code != 0 )
+                        {
+                            os << "bulk_load(): return_code = " << return_code << "\n";
+                        }
+
+                        // empty trie for next bulk_load()
+                        for ( int n = 0 ; n < max_rdx_nodes ; n++ )
+                        {
+                            rdx->remove((unsigned char *)rdx_key[n]);
+                        }
+                    }
+
+                    total_loads += max_rdx_nodes*block_multiply_opt;
+
+                    if ( sec > rtime_opt )
+                    {
+                        break;
+                    }
+                }
+
+                snprintf(tmpstr, sizeof(tmpstr), "seconds = %f  total bulk loaded data nodes = %ld\n\n", sec, total_loads);
+                os << tmpstr;
+
+                long ops_per_sec;
+                ops_per_sec = total_loads/sec;
+                snprintf(tmpstr, sizeof(tmpstr), "operations per second = %ld\n\n", ops_per_sec);
+                os << tmpstr;
+            }
+            break;
+
         default:
             {
                 os << "Bad -c option.\n";
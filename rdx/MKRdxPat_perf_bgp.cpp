@@ -37,7 +37,7 @@
  *
  * USAGE
  *
- *     ./MKRdxPat_perf_bgp [-c{1-2}] [-r{1-3}] [-s{1-86400}] [-b{1-100000}]
+ *     ./MKRdxPat_perf_bgp [-c{1-4}] [-r{1-3}] [-s{1-86400}] [-b{1-100000}]
  *
  * ARGUMENTS
  *
@@ -45,10 +45,14 @@
  *
  * OPTIONS
  *
- *     -c{1-2}      - option 1: repeatedly insert()(fill - monatonic keys)/remove()(empty)
+ *     -c{1-4}      - option 1: repeatedly insert()(fill - monatonic keys)/remove()(empty)
  *                              trie(1 default)
  *                    option 2: fill trie(monatonic keys) then do max_rdx_nodes search()'s
  *                              with random keys
+ *                    option 3: repeatedly bulk_load()(fill)/remove()(empty) trie - only
+ *                              the bulk_load() is timed
+ *                    option 4: repeatedly insert_hint()(fill)/remove()(empty) trie - each
+ *                              insert_hint() starts from the data node of the previous one
  *
  *     -r{1-3}      - option to set key encoding scheme
  *                    store keys in trie as:
@@ -61,6 +65,8 @@
  *     -b{1-100000} - c option 1: trie will be filled/emptied this many times
  *                    c option 2: the random key set generated on filling the trie will be
  *                                searched for this many times
+ *                    c option 3: the trie will be bulk loaded/emptied this many times
+ *                    c option 4: trie will be filled/emptied this many times
  *                    (100 default)
  *
  * DESCRIPTION
@@ -243,10 +249,14 @@ main
     const int MAX_PREFIX_SIZE = 18;
 
     string usage =
-        "usage: ./MKRdxPat_perf [-c{1-2}] [-s{1-86400}] [-b{1-100000}]\n"
+        "usage: ./MKRdxPat_perf [-c{1-4}] [-s{1-86400}] [-b{1-100000}]\n"
         "\n"
-        "    -c{1-2}      - option 1: repeatedly insert()(fill)/remove()(empty) trie using bgp routing table keys(default)\n"
+        "    -c{1-4}      - option 1: repeatedly insert()(fill)/remove()(empty) trie using bgp routing table keys(default)\n"
         "                   option 2: fill trie then do max_rdx_nodes random search()'s with bgp routing table keys\n"
+        "                   option 3: repeatedly bulk_load()(fill)/remove()(empty) trie using bgp routing table keys -\n"
+        "                             only the bulk_load() is timed\n"
+        "                   option 4: repeatedly insert_hint()(fill)/remove()(empty) trie using bgp routing table keys -\n"
+        "                             each insert_hint() starts from the data node of the previous one\n"
         "\n"
         "    -r{1-3}      - option to set key encoding scheme\n"
         "                   store keys in trie as:\n"
@@ -259,6 +269,8 @@ main
         "    -b{1-100000} - c option 1: trie will be filled/emptied this many times\n"
         "                   c option 2: the random key set generated on filling the trie will be\n"
         "                               searched for this many times\n"
+        "                   c option 3: the trie will be bulk loaded/emptied this many times\n"
+        "                   c option 4: trie will be filled/emptied this many times\n"
         "                   (100 default)\n";
 
     ofstream os;
@@ -278,9 +290,9 @@ main
         {
             case 'c':
                 pmode_opt = atoi(optarg);
-                if ( pmode_opt < 1 || pmode_opt > 2 )
+                if ( pmode_opt < 1 || pmode_opt > 4 )
                 {
-                    cerr << usage << "-c option out of range(1-2): " << pmode_opt << "\n";
+                    cerr << usage << "-c option out of range(1-4): " << pmode_opt << "\n";
                     exit(1);
                 }
                 break;
@@ -387,6 +399,16 @@ main
         os << "PERFORMANCE TEST: Do repeated rdx->search()\n"
               "                  using bgp routing table prefix keys/random search\n\nlscpu:\n";
     }
+    if ( pmode_opt == 3 )
+    {
+        os << "PERFORMANCE TEST: Do repeated rdx->bulk_load()(fill trie) / rdx->remove()(empty trie)\n"
+              "                  using bgp routing table prefix keys\n\nlscpu:\n\n";
+    }
+    if ( pmode_opt == 4 )
+    {
+        os << "PERFORMANCE TEST: Do repeated rdx->insert_hint()(fill trie) / rdx->remove()(empty trie)\n"
+              "                  using bgp routing table prefix keys\n\nlscpu:\n\n";
+    }
 
     os.close();
 
@@ -462,10 +484,10 @@ main
     snprintf(tmpstr, sizeof(tmpstr), "    (Modify MKRdxPat_perf.cpp with new parameters and re-compile.)\n\n");
     os << tmpstr;
 
-    snprintf(tmpstr, sizeof(tmpstr), "trie size = %db\n\n", rdx->bsize());
+    snprintf(tmpstr, sizeof(tmpstr), "trie size = %zub\n\n", rdx->bsize());
     os << tmpstr;
 
-    snprintf(tmpstr, sizeof(tmpstr), "-c %d - insert()/remove()(1 default) or search()(2)\n", pmode_opt);
+    snprintf(tmpstr, sizeof(tmpstr), "-c %d - insert()/remove()(1 default), search()(2), bulk_load()(3) or insert_hint()/remove()(4)\n", pmode_opt);
     os << tmpstr;
     snprintf(tmpstr, sizeof(tmpstr), "-r %d - key encoding(1-3, 1 default)\n", router_key_opt);
     os << tmpstr;
@@ -595,6 +617,123 @@ main
             }
             break;
 
+        case 3:
+            {
+                long total_loads = 0;
+                struct timespec tstart={0,0}, tend={0,0}, tdiff={0,0};
+                double sec = 0;
+                int return_code;
+
+                snprintf(tmpstr, sizeof(tmpstr), "bulk_load() increments: %d(%d*max_rdx_nodes)\n\n",
+                    block_multiply_opt*max_rdx_nodes, block_multiply_opt);
+                os << tmpstr;
+
+                for (;;)
+                {
+                    for ( int i = 0 ; i < block_multiply_opt ; i++ )
+                    {
+                        // only the bulk_load() is timed
+                        clock_gettime(CLOCK_MONOTONIC, &tstart);
+
+                        return_code = rdx->bulk_load((unsigned char *)rdx_key, NULL, max_rdx_nodes);
+
+                        clock_gettime(CLOCK_MONOTONIC, &tend);
+
+                        tdiff = timespec_diff(tstart, tend);
+                        sec += tdiff.tv_sec + tdiff.tv_nsec/1E9;
+
+                        if ( return_code != 0 )
+                        {
+                            os << "bulk_load(): return_code = " << return_code << "\n";
+                        }
+
+                        // empty trie for next bulk_load()
+                        for ( int n = 0 ; n < max_rdx_nodes ; n++ )
+                        {
+                            rdx->remove((unsigned char *)rdx_key[n]);
+                        }
+                    }
+
+                    total_loads += max_rdx_nodes*block_multiply_opt;
+
+                    if ( sec > rtime_opt )
+                    {
+                        break;
+                    }
+                }
+
+                snprintf(tmpstr, sizeof(tmpstr), "seconds = %f  total bulk loaded data nodes = %ld\n\n", sec, total_loads);
+                os << tmpstr;
+
+                long ops_per_sec;
+                ops_per_sec = total_loads/sec;
+                snprintf(tmpstr, sizeof(tmpstr), "operations per second = %ld\n\n", ops_per_sec);
+                os << tmpstr;
+            }
+            break;
+
+        case 4:
+            {
+                long total_inserts_removes = 0;
+                struct timespec tstart={0,0}, tend={0,0}, tdiff={0,0};
+                double sec;
+                int return_code;
+                MKRdxPat<app_data>::node_handle hint = 0;
+
+                snprintf(tmpstr, sizeof(tmpstr), "insert_hint()/remove() increments: %d(%d*2*max_rdx_nodes)\n\n",
+                    block_multiply_opt*2*max_rdx_nodes, block_multiply_opt);
+                os << tmpstr;
+
+                clock_gettime(CLOCK_MONOTONIC, &tstart);
+
+                for (;;)
+                {
+                    for ( int i = 0 ; i < block_multiply_opt ; i++ )
+                    {
+                        for ( int n = 0 ; n < max_rdx_nodes ; n++ )
+                        {
+                            return_code = rdx->insert_hint((unsigned char *)rdx_key[n], &app_datap, &hint);
+
+                            if ( return_code != 0 )
+                            {
+                                os << "insert_hint(): data node = " << n << " return_code = " << return_code << "\n";
+                            }
+                        }
+
+                        for ( int n = 0 ; n < max_rdx_nodes ; n++ )
+                        {
+                            app_datap = rdx->remove((unsigned char *)rdx_key[n]);
+
+                            if ( app_datap == NULL )
+                            {
+                                os << "remove(): data node = " << n << " return = NULL" << "\n";
+                            }
+                        }
+                    }
+
+                    total_inserts_removes += max_rdx_nodes*2*block_multiply_opt;
+
+                    clock_gettime(CLOCK_MONOTONIC, &tend);
+
+                    tdiff = timespec_diff(tstart, tend);
+                    sec = tdiff.tv_sec + tdiff.tv_nsec/1E9;
+
+                    if ( sec > rtime_opt )
+                    {
+                        break;
+                    }
+                }
+
+                snprintf(tmpstr, sizeof(tmpstr), "seconds = %f  total inserts/removes = %ld\n\n", sec, total_inserts_removes);
+                os << tmpstr;
+
+                long ops_per_sec;
+                ops_per_sec = total_inserts_removes/sec;
+                snprintf(tmpstr, sizeof(tmpstr), "operations per second = %ld\n\n", ops_per_sec);
+                os << tmpstr;
+            }
+            break;
+
         default:
             {
                 os << "Bad -c option.\n";
@@ -43,12 +43,42 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <random>
 
 #include "MKRdxPat.hpp"
 
 using namespace MultiKeyRdxPat;
 
+// allocator counting the bytes currently allocated through it - used by TEST 34
+template <typename T> struct counting_allocator
+{
+    typedef T value_type;
+
+    counting_allocator(long *b) : bytes(b) {}
+    template <typename U> counting_allocator(const counting_allocator<U> &a) : bytes(a.bytes) {}
+
+    T *allocate(size_t n) { *bytes += n * sizeof(T); return (T *)::operator new(n * sizeof(T)); }
+    void deallocate(T *p, size_t n) { *bytes -= n * sizeof(T); ::operator delete(p); }
+
+    long *bytes;
+};
+
+// allocator recording the bytes asked for and refusing them - used by TEST 37
+template <typename T> struct refusing_allocator
+{
+    typedef T value_type;
+
+    refusing_allocator(size_t *b) : bytes(b) {}
+    template <typename U> refusing_allocator(const refusing_allocator<U> &a) : bytes(a.bytes) {}
+
+    T *allocate(size_t n) { *bytes = n * sizeof(T); throw std::bad_alloc(); }
+    void deallocate(T *, size_t) {}
+
+    size_t *bytes;
+};
+
     void
 print_key
     (
@@ -1985,5 +2015,3512 @@ main()
 
         os.close();
     }
+
+    {  // TEST 17
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+        app_data **app_datapp;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 20;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 3;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 2;
+
+        // MAX_RDX_NODES nodes of NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[MAX_RDX_NODES][NUM_KEYS][1+MAX_KEY_BYTES];
+        app_data data[MAX_RDX_NODES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST17.results");
+
+        os << "\n"
+              "TEST 17: Bulk load MAX_RDX_NODES data nodes with unsorted keys into an empty rdx trie\n"
+              "         Expected Results:\n"
+              "            a. bulk_load() of MAX_RDX_NODES data nodes - return_code = 0\n"
+              "            b. No verification error\n"
+              "            c. search() for each data node by each key finds the bulk loaded app_data\n"
+              "            d. sort() by each key lists the data nodes in key order\n"
+              "            e. bulk_load() into a non-empty trie - return_code = 4\n"
+              "            f. bulk_load() with a duplicate key - return_code = 1 and the trie is left empty\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        // key 0 ascending, key 1 descending and key 2 scrambled - data id is the key[][][] index
+        memset(rdx_key, 0, MAX_RDX_NODES * NUM_KEYS * (1+MAX_KEY_BYTES));
+        for ( int n = 0 ; n < MAX_RDX_NODES ; n++ )
+        {
+            for ( int k = 0 ; k < NUM_KEYS ; k++ )
+            {
+                rdx_key[n][k][0] = 1;  // set key boolean to 1
+            }
+            rdx_key[n][0][1] = n;
+            rdx_key[n][0][MAX_KEY_BYTES] = n;
+            rdx_key[n][1][MAX_KEY_BYTES] = 255 - n;
+            rdx_key[n][2][1] = (n * 7) % MAX_RDX_NODES;
+            rdx_key[n][2][MAX_KEY_BYTES] = (n * 37) & 0xff;
+
+            data[n].id = n;
+        }
+
+        os << "a. bulk_load() of MAX_RDX_NODES data nodes - return_code = 0\n";
+        return_code = rdx->bulk_load((unsigned char *)rdx_key, data, MAX_RDX_NODES);
+
+        os << "return_code = rdx->bulk_load((unsigned char *)rdx_key, data, " << MAX_RDX_NODES << "); return_code = " << return_code << "\n";
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "b. No verification error\n";
+        return_code = rdx->verify(ERR_CODE_PRINT, os);
+
+        os << "return_code = rdx->verify(ERR_CODE_PRINT, os); verify success(0) or fail(!0) -> return_code = " << return_code << "\n\n";
+
+        os << "c. search() for each data node by each key finds the bulk loaded app_data\n";
+        for ( int n = 0 ; n < MAX_RDX_NODES ; n++ )
+        {
+            unsigned char key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+            for ( int k = 0 ; k < NUM_KEYS ; k++ )
+            {
+                memset(key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+                memmove(key[k], rdx_key[n][k], 1+MAX_KEY_BYTES);
+                app_datap = rdx->search((unsigned char *)key);
+
+                os << "n = " << n << "  k = " << k << "  app_datap->id = " << (app_datap == NULL ? -1 : app_datap->id) << "\n";
+            }
+        }
+        os << "\n";
+
+        os << "d. sort() by each key lists the data nodes in key order\n";
+        for ( int k = 0 ; k < NUM_KEYS ; k++ )
+        {
+            return_code = rdx->sort(&app_datapp, k);
+
+            os << "return_code = rdx->sort(&app_datapp, " << k << "); return_code = " << return_code << "\n";
+            for ( int n = 0 ; n < return_code ; n++ )
+            {
+                os << ((app_data *)app_datapp[n])->id << " ";
+            }
+            os << "\n\n";
+        }
+
+        os << "e. bulk_load() into a non-empty trie - return_code = 4\n";
+        return_code = rdx->bulk_load((unsigned char *)rdx_key, data, MAX_RDX_NODES);
+
+        os << "return_code = rdx->bulk_load((unsigned char *)rdx_key, data, " << MAX_RDX_NODES << "); return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os << "f. bulk_load() with a duplicate key - return_code = 1 and the trie is left empty\n";
+        rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        memmove(rdx_key[MAX_RDX_NODES-1][2], rdx_key[0][2], 1+MAX_KEY_BYTES);
+        return_code = rdx->bulk_load((unsigned char *)rdx_key, data, MAX_RDX_NODES);
+
+        os << "return_code = rdx->bulk_load((unsigned char *)rdx_key, data, " << MAX_RDX_NODES << "); return_code = " << return_code << "\n";
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n";
+
+        return_code = rdx->verify(ERR_CODE_PRINT, os);
+
+        os << "return_code = rdx->verify(ERR_CODE_PRINT, os); verify success(0) or fail(!0) -> return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 18
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 10;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 2;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST18.results");
+
+        os << "\n"
+              "TEST 18: Iterate over the data nodes of each key index with begin()/end() and rbegin()/rend()\n"
+              "         Expected Results:\n"
+              "            a. begin(0) == end(0) for an empty trie\n"
+              "            b. insert MAX_RDX_NODES data nodes - key 0 ascending and key 1 descending with id\n"
+              "            c. iterate key 0 in ascending order - ids 0 to 9\n"
+              "            d. iterate key 1 in ascending order - ids 9 to 0\n"
+              "            e. iterate key 0 in descending order - ids 9 to 0\n"
+              "            f. early exit - print the first three keys of key 0 only\n"
+              "            g. begin(NUM_KEYS) == end(NUM_KEYS) for a key index out of range\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        MKRdxPat<app_data>::iterator it;
+        MKRdxPat<app_data>::reverse_iterator rit;
+
+        os << "a. begin(0) == end(0) for an empty trie\n";
+        os << "rdx->begin(0) == rdx->end(0) -> " << (rdx->begin(0) == rdx->end(0)) << "\n\n";
+
+        os << "b. insert MAX_RDX_NODES data nodes - key 0 ascending and key 1 descending with id\n";
+        for ( int n = 0 ; n < MAX_RDX_NODES ; n++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[0][MAX_KEY_BYTES] = (n * 3) % MAX_RDX_NODES;
+            rdx_key[1][MAX_KEY_BYTES] = 0xff - (n * 3) % MAX_RDX_NODES;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); return_code = " << return_code << "\n";
+
+            app_datap->id = (n * 3) % MAX_RDX_NODES;
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "c. iterate key 0 in ascending order - ids 0 to 9\n";
+        for ( it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+        {
+            os << "key 0 = " << std::hex << (int)it.key()[0] << " " << (int)it.key()[1] << std::dec << "  id = " << it->id << "\n";
+        }
+        os << "\n";
+
+        os << "d. iterate key 1 in ascending order - ids 9 to 0\n";
+        for ( it = rdx->begin(1) ; it != rdx->end(1) ; ++it )
+        {
+            os << "key 1 = " << std::hex << (int)it.key()[0] << " " << (int)it.key()[1] << std::dec << "  id = " << it->id << "\n";
+        }
+        os << "\n";
+
+        os << "e. iterate key 0 in descending order - ids 9 to 0\n";
+        for ( rit = rdx->rbegin(0) ; rit != rdx->rend(0) ; ++rit )
+        {
+            os << "key 0 = " << std::hex << (int)rit.key()[0] << " " << (int)rit.key()[1] << std::dec << "  id = " << rit->id << "\n";
+        }
+        os << "\n";
+
+        os << "f. early exit - print the first three keys of key 0 only\n";
+        int count = 0;
+        for ( it = rdx->begin(0) ; it != rdx->end(0) && count < 3 ; ++it, count++ )
+        {
+            os << "key 0 = " << std::hex << (int)it.key()[0] << " " << (int)it.key()[1] << std::dec << "  id = " << (*it).id << "\n";
+        }
+        os << "\n";
+
+        os << "g. begin(NUM_KEYS) == end(NUM_KEYS) for a key index out of range\n";
+        os << "rdx->begin(NUM_KEYS) == rdx->end(NUM_KEYS) -> " << (rdx->begin(NUM_KEYS) == rdx->end(NUM_KEYS)) << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 19
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 16;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // range bounds - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char lo[MAX_KEY_BYTES];
+        unsigned char hi[MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST19.results");
+
+        os << "\n"
+              "TEST 19: Range queries over key index 0 with range()\n"
+              "         Expected Results:\n"
+              "            a. insert 16 data nodes with IPv4 address keys 10.0.0.0, 10.0.0.16, ... 10.0.0.240\n"
+              "            b. range [10.0.0.32, 10.0.0.96) - ids 2 3 4 5 - return_code = 4\n"
+              "            c. range [10.0.0.33, 10.0.0.97) - lo and hi not in trie - ids 3 4 5 6 - return_code = 4\n"
+              "            d. range [NULL, 10.0.0.48) - no lower bound - ids 0 1 2 - return_code = 3\n"
+              "            e. range [10.0.0.200, NULL) - no upper bound - ids 13 14 15 - return_code = 3\n"
+              "            f. range [NULL, NULL) with early exit after 5 data nodes - ids 0 1 2 3 4 - return_code = 5\n"
+              "            g. range [10.0.1.0, NULL) - above all keys - return_code = 0\n"
+              "            h. range with key index NUM_KEYS - return_code = -1\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        // print the ids of the data nodes in the range
+        auto print_id = [&os](app_data *app_datap, const unsigned char *key) -> int
+                        {
+                            os << app_datap->id << " ";
+                            return 0;
+                        };
+
+        os << "a. insert 16 data nodes with IPv4 address keys 10.0.0.0, 10.0.0.16, ... 10.0.0.240\n";
+        for ( int n = 0 ; n < MAX_RDX_NODES ; n++ )
+        {
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10;
+            rdx_key[0][2] = 0;
+            rdx_key[0][3] = 0;
+            rdx_key[0][4] = n * 16;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = n;
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "b. range [10.0.0.32, 10.0.0.96) - ids 2 3 4 5 - return_code = 4\n";
+        lo[0] = 10; lo[1] = 0; lo[2] = 0; lo[3] = 32;
+        hi[0] = 10; hi[1] = 0; hi[2] = 0; hi[3] = 96;
+        return_code = rdx->range(0, lo, hi, print_id);
+
+        os << "\nreturn_code = rdx->range(0, lo, hi, print_id); return_code = " << return_code << "\n\n";
+
+        os << "c. range [10.0.0.33, 10.0.0.97) - lo and hi not in trie - ids 3 4 5 6 - return_code = 4\n";
+        lo[3] = 33;
+        hi[3] = 97;
+        return_code = rdx->range(0, lo, hi, print_id);
+
+        os << "\nreturn_code = rdx->range(0, lo, hi, print_id); return_code = " << return_code << "\n\n";
+
+        os << "d. range [NULL, 10.0.0.48) - no lower bound - ids 0 1 2 - return_code = 3\n";
+        hi[3] = 48;
+        return_code = rdx->range(0, NULL, hi, print_id);
+
+        os << "\nreturn_code = rdx->range(0, NULL, hi, print_id); return_code = " << return_code << "\n\n";
+
+        os << "e. range [10.0.0.200, NULL) - no upper bound - ids 13 14 15 - return_code = 3\n";
+        lo[3] = 200;
+        return_code = rdx->range(0, lo, NULL, print_id);
+
+        os << "\nreturn_code = rdx->range(0, lo, NULL, print_id); return_code = " << return_code << "\n\n";
+
+        os << "f. range [NULL, NULL) with early exit after 5 data nodes - ids 0 1 2 3 4 - return_code = 5\n";
+        int count = 0;
+        return_code = rdx->range(0, NULL, NULL, [&os, &count](app_data *app_datap, const unsigned char *key) -> int
+                                                {
+                                                    os << app_datap->id << " ";
+                                                    return ++count == 5;
+                                                });
+
+        os << "\nreturn_code = rdx->range(0, NULL, NULL, ...); return_code = " << return_code << "\n\n";
+
+        os << "g. range [10.0.1.0, NULL) - above all keys - return_code = 0\n";
+        lo[2] = 1; lo[3] = 0;
+        return_code = rdx->range(0, lo, NULL, print_id);
+
+        os << "return_code = rdx->range(0, lo, NULL, print_id); return_code = " << return_code << "\n\n";
+
+        os << "h. range with key index NUM_KEYS - return_code = -1\n";
+        return_code = rdx->range(NUM_KEYS, NULL, NULL, print_id);
+
+        os << "return_code = rdx->range(NUM_KEYS, NULL, NULL, print_id); return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 20
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 12;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 6;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // prefix - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char prefix[MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST20.results");
+
+        os << "\n"
+              "TEST 20: Enumerate the data nodes under a key prefix with for_each_prefix()\n"
+              "         Expected Results:\n"
+              "            a. insert 12 data nodes - key 0 IPv4 address 10.n.0.1 or 11.n.0.1, key 1 MAC address with OUI\n"
+              "               00:1a:2b for even n and 00:1a:2c for odd n\n"
+              "            b. key 0 prefix 10.0.0.0/8 - ids 0 2 4 6 8 10 - return_code = 6\n"
+              "            c. key 0 prefix 10.4.0.0/14 - ids 4 6 - return_code = 2\n"
+              "            d. key 1 OUI 00:1a:2c(24 bits) - ids 1 3 5 7 9 11 - return_code = 6\n"
+              "            e. key 0 prefix 12.0.0.0/8 - no keys - return_code = 0\n"
+              "            f. key 0 prefix 0 bits - all ids - return_code = 12\n"
+              "            g. key 0 prefix 49 bits - return_code = -2\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        // print the ids of the data nodes with the prefix
+        auto print_id = [&os](app_data *app_datap, const unsigned char *key) -> int
+                        {
+                            os << app_datap->id << " ";
+                            return 0;
+                        };
+
+        os << "a. insert 12 data nodes - key 0 IPv4 address 10.n.0.1 or 11.n.0.1, key 1 MAC address with OUI\n"
+              "   00:1a:2b for even n and 00:1a:2c for odd n\n";
+        for ( int n = 0 ; n < MAX_RDX_NODES ; n++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10 + n % 2;
+            rdx_key[0][2] = n;
+            rdx_key[0][4] = 1;
+
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][1] = 0x00;
+            rdx_key[1][2] = 0x1a;
+            rdx_key[1][3] = 0x2b + n % 2;
+            rdx_key[1][6] = n;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = n;
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "b. key 0 prefix 10.0.0.0/8 - ids 0 2 4 6 8 10 - return_code = 6\n";
+        memset(prefix, 0, MAX_KEY_BYTES);
+        prefix[0] = 10;
+        return_code = rdx->for_each_prefix(0, prefix, 8, print_id);
+
+        os << "\nreturn_code = rdx->for_each_prefix(0, prefix, 8, print_id); return_code = " << return_code << "\n\n";
+
+        os << "c. key 0 prefix 10.4.0.0/14 - ids 4 6 - return_code = 2\n";
+        prefix[1] = 4;
+        return_code = rdx->for_each_prefix(0, prefix, 14, print_id);
+
+        os << "\nreturn_code = rdx->for_each_prefix(0, prefix, 14, print_id); return_code = " << return_code << "\n\n";
+
+        os << "d. key 1 OUI 00:1a:2c(24 bits) - ids 1 3 5 7 9 11 - return_code = 6\n";
+        memset(prefix, 0, MAX_KEY_BYTES);
+        prefix[0] = 0x00;
+        prefix[1] = 0x1a;
+        prefix[2] = 0x2c;
+        return_code = rdx->for_each_prefix(1, prefix, 24, print_id);
+
+        os << "\nreturn_code = rdx->for_each_prefix(1, prefix, 24, print_id); return_code = " << return_code << "\n\n";
+
+        os << "e. key 0 prefix 12.0.0.0/8 - no keys - return_code = 0\n";
+        memset(prefix, 0, MAX_KEY_BYTES);
+        prefix[0] = 12;
+        return_code = rdx->for_each_prefix(0, prefix, 8, print_id);
+
+        os << "return_code = rdx->for_each_prefix(0, prefix, 8, print_id); return_code = " << return_code << "\n\n";
+
+        os << "f. key 0 prefix 0 bits - all ids - return_code = 12\n";
+        return_code = rdx->for_each_prefix(0, prefix, 0, print_id);
+
+        os << "\nreturn_code = rdx->for_each_prefix(0, prefix, 0, print_id); return_code = " << return_code << "\n\n";
+
+        os << "g. key 0 prefix 49 bits - return_code = -2\n";
+        return_code = rdx->for_each_prefix(0, prefix, 49, print_id);
+
+        os << "return_code = rdx->for_each_prefix(0, prefix, 49, print_id); return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 21
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 8;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 2;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // query key - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char key[MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST21.results");
+
+        os << "\n"
+              "TEST 21: Ordered neighbor queries lower_bound(), upper_bound(), predecessor(), successor(), min() and max()\n"
+              "         Expected Results:\n"
+              "            a. min() and max() of an empty trie - end()\n"
+              "            b. insert 8 data nodes with keys 100, 200, ... 800 and id = key/100\n"
+              "            c. min() - id 1, max() - id 8\n"
+              "            d. key 500(in trie) - lower_bound id 5, upper_bound id 6, predecessor id 4, successor id 6\n"
+              "            e. key 450(not in trie) - lower_bound id 5, upper_bound id 5, predecessor id 4, successor id 5\n"
+              "            f. key 50(below all keys) - lower_bound id 1, upper_bound id 1, predecessor end(), successor id 1\n"
+              "            g. key 900(above all keys) - lower_bound end(), upper_bound end(), predecessor id 8, successor end()\n"
+              "            h. lower_bound(key 450) and walk on - ids 5 6 7 8\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        MKRdxPat<app_data>::iterator it;
+
+        // print the id of the data node an iterator refers to or end()
+        auto print_id = [&os, rdx](const char *name, MKRdxPat<app_data>::iterator it)
+                        {
+                            os << name << " = ";
+                            if ( it == rdx->end(0) )
+                            {
+                                os << "end()\n";
+                            }
+                            else
+                            {
+                                os << "id " << it->id << "\n";
+                            }
+                        };
+
+        // print the four neighbor queries for a key
+        auto print_neighbors = [&print_id, rdx](unsigned char *key)
+                               {
+                                   print_id("rdx->lower_bound(0, key)", rdx->lower_bound(0, key));
+                                   print_id("rdx->upper_bound(0, key)", rdx->upper_bound(0, key));
+                                   print_id("rdx->predecessor(0, key)", rdx->predecessor(0, key));
+                                   print_id("rdx->successor(0, key)", rdx->successor(0, key));
+                               };
+
+        os << "a. min() and max() of an empty trie - end()\n";
+        print_id("rdx->min(0)", rdx->min(0));
+        print_id("rdx->max(0)", rdx->max(0));
+        os << "\n";
+
+        os << "b. insert 8 data nodes with keys 100, 200, ... 800 and id = key/100\n";
+        for ( int n = 1 ; n <= MAX_RDX_NODES ; n++ )
+        {
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = (n * 100) >> 8;
+            rdx_key[0][2] = (n * 100) & 0xff;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); return_code = " << return_code << "\n";
+
+            app_datap->id = n;
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "c. min() - id 1, max() - id 8\n";
+        print_id("rdx->min(0)", rdx->min(0));
+        print_id("rdx->max(0)", rdx->max(0));
+        os << "\n";
+
+        os << "d. key 500(in trie) - lower_bound id 5, upper_bound id 6, predecessor id 4, successor id 6\n";
+        key[0] = 500 >> 8;
+        key[1] = 500 & 0xff;
+        print_neighbors(key);
+        os << "\n";
+
+        os << "e. key 450(not in trie) - lower_bound id 5, upper_bound id 5, predecessor id 4, successor id 5\n";
+        key[0] = 450 >> 8;
+        key[1] = 450 & 0xff;
+        print_neighbors(key);
+        os << "\n";
+
+        os << "f. key 50(below all keys) - lower_bound id 1, upper_bound id 1, predecessor end(), successor id 1\n";
+        key[0] = 50 >> 8;
+        key[1] = 50 & 0xff;
+        print_neighbors(key);
+        os << "\n";
+
+        os << "g. key 900(above all keys) - lower_bound end(), upper_bound end(), predecessor id 8, successor end()\n";
+        key[0] = 900 >> 8;
+        key[1] = 900 & 0xff;
+        print_neighbors(key);
+        os << "\n";
+
+        os << "h. lower_bound(key 450) and walk on - ids 5 6 7 8\n";
+        key[0] = 450 >> 8;
+        key[1] = 450 & 0xff;
+        for ( it = rdx->lower_bound(0, key) ; it != rdx->end(0) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 22
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 16;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // prefix and range bounds - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char prefix[MAX_KEY_BYTES];
+        unsigned char lo[MAX_KEY_BYTES];
+        unsigned char hi[MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST22.results");
+
+        os << "\n"
+              "TEST 22: Bulk remove of a key prefix subtree with remove_prefix() and of a key range with remove_range()\n"
+              "         Expected Results:\n"
+              "            a. insert 16 data nodes - key 0 IPv4 address 10.0.n.1 with id n, key 1 the id n\n"
+              "            b. remove_prefix() key 0 prefix 10.0.4.0/22 - ids 4 5 6 7 removed - return_code = 4\n"
+              "            c. remove_range() key 1 [2, 10) - ids 2 3 8 9 removed - return_code = 4\n"
+              "            d. key 0 and key 1 both hold the ids 0 1 10 11 12 13 14 15 - 8 data nodes allocated\n"
+              "            e. search() by key 1 for removed id 5 - NULL\n"
+              "            f. remove_prefix() key 0 prefix 0 bits - all 8 data nodes removed - return_code = 8\n"
+              "            g. insert 16 data nodes again - all return_code = 0\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        MKRdxPat<app_data>::iterator it;
+
+        os << "a. insert 16 data nodes - key 0 IPv4 address 10.0.n.1 with id n, key 1 the id n\n";
+        for ( int n = 0 ; n < MAX_RDX_NODES ; n++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10;
+            rdx_key[0][3] = n;
+            rdx_key[0][4] = 1;
+
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][MAX_KEY_BYTES] = n;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); return_code = " << return_code << "\n";
+
+            app_datap->id = n;
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "b. remove_prefix() key 0 prefix 10.0.4.0/22 - ids 4 5 6 7 removed - return_code = 4\n";
+        memset(prefix, 0, MAX_KEY_BYTES);
+        prefix[0] = 10;
+        prefix[2] = 4;
+        return_code = rdx->remove_prefix(0, prefix, 22);
+
+        os << "return_code = rdx->remove_prefix(0, prefix, 22); return_code = " << return_code << "\n";
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "c. remove_range() key 1 [2, 10) - ids 2 3 8 9 removed - return_code = 4\n";
+        memset(lo, 0, MAX_KEY_BYTES);
+        memset(hi, 0, MAX_KEY_BYTES);
+        lo[MAX_KEY_BYTES-1] = 2;
+        hi[MAX_KEY_BYTES-1] = 10;
+        return_code = rdx->remove_range(1, lo, hi);
+
+        os << "return_code = rdx->remove_range(1, lo, hi); return_code = " << return_code << "\n";
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "d. key 0 and key 1 both hold the ids 0 1 10 11 12 13 14 15 - 8 data nodes allocated\n";
+        for ( int k = 0 ; k < NUM_KEYS ; k++ )
+        {
+            os << "key " << k << " ids = ";
+            for ( it = rdx->begin(k) ; it != rdx->end(k) ; ++it )
+            {
+                os << it->id << " ";
+            }
+            os << "\n";
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "e. search() by key 1 for removed id 5 - NULL\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 5;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); app_datap = " << (app_datap == NULL ? "NULL" : "!NULL") << "\n\n";
+
+        os << "f. remove_prefix() key 0 prefix 0 bits - all 8 data nodes removed - return_code = 8\n";
+        return_code = rdx->remove_prefix(0, prefix, 0);
+
+        os << "return_code = rdx->remove_prefix(0, prefix, 0); return_code = " << return_code << "\n";
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "g. insert 16 data nodes again - all return_code = 0\n";
+        for ( int n = 0 ; n < MAX_RDX_NODES ; n++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10;
+            rdx_key[0][3] = n;
+            rdx_key[0][4] = 1;
+
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][MAX_KEY_BYTES] = n;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); return_code = " << return_code << "\n";
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 23
+        int return_code;
+        bool inserted;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+            int updates;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 2;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST23.results");
+
+        os << "\n"
+              "TEST 23: Insert or update a data node with upsert()\n"
+              "         Expected Results:\n"
+              "            a. upsert() new keys 10.0.0.1/id 1 - return_code = 0, inserted = 1\n"
+              "            b. upsert() the same keys 3 more times - return_code = 0, inserted = 0, updates = 1 2 3\n"
+              "            c. upsert() new keys 10.0.0.2/id 2 - return_code = 0, inserted = 1\n"
+              "            d. upsert() keys 10.0.0.1/id 2 found in different data nodes - return_code = 1, inserted = 0, id = 1\n"
+              "            e. upsert() keys 10.0.0.1/id 3 only key 0 found - return_code = 1, inserted = 0, id = 1\n"
+              "            f. upsert() new keys 10.0.0.3/id 3 with no free data nodes - return_code = 2, app_datap = NULL\n"
+              "            g. upsert() with key 1 boolean 0 - return_code = 3, app_datap = NULL\n"
+              "            h. verify() - return_code = 0\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        os << "a. upsert() new keys 10.0.0.1/id 1 - return_code = 0, inserted = 1\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 1;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 1;
+        return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted);
+        os << "return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted); return_code = " << return_code << ", inserted = " << inserted << "\n\n";
+        app_datap->id = 1;
+        app_datap->updates = 0;
+
+        os << "b. upsert() the same keys 3 more times - return_code = 0, inserted = 0, updates = 1 2 3\n";
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted);
+            app_datap->updates++;
+            os << "return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted); return_code = " << return_code << ", inserted = " << inserted << ", updates = " << app_datap->updates << "\n";
+        }
+        os << "\n";
+
+        os << "c. upsert() new keys 10.0.0.2/id 2 - return_code = 0, inserted = 1\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 2;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 2;
+        return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted);
+        os << "return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted); return_code = " << return_code << ", inserted = " << inserted << "\n\n";
+        app_datap->id = 2;
+        app_datap->updates = 0;
+
+        os << "d. upsert() keys 10.0.0.1/id 2 found in different data nodes - return_code = 1, inserted = 0, id = 1\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 1;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 2;
+        return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted);
+        os << "return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted); return_code = " << return_code << ", inserted = " << inserted << ", id = " << app_datap->id << "\n\n";
+
+        os << "e. upsert() keys 10.0.0.1/id 3 only key 0 found - return_code = 1, inserted = 0, id = 1\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 1;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 3;
+        return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted);
+        os << "return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted); return_code = " << return_code << ", inserted = " << inserted << ", id = " << app_datap->id << "\n\n";
+
+        os << "f. upsert() new keys 10.0.0.3/id 3 with no free data nodes - return_code = 2, app_datap = NULL\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 3;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 3;
+        return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted);
+        os << "return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted); return_code = " << return_code << ", app_datap = " << (app_datap == NULL ? "NULL" : "!NULL") << "\n\n";
+
+        os << "g. upsert() with key 1 boolean 0 - return_code = 3, app_datap = NULL\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 1;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 1;
+        rdx_key[1][0] = 0;
+        return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted);
+        os << "return_code = rdx->upsert((unsigned char *)rdx_key, &app_datap, &inserted); return_code = " << return_code << ", app_datap = " << (app_datap == NULL ? "NULL" : "!NULL") << "\n\n";
+
+        os << "h. verify() - return_code = 0\n";
+        return_code = rdx->verify(ERR_CODE_PRINT, os);
+        os << "return_code = rdx->verify(ERR_CODE_PRINT, os); verify success(0) or fail(!0) -> return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 24
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+        app_data *app_datap_rekeyed;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 3;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // new key 0 - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char new_key[MAX_KEY_BYTES];
+
+        MKRdxPat<app_data>::iterator it;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST24.results");
+
+        os << "\n"
+              "TEST 24: Change one key of a data node with rekey()\n"
+              "         Expected Results:\n"
+              "            a. insert 3 data nodes - key 0 IPv4 address 10.0.0.n with id n, key 1 the id n\n"
+              "            b. rekey() id 1 key 0 to 10.0.0.9 - return_code = 0, app_datap unchanged\n"
+              "            c. key 0 order - ids 2 3 1, key 1 order - ids 1 2 3\n"
+              "            d. search() by key 0 10.0.0.9 and key 1 id 1 - id = 1\n"
+              "            e. rekey() id 2 key 0 to 10.0.0.9 - already key 0 of id 1 - return_code = 2\n"
+              "            f. rekey() id 2 key 0 to 10.0.0.2 - its own key - return_code = 0\n"
+              "            g. rekey() by key 0 10.0.0.1 - no longer a key - return_code = 1\n"
+              "            h. rekey() with key index 2 - return_code = 3\n"
+              "            i. verify() - return_code = 0\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        os << "a. insert 3 data nodes - key 0 IPv4 address 10.0.0.n with id n, key 1 the id n\n";
+        for ( int n = 1 ; n <= MAX_RDX_NODES ; n++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10;
+            rdx_key[0][4] = n;
+
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][MAX_KEY_BYTES] = n;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); return_code = " << return_code << "\n";
+
+            app_datap->id = n;
+        }
+        os << "\n";
+
+        os << "b. rekey() id 1 key 0 to 10.0.0.9 - return_code = 0, app_datap unchanged\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 1;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+
+        memset(new_key, 0, MAX_KEY_BYTES);
+        new_key[0] = 10;
+        new_key[3] = 9;
+        return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key);
+
+        os << "return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key); return_code = " << return_code << "\n";
+
+        app_datap_rekeyed = rdx->search((unsigned char *)rdx_key);
+        os << "app_datap " << (app_datap == app_datap_rekeyed ? "unchanged" : "changed") << "\n\n";
+
+        os << "c. key 0 order - ids 2 3 1, key 1 order - ids 1 2 3\n";
+        for ( int k = 0 ; k < NUM_KEYS ; k++ )
+        {
+            os << "key " << k << " ids = ";
+            for ( it = rdx->begin(k) ; it != rdx->end(k) ; ++it )
+            {
+                os << it->id << " ";
+            }
+            os << "\n";
+        }
+        os << "\n";
+
+        os << "d. search() by key 0 10.0.0.9 and key 1 id 1 - id = 1\n";
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        memmove(&rdx_key[0][1], new_key, MAX_KEY_BYTES);
+        app_datap = rdx->search((unsigned char *)rdx_key);
+
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); id = " << (app_datap == NULL ? -1 : app_datap->id) << "\n\n";
+
+        os << "e. rekey() id 2 key 0 to 10.0.0.9 - already key 0 of id 1 - return_code = 2\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 2;
+        return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key);
+
+        os << "return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key); return_code = " << return_code << "\n\n";
+
+        os << "f. rekey() id 2 key 0 to 10.0.0.2 - its own key - return_code = 0\n";
+        new_key[3] = 2;
+        return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key);
+
+        os << "return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key); return_code = " << return_code << "\n\n";
+
+        os << "g. rekey() by key 0 10.0.0.1 - no longer a key - return_code = 1\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 1;
+        return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key);
+
+        os << "return_code = rdx->rekey((unsigned char *)rdx_key, 0, new_key); return_code = " << return_code << "\n\n";
+
+        os << "h. rekey() with key index 2 - return_code = 3\n";
+        return_code = rdx->rekey((unsigned char *)rdx_key, 2, new_key);
+
+        os << "return_code = rdx->rekey((unsigned char *)rdx_key, 2, new_key); return_code = " << return_code << "\n\n";
+
+        os << "i. verify() - return_code = 0\n";
+        return_code = rdx->verify(ERR_CODE_PRINT, os);
+        os << "return_code = rdx->verify(ERR_CODE_PRINT, os); verify success(0) or fail(!0) -> return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 25
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 3;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // new key 1 - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char new_key[MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST25.results");
+
+        os << "\n"
+              "TEST 25: Access data nodes by handle with data(), remove(), keys() and rekey()\n"
+              "         Expected Results:\n"
+              "            a. insert 3 data nodes with handles - key 0 IPv4 address 10.0.0.n with id n, key 1 the id n\n"
+              "            b. insert id 2 again - return_code = 1, the handle of id 2\n"
+              "            c. search() by key 1 id 3 - the handle of id 3\n"
+              "            d. data() of each handle - id 1 2 3\n"
+              "            e. keys() of the id 2 handle - key booleans 1, 0a 00 00 02 and 00 00 00 02\n"
+              "            f. rekey() the id 2 handle key 1 to 00 00 00 09 - return_code = 0, search() by key 1 id 9 - id 2\n"
+              "            g. remove() the id 1 handle - id 1, 2 data nodes allocated\n"
+              "            h. data(), remove(), keys() and rekey() of the removed id 1 handle - NULL, NULL, 1 and 1\n"
+              "            i. iterate both key indices - key 0 handles 2 3 ids 2 3, key 1 handles 3 2 ids 3 2\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        MKRdxPat<app_data>::node_handle handle[1+MAX_RDX_NODES];
+        MKRdxPat<app_data>::node_handle h;
+
+        os << "a. insert 3 data nodes with handles - key 0 IPv4 address 10.0.0.n with id n, key 1 the id n\n";
+        for ( int n = 1 ; n <= MAX_RDX_NODES ; n++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10;
+            rdx_key[0][4] = n;
+
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][MAX_KEY_BYTES] = n;
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &handle[n]);
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &handle[" << n << "]); return_code = " << return_code << ", handle[" << n << "] = " << handle[n] << "\n";
+
+            app_datap->id = n;
+        }
+        os << "\n";
+
+        os << "b. insert id 2 again - return_code = 1, the handle of id 2\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 2;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 2;
+        return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &h);
+
+        os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &h); return_code = " << return_code << ", h = " << h << "\n\n";
+
+        os << "c. search() by key 1 id 3 - the handle of id 3\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 3;
+        app_datap = rdx->search((unsigned char *)rdx_key, &h);
+
+        os << "app_datap = rdx->search((unsigned char *)rdx_key, &h); h = " << h << "\n\n";
+
+        os << "d. data() of each handle - id 1 2 3\n";
+        for ( int n = 1 ; n <= MAX_RDX_NODES ; n++ )
+        {
+            app_datap = rdx->data(handle[n]);
+
+            os << "app_datap = rdx->data(handle[" << n << "]); id = " << app_datap->id << "\n";
+        }
+        os << "\n";
+
+        os << "e. keys() of the id 2 handle - key booleans 1, 0a 00 00 02 and 00 00 00 02\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        return_code = rdx->keys(handle[2], (unsigned char *)rdx_key);
+
+        os << "return_code = rdx->keys(handle[2], (unsigned char *)rdx_key); return_code = " << return_code << "\n";
+        print_key((unsigned char *)rdx_key, os, NUM_KEYS, MAX_KEY_BYTES);
+        os << "\n";
+
+        os << "f. rekey() the id 2 handle key 1 to 00 00 00 09 - return_code = 0, search() by key 1 id 9 - id 2\n";
+        memset(new_key, 0, MAX_KEY_BYTES);
+        new_key[MAX_KEY_BYTES-1] = 9;
+        return_code = rdx->rekey(handle[2], 1, new_key);
+
+        os << "return_code = rdx->rekey(handle[2], 1, new_key); return_code = " << return_code << "\n";
+
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 9;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); id = " << (app_datap == NULL ? -1 : app_datap->id) << "\n\n";
+
+        os << "g. remove() the id 1 handle - id 1, 2 data nodes allocated\n";
+        app_datap = rdx->remove(handle[1]);
+
+        os << "app_datap = rdx->remove(handle[1]); id = " << (app_datap == NULL ? -1 : app_datap->id) << "\n";
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "h. data(), remove(), keys() and rekey() of the removed id 1 handle - NULL, NULL, 1 and 1\n";
+        app_datap = rdx->data(handle[1]);
+        os << "app_datap = rdx->data(handle[1]); app_datap = " << (app_datap == NULL ? "NULL" : "!NULL") << "\n";
+        app_datap = rdx->remove(handle[1]);
+        os << "app_datap = rdx->remove(handle[1]); app_datap = " << (app_datap == NULL ? "NULL" : "!NULL") << "\n";
+        return_code = rdx->keys(handle[1], (unsigned char *)rdx_key);
+        os << "return_code = rdx->keys(handle[1], (unsigned char *)rdx_key); return_code = " << return_code << "\n";
+        return_code = rdx->rekey(handle[1], 1, new_key);
+        os << "return_code = rdx->rekey(handle[1], 1, new_key); return_code = " << return_code << "\n\n";
+
+        os << "i. iterate both key indices - key 0 handles 2 3 ids 2 3, key 1 handles 3 2 ids 3 2\n";
+        for ( int k = 0 ; k < NUM_KEYS ; k++ )
+        {
+            for ( MKRdxPat<app_data>::iterator it = rdx->begin(k) ; it != rdx->end(k) ; ++it )
+            {
+                os << "key " << k << "  handle = " << it.handle() << "  id = " << it->id << "\n";
+            }
+        }
+        os << "\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 26
+        int ninserted;
+        int nremoved;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 4;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // number of items in the insert and remove batches
+        const int NUM_INSERTS = 7;
+        const int NUM_REMOVES = 3;
+
+        // key 0 IPv4 address 10.0.0.n and key 1 the id n of each insert batch item
+        const int insert_n[NUM_INSERTS] = {5, 1, 3, 1, 2, 4, 6};
+
+        // NUM_INSERTS items of NUM_KEYS keys of MAX_KEY_BYTES bytes
+        unsigned char rdx_key[NUM_INSERTS][NUM_KEYS][1+MAX_KEY_BYTES];
+
+        app_data *app_datap[NUM_INSERTS];
+        int return_code[NUM_INSERTS];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST26.results");
+
+        os << "\n"
+              "TEST 26: Insert and remove batches of data nodes with insert_batch() and remove_batch()\n"
+              "         Expected Results:\n"
+              "            a. insert_batch() 7 items into a trie of 4 data nodes - key 0 IPv4 address 10.0.0.n, key 1 the id n\n"
+              "               for n = 5 1 3 1 2 4 6 - item 3 repeats item 1 and item 4 has key 1 boolean 0.  the items are\n"
+              "               applied in key 0 order so item 6(10.0.0.6) is the one left with no free data node.\n"
+              "               ninserted = 4, return_code = 0 0 0 1 3 0 2\n"
+              "            b. remove_batch() 10.0.0.3/id 3, 10.0.0.9/id 9(not found) and key 0 only 10.0.0.5 - nremoved = 2,\n"
+              "               app_datap id = 3 NULL 5\n"
+              "            c. key 0 order - ids 1 4\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        os << "a. insert_batch() 7 items - ninserted = 4, return_code = 0 0 0 1 3 0 2\n";
+        memset(rdx_key, 0, NUM_INSERTS * NUM_KEYS * (1+MAX_KEY_BYTES));
+        for ( int i = 0 ; i < NUM_INSERTS ; i++ )
+        {
+            rdx_key[i][0][0] = 1;  // set key boolean to 1
+            rdx_key[i][0][1] = 10;
+            rdx_key[i][0][4] = insert_n[i];
+
+            rdx_key[i][1][0] = 1;  // set key boolean to 1
+            rdx_key[i][1][MAX_KEY_BYTES] = insert_n[i];
+        }
+        rdx_key[4][1][0] = 0;  // item 4 key 1 boolean 0
+
+        ninserted = rdx->insert_batch((unsigned char *)rdx_key, NUM_INSERTS, app_datap, return_code);
+
+        os << "ninserted = rdx->insert_batch((unsigned char *)rdx_key, NUM_INSERTS, app_datap, return_code); ninserted = " << ninserted << "\n";
+        os << "return_code = ";
+        for ( int i = 0 ; i < NUM_INSERTS ; i++ )
+        {
+            os << return_code[i] << " ";
+            if ( return_code[i] == 0 )
+            {
+                app_datap[i]->id = insert_n[i];
+            }
+        }
+        os << "\n\n";
+
+        os << "b. remove_batch() 10.0.0.3/id 3, 10.0.0.9/id 9 and key 0 only 10.0.0.5 - nremoved = 2, app_datap id = 3 NULL 5\n";
+        memset(rdx_key, 0, NUM_REMOVES * NUM_KEYS * (1+MAX_KEY_BYTES));
+        for ( int i = 0 ; i < NUM_REMOVES ; i++ )
+        {
+            rdx_key[i][0][0] = 1;  // set key boolean to 1
+            rdx_key[i][0][1] = 10;
+
+            rdx_key[i][1][0] = 1;  // set key boolean to 1
+        }
+        rdx_key[0][0][4] = 3;
+        rdx_key[0][1][MAX_KEY_BYTES] = 3;
+        rdx_key[1][0][4] = 9;
+        rdx_key[1][1][MAX_KEY_BYTES] = 9;
+        rdx_key[2][0][4] = 5;
+        rdx_key[2][1][0] = 0;  // key 0 only
+
+        nremoved = rdx->remove_batch((unsigned char *)rdx_key, NUM_REMOVES, app_datap);
+
+        os << "nremoved = rdx->remove_batch((unsigned char *)rdx_key, NUM_REMOVES, app_datap); nremoved = " << nremoved << "\n";
+        os << "app_datap id = ";
+        for ( int i = 0 ; i < NUM_REMOVES ; i++ )
+        {
+            if ( app_datap[i] == NULL )
+            {
+                os << "NULL ";
+            }
+            else
+            {
+                os << app_datap[i]->id << " ";
+            }
+        }
+        os << "\n\n";
+
+        os << "c. key 0 order - ids 1 4\n";
+        os << "key 0 ids = ";
+        for ( MKRdxPat<app_data>::iterator it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n";
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 27
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 10;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST27.results");
+
+        os << "\n"
+              "TEST 27: Insert and search a nearly sequential key stream with insert_hint() and search_hint()\n"
+              "         Expected Results:\n"
+              "            a. insert_hint() 8 data nodes - key 0 IPv4 address 10.0.0.n with id n, key 1 the id n, each call\n"
+              "               starting from the hint of the previous one - return_code = 0 and hint = the new data node handle\n"
+              "            b. insert_hint() id 3 again - return_code = 1, hint = the handle of id 3\n"
+              "            c. remove() id 5 and insert_hint() id 9 with the stale id 5 handle as hint - return_code = 0\n"
+              "            d. search_hint() id 7 with hint 0 - id 7, hint = the handle of id 7\n"
+              "            e. search_hint() id 2 key 0 only from the id 7 hint - id 2, hint = the handle of id 2\n"
+              "            f. search_hint() 10.0.0.20 - NULL, hint unchanged\n"
+              "            g. iterate key 0 - ids 1 2 3 4 6 7 8 9 with the same handles as a. and c.\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        MKRdxPat<app_data>::node_handle hint = 0;
+
+        os << "a. insert_hint() 8 data nodes - key 0 IPv4 address 10.0.0.n with id n, key 1 the id n\n";
+        for ( int n = 1 ; n <= 8 ; n++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10;
+            rdx_key[0][4] = n;
+
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][MAX_KEY_BYTES] = n;
+
+            return_code = rdx->insert_hint((unsigned char *)rdx_key, &app_datap, &hint);
+
+            if ( return_code == 0 )
+            {
+                app_datap->id = n;
+            }
+
+            os << "return_code = rdx->insert_hint((unsigned char *)rdx_key, &app_datap, &hint); id = " << n
+               << " return_code = " << return_code << " hint = " << hint << "\n";
+        }
+        os << "\n";
+
+        os << "b. insert_hint() id 3 again - return_code = 1, hint = the handle of id 3\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 3;
+
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 3;
+
+        return_code = rdx->insert_hint((unsigned char *)rdx_key, &app_datap, &hint);
+
+        os << "return_code = rdx->insert_hint((unsigned char *)rdx_key, &app_datap, &hint); return_code = " << return_code
+           << " hint = " << hint << " id = " << app_datap->id << "\n\n";
+
+        os << "c. remove() id 5 and insert_hint() id 9 with the stale id 5 handle as hint - return_code = 0\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 5;
+
+        app_datap = rdx->search((unsigned char *)rdx_key, &hint);
+        app_datap = rdx->remove(hint);
+
+        os << "app_datap = rdx->remove(hint); hint = " << hint << " id = " << app_datap->id << "\n";
+
+        rdx_key[0][4] = 9;
+
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 9;
+
+        return_code = rdx->insert_hint((unsigned char *)rdx_key, &app_datap, &hint);
+
+        if ( return_code == 0 )
+        {
+            app_datap->id = 9;
+        }
+
+        os << "return_code = rdx->insert_hint((unsigned char *)rdx_key, &app_datap, &hint); return_code = " << return_code
+           << " hint = " << hint << "\n\n";
+
+        os << "d. search_hint() id 7 with hint 0 - id 7, hint = the handle of id 7\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 7;
+
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][MAX_KEY_BYTES] = 7;
+
+        hint = 0;
+        app_datap = rdx->search_hint((unsigned char *)rdx_key, &hint);
+
+        os << "app_datap = rdx->search_hint((unsigned char *)rdx_key, &hint); id = " << app_datap->id << " hint = " << hint << "\n\n";
+
+        os << "e. search_hint() id 2 key 0 only from the id 7 hint - id 2, hint = the handle of id 2\n";
+        rdx_key[0][4] = 2;
+        rdx_key[1][0] = 0;  // key 0 only
+
+        app_datap = rdx->search_hint((unsigned char *)rdx_key, &hint);
+
+        os << "app_datap = rdx->search_hint((unsigned char *)rdx_key, &hint); id = " << app_datap->id << " hint = " << hint << "\n\n";
+
+        os << "f. search_hint() 10.0.0.20 - NULL, hint unchanged\n";
+        rdx_key[0][4] = 20;
+
+        app_datap = rdx->search_hint((unsigned char *)rdx_key, &hint);
+
+        os << "app_datap = rdx->search_hint((unsigned char *)rdx_key, &hint); app_datap = " << (app_datap == NULL ? "NULL" : "not NULL")
+           << " hint = " << hint << "\n\n";
+
+        os << "g. iterate key 0 - ids 1 2 3 4 6 7 8 9 with the same handles as a. and c.\n";
+        for ( MKRdxPat<app_data>::iterator it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+        {
+            os << "id = " << it->id << " handle = " << it.handle() << "\n";
+        }
+        os << "rdx - Nodes allocated = " << rdx->alloc_nodes() << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 28
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 8;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // the ids of the data nodes in insert order
+        const int insert_n[MAX_RDX_NODES] = { 5, 1, 7, 3, 8, 2, 6, 4 };
+
+        // the last byte of the key index 0 keys of rank()
+        const int rank_n[3] = { 0, 5, 9 };
+
+        // key index 0 key - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char key[MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST28.results");
+
+        os << "\n"
+              "TEST 28: Order statistics with rank(), select() and sample()\n"
+              "         Expected Results:\n"
+              "            a. insert 8 data nodes into a trie constructed with RDX_ORDER_STATS - key 0 IPv4 address 10.0.0.n\n"
+              "               with id n, key 1 the id 9-n, for n = 5 1 7 3 8 2 6 4\n"
+              "            b. rank() key 0 10.0.0.0, 10.0.0.5 and 10.0.0.9 - 0, 4 and 8\n"
+              "            c. select() key 0 positions 0 to 8 - ids 1 2 3 4 5 6 7 8 and end(0)\n"
+              "            d. select() key 1 positions 0 to 7 - ids 8 7 6 5 4 3 2 1\n"
+              "            e. remove() id 3 - rank() key 0 10.0.0.5 is 3, select() key 0 position 3 is id 5\n"
+              "            f. sample() key 0 7000 times from a std::mt19937_64 - each of ids 1 2 4 5 6 7 8 800 to 1200 times\n"
+              "            g. rank() and select() of a trie constructed without RDX_ORDER_STATS - -2 and end(0)\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, RDX_ORDER_STATS);
+
+        os << "a. insert 8 data nodes - key 0 IPv4 address 10.0.0.n with id n, key 1 the id 9-n\n";
+        for ( int i = 0 ; i < MAX_RDX_NODES ; i++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][1] = 10;
+            rdx_key[0][4] = insert_n[i];
+
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][MAX_KEY_BYTES] = 9 - insert_n[i];
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+
+            if ( return_code == 0 )
+            {
+                app_datap->id = insert_n[i];
+            }
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); id = " << insert_n[i]
+               << " return_code = " << return_code << "\n";
+        }
+        os << "\n";
+
+        os << "b. rank() key 0 10.0.0.0, 10.0.0.5 and 10.0.0.9 - 0, 4 and 8\n";
+        memset(key, 0, MAX_KEY_BYTES);
+        key[0] = 10;
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            key[3] = rank_n[i];
+            os << "return_code = rdx->rank(0, key); key = 10.0.0." << rank_n[i] << " return_code = " << rdx->rank(0, key) << "\n";
+        }
+        os << "\n";
+
+        os << "c. select() key 0 positions 0 to 8 - ids 1 2 3 4 5 6 7 8 and end(0)\n";
+        for ( int i = 0 ; i <= MAX_RDX_NODES ; i++ )
+        {
+            MKRdxPat<app_data>::iterator it = rdx->select(0, i);
+
+            os << "MKRdxPat<app_data>::iterator it = rdx->select(0, " << i << "); ";
+            if ( it == rdx->end(0) )
+            {
+                os << "it == rdx->end(0)\n";
+            }
+            else
+            {
+                os << "id = " << it->id << "\n";
+            }
+        }
+        os << "\n";
+
+        os << "d. select() key 1 positions 0 to 7 - ids 8 7 6 5 4 3 2 1\n";
+        os << "key 1 ids = ";
+        for ( int i = 0 ; i < MAX_RDX_NODES ; i++ )
+        {
+            os << rdx->select(1, i)->id << " ";
+        }
+        os << "\n\n";
+
+        os << "e. remove() id 3 - rank() key 0 10.0.0.5 is 3, select() key 0 position 3 is id 5\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[0][4] = 3;
+
+        app_datap = rdx->remove((unsigned char *)rdx_key);
+
+        os << "app_datap = rdx->remove((unsigned char *)rdx_key); id = " << app_datap->id << "\n";
+
+        key[3] = 5;
+        os << "return_code = rdx->rank(0, key); return_code = " << rdx->rank(0, key) << "\n";
+        os << "MKRdxPat<app_data>::iterator it = rdx->select(0, 3); id = " << rdx->select(0, 3)->id << "\n\n";
+
+        os << "f. sample() key 0 7000 times from a std::mt19937_64 - each of ids 1 2 4 5 6 7 8 800 to 1200 times\n";
+        {
+            std::mt19937_64 gen(28);
+            int count[9] = { 0 };
+
+            for ( int i = 0 ; i < 7000 ; i++ )
+            {
+                MKRdxPat<app_data>::iterator it = rdx->sample(0, gen);
+
+                count[ it == rdx->end(0) ? 0 : it->id ]++;
+            }
+
+            os << "MKRdxPat<app_data>::iterator it = rdx->sample(0, gen); end(0) " << count[0] << " times";
+            for ( int id = 1 ; id <= 8 ; id++ )
+            {
+                os << ", id " << id << ( count[id] >= 800 && count[id] <= 1200 ? " 800 to 1200" : " " + std::to_string(count[id]) )
+                   << " times";
+            }
+            os << "\n\n";
+        }
+
+        delete rdx;
+
+        os << "g. rank() and select() of a trie constructed without RDX_ORDER_STATS - -2 and end(0)\n";
+        rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        os << "return_code = rdx->rank(0, key); return_code = " << rdx->rank(0, key) << "\n";
+        os << "MKRdxPat<app_data>::iterator it = rdx->select(0, 0); it " << ( rdx->select(0, 0) == rdx->end(0) ? "==" : "!=" )
+           << " rdx->end(0)\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 29
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 8;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // key index 0 unique, key index 1 non-unique
+        const unsigned char NONUNIQUE[NUM_KEYS] = { 0, 1 };
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // the VLAN(key index 1) of the data nodes with ids 1 to 6
+        const int vlan_n[6] = { 10, 20, 10, 30, 10, 20 };
+
+        // key index 1 key - MAX_KEY_BYTES bytes with no key boolean
+        unsigned char key[MAX_KEY_BYTES];
+
+        // the data nodes with key index 1 key key
+        std::pair<MKRdxPat<app_data>::iterator, MKRdxPat<app_data>::iterator> range;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST29.results");
+
+        os << "\n"
+              "TEST 29: Non-unique key index with equal_range()\n"
+              "         Expected Results:\n"
+              "            a. insert 6 data nodes into a trie with key index 1 non-unique - key 0 the id n, key 1 the VLAN\n"
+              "               10 20 10 30 10 20 for n = 1 to 6\n"
+              "            b. insert id 7 with key 0 of id 3 - return_code 1 since key index 0 is unique\n"
+              "            c. equal_range() key 1 VLAN 10, 20 and 40 - ids 1 3 5, ids 2 6 and none\n"
+              "            d. search() key 1 VLAN 10 only - id 1, key 0 id 5 and key 1 VLAN 10 - id 5, key 0 id 5 and key 1\n"
+              "               VLAN 20 - NULL\n"
+              "            e. remove() key 1 VLAN 10 only - id 1, equal_range() key 1 VLAN 10 - ids 3 5\n"
+              "            f. rekey() id 2 key 1 to VLAN 10 - return_code 0, equal_range() key 1 VLAN 10 - ids 3 5 2\n"
+              "            g. iterate key 1 - ids 3 5 2 6 4\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, 0, NONUNIQUE);
+
+        os << "a. insert 6 data nodes - key 0 the id n, key 1 the VLAN 10 20 10 30 10 20 for n = 1 to 6\n";
+        for ( int i = 0 ; i < 6 ; i++ )
+        {
+            memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+            rdx_key[0][0] = 1;  // set key boolean to 1
+            rdx_key[0][4] = i+1;
+            rdx_key[1][0] = 1;  // set key boolean to 1
+            rdx_key[1][4] = vlan_n[i];
+
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+
+            if ( return_code == 0 )
+            {
+                app_datap->id = i+1;
+            }
+
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); id = " << i+1 << " VLAN = " << vlan_n[i]
+               << " return_code = " << return_code << "\n";
+        }
+        os << "\n";
+
+        os << "b. insert id 7 with key 0 of id 3 - return_code 1 since key index 0 is unique\n";
+        rdx_key[0][4] = 3;
+        rdx_key[1][4] = 10;
+        return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+        os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); return_code = " << return_code << "\n\n";
+
+        os << "c. equal_range() key 1 VLAN 10, 20 and 40 - ids 1 3 5, ids 2 6 and none\n";
+        memset(key, 0, MAX_KEY_BYTES);
+        for ( int v = 10 ; v <= 40 ; v += 10 )
+        {
+            if ( v == 30 )
+            {
+                continue;
+            }
+
+            key[3] = v;
+            range = rdx->equal_range(1, key);
+
+            os << "range = rdx->equal_range(1, key); VLAN = " << v << " ids = ";
+            for ( MKRdxPat<app_data>::iterator it = range.first ; it != range.second ; ++it )
+            {
+                os << it->id << " ";
+            }
+            os << "\n";
+        }
+        os << "\n";
+
+        os << "d. search() key 1 VLAN 10 only - id 1, key 0 id 5 and key 1 VLAN 10 - id 5, key 0 id 5 and key 1 VLAN 20 - NULL\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][4] = 10;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); key 1 VLAN 10 id = " << app_datap->id << "\n";
+
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][4] = 5;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); key 0 id 5 key 1 VLAN 10 id = " << app_datap->id << "\n";
+
+        rdx_key[1][4] = 20;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); key 0 id 5 key 1 VLAN 20 app_datap "
+           << ( app_datap == NULL ? "== NULL" : "!= NULL" ) << "\n\n";
+
+        os << "e. remove() key 1 VLAN 10 only - id 1, equal_range() key 1 VLAN 10 - ids 3 5\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][4] = 10;
+        app_datap = rdx->remove((unsigned char *)rdx_key);
+        os << "app_datap = rdx->remove((unsigned char *)rdx_key); id = " << app_datap->id << "\n";
+
+        key[3] = 10;
+        range = rdx->equal_range(1, key);
+        os << "range = rdx->equal_range(1, key); VLAN = 10 ids = ";
+        for ( MKRdxPat<app_data>::iterator it = range.first ; it != range.second ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+
+        os << "f. rekey() id 2 key 1 to VLAN 10 - return_code 0, equal_range() key 1 VLAN 10 - ids 3 5 2\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][4] = 2;
+        return_code = rdx->rekey((unsigned char *)rdx_key, 1, key);
+        os << "return_code = rdx->rekey((unsigned char *)rdx_key, 1, key); return_code = " << return_code << "\n";
+
+        range = rdx->equal_range(1, key);
+        os << "range = rdx->equal_range(1, key); VLAN = 10 ids = ";
+        for ( MKRdxPat<app_data>::iterator it = range.first ; it != range.second ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+
+        os << "g. iterate key 1 - ids 3 5 2 6 4\n";
+        os << "key 1 ids = ";
+        for ( MKRdxPat<app_data>::iterator it = rdx->begin(1) ; it != rdx->end(1) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 30
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 8;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // the last byte of the IPv4 address keys of the old(a) and new(b) snapshots
+        const int a_n[5] = { 1, 2, 3, 5, 8 };
+        const int b_n[5] = { 2, 3, 4, 8, 9 };
+
+        ofstream os;
+        os.open("MKRdxPat.TEST30.results");
+
+        os << "\n"
+              "TEST 30: diff(), set_union() and set_intersection() of two tries\n"
+              "         Expected Results:\n"
+              "            a. insert 5 data nodes into trie a - key 0 IPv4 address 10.0.0.n with id n for n = 1 2 3 5 8 -\n"
+              "               and 5 data nodes into trie b - 10.0.0.n with id 100+n for n = 2 3 4 8 9\n"
+              "            b. diff() a b key 0 - removed 1, both 2 102, both 3 103, added 104, removed 5, both 8 108,\n"
+              "               added 109 - return_code 4\n"
+              "            c. set_union() a b key 0 - ids 1 2 3 104 5 8 109\n"
+              "            d. set_intersection() a b key 0 - ids 2 3 8\n"
+              "            e. diff() a and an empty trie key 0 - removed 1 2 3 5 8 - return_code 5\n"
+              "            f. diff() a b key 1 - return_code -1(key index out of range)\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx_a = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+        MKRdxPat<app_data> *rdx_b = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        os << "a. insert 5 data nodes into trie a - 10.0.0.n with id n, and 5 into trie b - 10.0.0.n with id 100+n\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        for ( int i = 0 ; i < 5 ; i++ )
+        {
+            rdx_key[0][4] = a_n[i];
+            return_code = rdx_a->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = a_n[i];
+            os << "return_code = rdx_a->insert((unsigned char *)rdx_key, &app_datap); id = " << a_n[i]
+               << " return_code = " << return_code << "\n";
+        }
+        for ( int i = 0 ; i < 5 ; i++ )
+        {
+            rdx_key[0][4] = b_n[i];
+            return_code = rdx_b->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = 100+b_n[i];
+            os << "return_code = rdx_b->insert((unsigned char *)rdx_key, &app_datap); id = " << 100+b_n[i]
+               << " return_code = " << return_code << "\n";
+        }
+        os << "\n";
+
+        os << "b. diff() a b key 0 - removed 1, both 2 102, both 3 103, added 104, removed 5, both 8 108, added 109\n";
+        return_code = MKRdxPat<app_data>::diff(rdx_a, rdx_b, 0,
+                          [&](app_data *b_datap, const unsigned char *key) -> int
+                          {
+                              os << "added   10.0.0." << (int)key[3] << " id = " << b_datap->id << "\n";
+                              return 0;
+                          },
+                          [&](app_data *a_datap, const unsigned char *key) -> int
+                          {
+                              os << "removed 10.0.0." << (int)key[3] << " id = " << a_datap->id << "\n";
+                              return 0;
+                          },
+                          [&](app_data *a_datap, app_data *b_datap, const unsigned char *key) -> int
+                          {
+                              os << "both    10.0.0." << (int)key[3] << " ids = " << a_datap->id << " " << b_datap->id << "\n";
+                              return 0;
+                          });
+        os << "return_code = MKRdxPat<app_data>::diff(rdx_a, rdx_b, 0, ...); return_code = " << return_code << "\n\n";
+
+        os << "c. set_union() a b key 0 - ids 1 2 3 104 5 8 109\n";
+        MKRdxPat<app_data> *rdx = MKRdxPat<app_data>::set_union(rdx_a, rdx_b, 0);
+        os << "MKRdxPat<app_data> *rdx = MKRdxPat<app_data>::set_union(rdx_a, rdx_b, 0); ids = ";
+        for ( MKRdxPat<app_data>::iterator it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+        delete rdx;
+
+        os << "d. set_intersection() a b key 0 - ids 2 3 8\n";
+        rdx = MKRdxPat<app_data>::set_intersection(rdx_a, rdx_b, 0);
+        os << "MKRdxPat<app_data> *rdx = MKRdxPat<app_data>::set_intersection(rdx_a, rdx_b, 0); ids = ";
+        for ( MKRdxPat<app_data>::iterator it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+        delete rdx;
+
+        os << "e. diff() a and an empty trie key 0 - removed 1 2 3 5 8\n";
+        rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+        return_code = MKRdxPat<app_data>::diff(rdx_a, rdx, 0,
+                          [&](app_data *b_datap, const unsigned char *key) -> int
+                          {
+                              os << "added   10.0.0." << (int)key[3] << " id = " << b_datap->id << "\n";
+                              return 0;
+                          },
+                          [&](app_data *a_datap, const unsigned char *key) -> int
+                          {
+                              os << "removed 10.0.0." << (int)key[3] << " id = " << a_datap->id << "\n";
+                              return 0;
+                          },
+                          [&](app_data *a_datap, app_data *b_datap, const unsigned char *key) -> int
+                          {
+                              os << "both    10.0.0." << (int)key[3] << " ids = " << a_datap->id << " " << b_datap->id << "\n";
+                              return 0;
+                          });
+        os << "return_code = MKRdxPat<app_data>::diff(rdx_a, rdx, 0, ...); return_code = " << return_code << "\n\n";
+        delete rdx;
+
+        os << "f. diff() a b key 1 - return_code -1(key index out of range)\n";
+        return_code = MKRdxPat<app_data>::diff(rdx_a, rdx_b, 1,
+                          [](app_data *b_datap, const unsigned char *key) -> int { return 0; },
+                          [](app_data *a_datap, const unsigned char *key) -> int { return 0; },
+                          [](app_data *a_datap, app_data *b_datap, const unsigned char *key) -> int { return 0; });
+        os << "return_code = MKRdxPat<app_data>::diff(rdx_a, rdx_b, 1, ...); return_code = " << return_code << "\n\n";
+
+        delete rdx_a;
+        delete rdx_b;
+
+        os.close();
+    }
+
+    {  // TEST 31
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 8;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // the expiry times of the data nodes with ids 1 to 6 - 0 no expiry
+        const unsigned long long expiry_n[6] = { 100, 30, 0, 70, 5000, 30 };
+
+        // the handles of the data nodes with ids 1 to 6
+        MKRdxPat<app_data>::node_handle handle[6];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST31.results");
+
+        os << "\n"
+              "TEST 31: Data node expiry with set_expiry() and expire()\n"
+              "         Expected Results:\n"
+              "            a. insert 6 data nodes into a trie constructed with RDX_EXPIRY - key 0 IPv4 address 10.0.0.n with\n"
+              "               id n - and set_expiry() 100 30 0(none) 70 5000 30 for n = 1 to 6\n"
+              "            b. expire() now 50 - expired ids 2 6 - return_code 2\n"
+              "            c. set_expiry() id 4 to 120, expire() now 100 - expired id 1 - return_code 1\n"
+              "            d. expire() now 200 with cb keeping id 4 by set_expiry() 300 - return_code 0, expiry() id 4 300\n"
+              "            e. expire() now 1000 budget 0 - return_code 0, expire() now 1000 budget 1 - expired id 4 -\n"
+              "               return_code 1\n"
+              "            f. expire() now 18446744073709551615 - expired id 5 - return_code 1, id 3 with no expiry remains\n"
+              "            g. insert ids 7 8 9 due at once, expire() budget 2 with cb keeping each by set_expiry() 0 - kept ids\n"
+              "               7 8 - return_code 0, then expire() - expired id 9 - return_code 1\n"
+              "            h. expire() and set_expiry() of a trie constructed without RDX_EXPIRY - -1 and 2\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, RDX_EXPIRY);
+
+        os << "a. insert 6 data nodes - 10.0.0.n with id n - and set_expiry() 100 30 0(none) 70 5000 30 for n = 1 to 6\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        for ( int i = 0 ; i < 6 ; i++ )
+        {
+            rdx_key[0][4] = i+1;
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &handle[i]);
+            app_datap->id = i+1;
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &handle); id = " << i+1
+               << " return_code = " << return_code << "\n";
+
+            return_code = rdx->set_expiry(handle[i], expiry_n[i]);
+            os << "return_code = rdx->set_expiry(handle, " << expiry_n[i] << "); return_code = " << return_code << "\n";
+        }
+        os << "\n";
+
+        auto expired = [&](app_data *app_datap, MKRdxPat<app_data>::node_handle handle) -> int
+                       {
+                           os << "expired id = " << app_datap->id << "\n";
+                           return 0;
+                       };
+
+        os << "b. expire() now 50 - expired ids 2 6\n";
+        return_code = rdx->expire(50, MAX_RDX_NODES, expired);
+        os << "return_code = rdx->expire(50, MAX_RDX_NODES, cb); return_code = " << return_code << "\n\n";
+
+        os << "c. set_expiry() id 4 to 120, expire() now 100 - expired id 1\n";
+        return_code = rdx->set_expiry(handle[3], 120);
+        os << "return_code = rdx->set_expiry(handle, 120); return_code = " << return_code << "\n";
+        return_code = rdx->expire(100, MAX_RDX_NODES, expired);
+        os << "return_code = rdx->expire(100, MAX_RDX_NODES, cb); return_code = " << return_code << "\n\n";
+
+        os << "d. expire() now 200 with cb keeping id 4 by set_expiry() 300\n";
+        return_code = rdx->expire(200, MAX_RDX_NODES, [&](app_data *app_datap, MKRdxPat<app_data>::node_handle handle) -> int
+                                                      {
+                                                          os << "kept id = " << app_datap->id << "\n";
+                                                          return rdx->set_expiry(handle, 300);
+                                                      });
+        os << "return_code = rdx->expire(200, MAX_RDX_NODES, cb); return_code = " << return_code << "\n";
+        os << "unsigned long long t = rdx->expiry(handle); t = " << rdx->expiry(handle[3]) << "\n\n";
+
+        os << "e. expire() now 1000 budget 0, expire() now 1000 budget 1 - expired id 4\n";
+        return_code = rdx->expire(1000, 0, expired);
+        os << "return_code = rdx->expire(1000, 0, cb); return_code = " << return_code << "\n";
+        return_code = rdx->expire(1000, 1, expired);
+        os << "return_code = rdx->expire(1000, 1, cb); return_code = " << return_code << "\n\n";
+
+        os << "f. expire() now 18446744073709551615 - expired id 5, id 3 with no expiry remains\n";
+        return_code = rdx->expire(~0ULL, MAX_RDX_NODES, expired);
+        os << "return_code = rdx->expire(~0ULL, MAX_RDX_NODES, cb); return_code = " << return_code << "\n";
+        os << "ids = ";
+        for ( MKRdxPat<app_data>::iterator it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+
+        os << "g. insert ids 7 8 9 due at once, expire() budget 2 with cb keeping each by set_expiry() 0, then expire()\n";
+        for ( int i = 7 ; i <= 9 ; i++ )
+        {
+            MKRdxPat<app_data>::node_handle h;
+
+            rdx_key[0][4] = i;
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &h);
+            app_datap->id = i;
+            return_code |= rdx->set_expiry(h, 1);
+            os << "insert() and set_expiry(handle, 1) id = " << i << " return_code = " << return_code << "\n";
+        }
+        return_code = rdx->expire(~0ULL, 2, [&](app_data *app_datap, MKRdxPat<app_data>::node_handle handle) -> int
+                                            {
+                                                os << "kept id = " << app_datap->id << "\n";
+                                                rdx->set_expiry(handle, 0);
+                                                return 0;
+                                            });
+        os << "return_code = rdx->expire(~0ULL, 2, cb); return_code = " << return_code << "\n";
+        return_code = rdx->expire(~0ULL, MAX_RDX_NODES, expired);
+        os << "return_code = rdx->expire(~0ULL, MAX_RDX_NODES, cb); return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os << "h. expire() and set_expiry() of a trie constructed without RDX_EXPIRY - -1 and 2\n";
+        rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &handle[0]);
+        os << "return_code = rdx->expire(50, MAX_RDX_NODES); return_code = " << rdx->expire(50, MAX_RDX_NODES) << "\n";
+        os << "return_code = rdx->set_expiry(handle, 50); return_code = " << rdx->set_expiry(handle[0], 50) << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 32
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 4;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST32.results");
+
+        os << "\n"
+              "TEST 32: Eviction of a data node not recently used when inserting into a full trie\n"
+              "         Expected Results:\n"
+              "            a. insert 4 data nodes into a trie of 4 data nodes constructed with RDX_EVICT - key 0 IPv4 address\n"
+              "               10.0.0.n with id n - return_code 0 for each\n"
+              "            b. insert 10.0.0.5 - return_code 0 - id 1 evicted, ids 2 3 4 5 remain\n"
+              "            c. search 10.0.0.3 - found id 3\n"
+              "            d. insert 10.0.0.6 - return_code 0 - id 2 evicted, ids 3 4 5 6 remain\n"
+              "            e. insert 10.0.0.7 - return_code 0 - id 3 found in c is passed over, id 4 evicted, ids 3 5 6 7 remain\n"
+              "            f. insert into a full trie constructed without RDX_EVICT - return_code 2\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, RDX_EVICT);
+
+        auto print_ids = [&]()
+                         {
+                             os << "ids = ";
+                             for ( MKRdxPat<app_data>::iterator it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+                             {
+                                 os << it->id << " ";
+                             }
+                             os << "\n\n";
+                         };
+
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+
+        os << "a. insert 4 data nodes - 10.0.0.n with id n for n = 1 to 4\n";
+        for ( int i = 1 ; i <= 4 ; i++ )
+        {
+            rdx_key[0][4] = i;
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = i;
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); id = " << i
+               << " return_code = " << return_code << "\n";
+        }
+        print_ids();
+
+        os << "b. insert 10.0.0.5 - id 1 evicted\n";
+        rdx_key[0][4] = 5;
+        return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+        app_datap->id = 5;
+        os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); id = 5 return_code = " << return_code << "\n";
+        print_ids();
+
+        os << "c. search 10.0.0.3\n";
+        rdx_key[0][4] = 3;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); id = " << app_datap->id << "\n\n";
+
+        os << "d. insert 10.0.0.6 - id 2 evicted\n";
+        rdx_key[0][4] = 6;
+        return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+        app_datap->id = 6;
+        os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); id = 6 return_code = " << return_code << "\n";
+        print_ids();
+
+        os << "e. insert 10.0.0.7 - id 3 passed over, id 4 evicted\n";
+        rdx_key[0][4] = 7;
+        return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+        app_datap->id = 7;
+        os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); id = 7 return_code = " << return_code << "\n";
+        print_ids();
+
+        delete rdx;
+
+        os << "f. insert into a full trie constructed without RDX_EVICT - return_code 2\n";
+        rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+        for ( int i = 1 ; i <= 5 ; i++ )
+        {
+            rdx_key[0][4] = i;
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); return_code = " << return_code << "\n";
+        }
+        os << "\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 33
+        int return_code;
+
+        // the number of app_data objects constructed and not yet destroyed
+        int live = 0;
+
+
+        // application data of type app_data defined here - not trivially copyable
+        struct app_data
+        {
+            app_data(int *l) : id(0), live(l) { (*live)++; }
+            app_data(int i, const char *n, int *l) : id(i), name(n), live(l) { (*live)++; }
+            app_data(const app_data &a) : id(a.id), name(a.name), live(a.live) { (*live)++; }
+            ~app_data() { (*live)--; }
+
+            int id;
+            std::string name;
+            int *live;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 4;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST33.results");
+
+        os << "\n"
+              "TEST 33: Construction, destruction and copy of an app_data with a std::string with emplace()\n"
+              "         Expected Results:\n"
+              "            a. emplace() 3 data nodes - key 0 IPv4 address 10.0.0.n with id n and name host-n - return_code 0\n"
+              "               for each, live app_data 3\n"
+              "            b. search() 10.0.0.2 - id 2 name host-2\n"
+              "            c. remove() 10.0.0.2 - the removed app_data is still readable - id 2 name host-2, live app_data 3\n"
+              "            d. emplace() 10.0.0.1 again - return_code 1, live app_data 3\n"
+              "            e. emplace() 10.0.0.4 - the removed app_data is destroyed when its data node is reused - live\n"
+              "               app_data 3\n"
+              "            f. chg_max_rdx_nodes() to 8 - each app_data copied - ids 1 3 4 names host-1 host-3 host-4, live\n"
+              "               app_data 6\n"
+              "            g. delete both tries - live app_data 0\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        const char *name[5] = { "", "host-1", "host-2", "host-3", "host-4" };
+
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+
+        os << "a. emplace() 3 data nodes - 10.0.0.n with id n and name host-n for n = 1 to 3\n";
+        for ( int i = 1 ; i <= 3 ; i++ )
+        {
+            rdx_key[0][4] = i;
+            return_code = rdx->emplace((unsigned char *)rdx_key, &app_datap, i, name[i], &live);
+            os << "return_code = rdx->emplace((unsigned char *)rdx_key, &app_datap, " << i << ", \"" << name[i]
+               << "\", &live); return_code = " << return_code << "\n";
+        }
+        os << "live = " << live << "\n\n";
+
+        os << "b. search() 10.0.0.2\n";
+        rdx_key[0][4] = 2;
+        app_datap = rdx->search((unsigned char *)rdx_key);
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); id = " << app_datap->id << " name = " << app_datap->name << "\n\n";
+
+        os << "c. remove() 10.0.0.2\n";
+        app_datap = rdx->remove((unsigned char *)rdx_key);
+        os << "app_datap = rdx->remove((unsigned char *)rdx_key); id = " << app_datap->id << " name = " << app_datap->name << "\n";
+        os << "live = " << live << "\n\n";
+
+        os << "d. emplace() 10.0.0.1 again\n";
+        rdx_key[0][4] = 1;
+        return_code = rdx->emplace((unsigned char *)rdx_key, &app_datap, 5, "host-5", &live);
+        os << "return_code = rdx->emplace((unsigned char *)rdx_key, &app_datap, 5, \"host-5\", &live); return_code = "
+           << return_code << "\n";
+        os << "live = " << live << "\n\n";
+
+        os << "e. emplace() 10.0.0.4\n";
+        rdx_key[0][4] = 4;
+        return_code = rdx->emplace((unsigned char *)rdx_key, &app_datap, 4, name[4], &live);
+        os << "return_code = rdx->emplace((unsigned char *)rdx_key, &app_datap, 4, \"host-4\", &live); return_code = "
+           << return_code << "\n";
+        os << "live = " << live << "\n\n";
+
+        os << "f. chg_max_rdx_nodes() to 8\n";
+        MKRdxPat<app_data> *rdx_new = rdx->chg_max_rdx_nodes(8);
+        for ( MKRdxPat<app_data>::iterator it = rdx_new->begin(0) ; it != rdx_new->end(0) ; ++it )
+        {
+            os << "id = " << it->id << " name = " << it->name << "\n";
+        }
+        os << "live = " << live << "\n\n";
+
+        os << "g. delete both tries\n";
+        delete rdx;
+        delete rdx_new;
+        os << "live = " << live << "\n\n";
+
+        os.close();
+    }
+
+    {  // TEST 34
+        int return_code;
+
+        // the bytes currently allocated through the counting_allocator
+        long bytes = 0;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 8;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        typedef MKRdxPat<app_data, counting_allocator<unsigned char> > MKRdxPatCA;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST34.results");
+
+        os << "\n"
+              "TEST 34: Trie storage from an allocator template argument\n"
+              "         Expected Results:\n"
+              "            a. construct a trie with a counting_allocator - the bytes allocated through it cover the trie\n"
+              "               size(bsize()) - 1\n"
+              "            b. insert 3 data nodes - key 0 IPv4 address 10.0.0.n with id n - return_code 0 for each\n"
+              "            c. chg_max_rdx_nodes() to 16 - the new trie is allocated through the same counting_allocator - the\n"
+              "               bytes allocated cover both tries - 1, ids 1 2 3\n"
+              "            d. delete both tries - bytes allocated 0\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        os << "a. construct a trie with a counting_allocator\n";
+        MKRdxPatCA *rdx = new MKRdxPatCA(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, 0, NULL,
+                                         counting_allocator<unsigned char>(&bytes));
+        os << "bytes >= rdx->bsize() = " << ( (size_t)bytes >= rdx->bsize() ) << "\n\n";
+
+        os << "b. insert 3 data nodes - 10.0.0.n with id n for n = 1 to 3\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        for ( int i = 1 ; i <= 3 ; i++ )
+        {
+            rdx_key[0][4] = i;
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = i;
+            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); id = " << i
+               << " return_code = " << return_code << "\n";
+        }
+        os << "\n";
+
+        os << "c. chg_max_rdx_nodes() to 16\n";
+        MKRdxPatCA *rdx_new = rdx->chg_max_rdx_nodes(16);
+        os << "bytes >= rdx->bsize() + rdx_new->bsize() = " << ( (size_t)bytes >= rdx->bsize() + rdx_new->bsize() ) << "\n";
+        os << "ids = ";
+        for ( MKRdxPatCA::iterator it = rdx_new->begin(0) ; it != rdx_new->end(0) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n\n";
+
+        os << "d. delete both tries\n";
+        delete rdx;
+        delete rdx_new;
+        os << "bytes = " << bytes << "\n\n";
+
+        os.close();
+    }
+
+    {  // TEST 35
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 4;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        MKRdxPat<app_data>::node_handle handle;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST35.results");
+
+        os << "\n"
+              "TEST 35: Empty a full trie with clear() and fill it again\n"
+              "         Expected Results:\n"
+              "            a. insert 4 data nodes into a trie of 4 data nodes - key 0 IPv4 address 10.0.0.n and key 1 10.0.1.n\n"
+              "               with id n - return_code 0 for each, insert a 5th - return_code 2\n"
+              "            b. clear() - 0 data nodes allocated, search() of 10.0.0.1 and data() of its handle - NULL\n"
+              "            c. insert 4 data nodes with id n+4 - return_code 0 for each, insert a 5th - return_code 2, ids 5 6 7 8\n"
+              "            d. remove() id 6 and clear() again, insert id 9 - return_code 0, ids 9, verify() - 0\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        auto insert_n = [&](int n, int id)
+                        {
+                            rdx_key[0][4] = n;
+                            rdx_key[1][4] = n;
+                            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap);
+                            if ( return_code == 0 )
+                            {
+                                app_datap->id = id;
+                            }
+                            os << "return_code = rdx->insert((unsigned char *)rdx_key, &app_datap); 10.0.0." << n
+                               << " return_code = " << return_code << "\n";
+                        };
+
+        auto print_ids = [&]()
+                         {
+                             os << "ids = ";
+                             for ( MKRdxPat<app_data>::iterator it = rdx->begin(0) ; it != rdx->end(0) ; ++it )
+                             {
+                                 os << it->id << " ";
+                             }
+                             os << "\n\n";
+                         };
+
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        rdx_key[1][1] = 10;
+        rdx_key[1][3] = 1;
+
+        os << "a. insert 4 data nodes - 10.0.0.n and 10.0.1.n with id n for n = 1 to 4, and a 5th\n";
+        for ( int i = 1 ; i <= 5 ; i++ )
+        {
+            insert_n(i, i);
+        }
+        os << "\n";
+
+        rdx_key[0][4] = 1;
+        rdx_key[1][4] = 1;
+        rdx->search((unsigned char *)rdx_key, &handle);
+
+        os << "b. clear()\n";
+        rdx->clear();
+        os << "rdx->clear(); alloc_nodes = " << rdx->alloc_nodes() << "\n";
+        app_datap = rdx->search((unsigned char *)rdx_key);
+        os << "app_datap = rdx->search((unsigned char *)rdx_key); app_datap = " << ( app_datap == NULL ? "NULL" : "not NULL" ) << "\n";
+        app_datap = rdx->data(handle);
+        os << "app_datap = rdx->data(handle); app_datap = " << ( app_datap == NULL ? "NULL" : "not NULL" ) << "\n\n";
+
+        os << "c. insert 4 data nodes with id n+4 and a 5th\n";
+        for ( int i = 1 ; i <= 5 ; i++ )
+        {
+            insert_n(i, i+4);
+        }
+        print_ids();
+
+        os << "d. remove() id 6, clear() again and insert id 9\n";
+        rdx_key[0][4] = 2;
+        rdx_key[1][4] = 2;
+        app_datap = rdx->remove((unsigned char *)rdx_key);
+        os << "app_datap = rdx->remove((unsigned char *)rdx_key); id = " << app_datap->id << "\n";
+        rdx->clear();
+        insert_n(3, 9);
+        print_ids();
+        return_code = rdx->verify(ERR_CODE, os);
+        os << "return_code = rdx->verify(ERR_CODE, os); return_code = " << return_code << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 36
+        int return_code;
+
+
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 16;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST36.results");
+
+        os << "\n"
+              "TEST 36: Locality aware branch node allocation gives the same trie as the branch node free list\n"
+              "         Expected Results:\n"
+              "            a. construct a trie without RDX_LOCALITY and one with RDX_LOCALITY\n"
+              "            b. insert 16 data nodes into each - key IPv4 address 10.0.0.n with id n - the ids of each trie\n"
+              "               are 1 to 16\n"
+              "            c. remove() the odd ids and insert 10.0.1.n with id n+16 for n = 1 to 8 into each - the ids of\n"
+              "               each trie are the same, a search() of every key finds the same id in each trie\n"
+              "            d. clear() each trie and insert 10.0.0.1 - verify() of each trie - 0\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        os << "a. construct a trie without RDX_LOCALITY and one with RDX_LOCALITY\n\n";
+        MKRdxPat<app_data> *rdx[2];
+        rdx[0] = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+        rdx[1] = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, RDX_LOCALITY);
+
+        auto insert_n = [&](int t, int b, int n, int id)
+                        {
+                            rdx_key[0][3] = b;
+                            rdx_key[0][4] = n;
+                            return_code = rdx[t]->insert((unsigned char *)rdx_key, &app_datap);
+                            if ( return_code == 0 )
+                            {
+                                app_datap->id = id;
+                            }
+                            else
+                            {
+                                os << "return_code = rdx[" << t << "]->insert((unsigned char *)rdx_key, &app_datap); 10.0." << b
+                                   << "." << n << " return_code = " << return_code << "\n";
+                            }
+                        };
+
+        auto print_ids = [&](int t)
+                         {
+                             os << "rdx[" << t << "] ids = ";
+                             for ( MKRdxPat<app_data>::iterator it = rdx[t]->begin(0) ; it != rdx[t]->end(0) ; ++it )
+                             {
+                                 os << it->id << " ";
+                             }
+                             os << "\n";
+                         };
+
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+
+        os << "b. insert 16 data nodes - 10.0.0.n with id n for n = 1 to 16\n";
+        for ( int t = 0 ; t < 2 ; t++ )
+        {
+            for ( int i = 1 ; i <= 16 ; i++ )
+            {
+                insert_n(t, 0, i, i);
+            }
+            print_ids(t);
+        }
+        os << "\n";
+
+        os << "c. remove() the odd ids and insert 10.0.1.n with id n+16 for n = 1 to 8\n";
+        for ( int t = 0 ; t < 2 ; t++ )
+        {
+            rdx_key[0][3] = 0;
+            for ( int i = 1 ; i <= 16 ; i += 2 )
+            {
+                rdx_key[0][4] = i;
+                rdx[t]->remove((unsigned char *)rdx_key);
+            }
+            for ( int i = 1 ; i <= 8 ; i++ )
+            {
+                insert_n(t, 1, i, i+16);
+            }
+            print_ids(t);
+        }
+
+        int same = 0;
+        for ( int b = 0 ; b < 2 ; b++ )
+        {
+            rdx_key[0][3] = b;
+            for ( int i = 1 ; i <= 16 ; i++ )
+            {
+                rdx_key[0][4] = i;
+                app_data *a0 = rdx[0]->search((unsigned char *)rdx_key);
+                app_data *a1 = rdx[1]->search((unsigned char *)rdx_key);
+                if ( ( a0 == NULL && a1 == NULL ) || ( a0 != NULL && a1 != NULL && a0->id == a1->id ) )
+                {
+                    same++;
+                }
+            }
+        }
+        os << "searches finding the same id in each trie = " << same << " of 32\n\n";
+
+        os << "d. clear() each trie, insert 10.0.0.1 and verify()\n";
+        for ( int t = 0 ; t < 2 ; t++ )
+        {
+            rdx[t]->clear();
+            insert_n(t, 0, 1, 1);
+            return_code = rdx[t]->verify(ERR_CODE, os);
+            os << "return_code = rdx[" << t << "]->verify(ERR_CODE, os); return_code = " << return_code << "\n";
+        }
+        os << "\n";
+
+        delete rdx[0];
+        delete rdx[1];
+
+        os.close();
+    }
+
+    {  // TEST 37
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // maximum number of data nodes stored in rdx trie - a trie larger than 4 GB
+        const int MAX_RDX_NODES = 30000000;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // the bytes the trie storage allocator is asked for
+        size_t bytes = 0;
+
+        typedef MKRdxPat<app_data, refusing_allocator<unsigned char> > MKRdxPatRA;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST37.results");
+
+        os << "\n"
+              "TEST 37: Trie size beyond 4 GB and the constructor size checks\n"
+              "         Expected Results:\n"
+              "            a. construct a trie of 30000000 data nodes with an allocator that records the bytes asked for\n"
+              "               and throws std::bad_alloc - std::bad_alloc caught, bytes asked for > 4 GB - 1\n"
+              "            b. construct a trie of 1000000000 data nodes with 3 keys - the node subscripts do not fit in\n"
+              "               an int - exception caught\n"
+              "            c. construct a trie with 2 keys of 2000000000 bytes - the key byte subscripts do not fit in an\n"
+              "               int - exception caught\n"
+              "            d. construct a trie of 16 data nodes - bsize() is a size_t - 1\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        os << "a. construct a trie of 30000000 data nodes with a refusing_allocator\n";
+        try
+        {
+            MKRdxPatRA rdx(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, 0, NULL,
+                           refusing_allocator<unsigned char>(&bytes));
+            os << "trie constructed\n";
+        }
+        catch ( std::bad_alloc &e )
+        {
+            os << "std::bad_alloc caught\n";
+        }
+        os << "bytes > 4 GB = " << ( bytes > 0xffffffffULL ) << "\n\n";
+
+        os << "b. construct a trie of 1000000000 data nodes with 3 keys\n";
+        try
+        {
+            MKRdxPat<app_data> rdx(1000000000, 3, MAX_KEY_BYTES);
+            os << "trie constructed\n";
+        }
+        catch ( const char *e )
+        {
+            os << "exception caught - " << e << "\n";
+        }
+        os << "\n";
+
+        os << "c. construct a trie with 2 keys of 2000000000 bytes\n";
+        try
+        {
+            MKRdxPat<app_data> rdx(16, 2, 2000000000);
+            os << "trie constructed\n";
+        }
+        catch ( const char *e )
+        {
+            os << "exception caught - " << e << "\n";
+        }
+        os << "\n";
+
+        os << "d. construct a trie of 16 data nodes\n";
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(16, NUM_KEYS, MAX_KEY_BYTES);
+        os << "bsize() is a size_t = " << std::is_same<decltype(rdx->bsize()), size_t>::value << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 38
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // number of member tries - one per VRF
+        const int MAX_TRIES = 300;
+
+        // maximum number of data nodes stored in the pool shared by all the member tries
+        const int MAX_RDX_NODES = 64;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s) - IPv4 address
+        const int MAX_KEY_BYTES = 4;
+
+        // rdx search key(s) - key[NUM_KEYS][1+MAX_KEY_BYTES]
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        app_data *app_datap;
+        int return_code;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST38.results");
+
+        os << "\n"
+              "TEST 38: Member tries sharing one pool - MKRdxPatGroup\n"
+              "         Expected Results:\n"
+              "            a. insert 10.0.0.n with id 1000*t+n into VRF t, n = 1 to 2 for t = 0 to 19 and n = 1 to 24\n"
+              "               for t = 299 - return code 0 for each, alloc_nodes() = 64\n"
+              "            b. insert one more data node into VRF 7 - return code 2(the pool is full)\n"
+              "            c. search 10.0.0.1 in VRF 0, 19 and 299 - ids 1, 19001 and 299001, VRF 20 - not found\n"
+              "            d. insert 10.0.0.1 into VRF 300 - return code 4(VRF out of range)\n"
+              "            e. clear() VRF 299 - 24 data nodes removed, alloc_nodes(299) = 0, alloc_nodes() = 40\n"
+              "            f. insert 10.0.0.n into VRF 20, n = 1 to 24 - the nodes freed by VRF 299 - return code 0\n"
+              "               for each, alloc_nodes(20) = 24\n"
+              "            g. remove 10.0.0.2 from VRF 3 - id 3002, alloc_nodes(3) = 1, VRF 4 unchanged\n"
+              "            h. for_each() of VRF 20 - ids 20001 to 20024 in key order\n\n";
+
+
+        os << "MAX_TRIES = " << MAX_TRIES << "\n"
+              "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPatGroup<app_data> *group = new MKRdxPatGroup<app_data>(MAX_TRIES, MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+
+        auto insert_n = [&](int t, int n)
+                        {
+                            rdx_key[0][4] = n;
+                            return_code = group->insert(t, (unsigned char *)rdx_key, &app_datap);
+                            if ( return_code == 0 )
+                            {
+                                app_datap->id = 1000*t+n;
+                            }
+                            return return_code;
+                        };
+
+        os << "a. insert 10.0.0.n with id 1000*t+n into VRF t\n";
+        int failed = 0;
+        for ( int t = 0 ; t < 20 ; t++ )
+        {
+            for ( int n = 1 ; n <= 2 ; n++ )
+            {
+                failed += insert_n(t, n) != 0;
+            }
+        }
+        for ( int n = 1 ; n <= 24 ; n++ )
+        {
+            failed += insert_n(299, n) != 0;
+        }
+        os << "failed inserts = " << failed << ", alloc_nodes() = " << group->alloc_nodes() << "\n\n";
+
+        os << "b. insert one more data node into VRF 7\n";
+        os << "return code = " << insert_n(7, 3) << "\n\n";
+
+        os << "c. search 10.0.0.1 in VRF 0, 19, 299 and 20\n";
+        rdx_key[0][4] = 1;
+        const int vrfs[] = { 0, 19, 299, 20 };
+        for ( int t : vrfs )
+        {
+            app_datap = group->search(t, (unsigned char *)rdx_key);
+            if ( app_datap != NULL )
+            {
+                os << "VRF " << t << " id = " << app_datap->id << "\n";
+            }
+            else
+            {
+                os << "VRF " << t << " not found\n";
+            }
+        }
+        os << "\n";
+
+        os << "d. insert 10.0.0.1 into VRF 300\n";
+        os << "return code = " << insert_n(300, 1) << "\n\n";
+
+        os << "e. clear() VRF 299\n";
+        os << "removed = " << group->clear(299) << ", alloc_nodes(299) = " << group->alloc_nodes(299)
+           << ", alloc_nodes() = " << group->alloc_nodes() << "\n\n";
+
+        os << "f. insert 10.0.0.n into VRF 20\n";
+        failed = 0;
+        for ( int n = 1 ; n <= 24 ; n++ )
+        {
+            failed += insert_n(20, n) != 0;
+        }
+        os << "failed inserts = " << failed << ", alloc_nodes(20) = " << group->alloc_nodes(20) << "\n\n";
+
+        os << "g. remove 10.0.0.2 from VRF 3\n";
+        rdx_key[0][4] = 2;
+        app_datap = group->remove(3, (unsigned char *)rdx_key);
+        os << "removed id = " << ( app_datap != NULL ? app_datap->id : -1 ) << ", alloc_nodes(3) = " << group->alloc_nodes(3)
+           << ", alloc_nodes(4) = " << group->alloc_nodes(4) << "\n\n";
+
+        os << "h. for_each() of VRF 20\n";
+        os << "ids = ";
+        group->for_each(20, 0, [&](app_data *app_datap, const unsigned char *key) -> int
+                               {
+                                   os << app_datap->id << " ";
+                                   return 0;
+                               });
+        os << "\n\n";
+
+        delete group;
+
+        os.close();
+    }
+
+    #if MKRDXPAT_SNAPSHOT
+    {  // TEST 39
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 1000;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // rdx search key(s) - key[NUM_KEYS][1+MAX_KEY_BYTES]
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        app_data *app_datap;
+        int return_code;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST39.results");
+
+        os << "\n"
+              "TEST 39: Snapshot save() and map()\n"
+              "         Expected Results:\n"
+              "            a. insert 500 data nodes - key 0 10.0.n/256.n%256 and key 1 n with id n, n = 2 to 1000 even -\n"
+              "               alloc_nodes() = 500\n"
+              "            b. save() the trie - return code 0\n"
+              "            c. map() the snapshot while the trie is in use(the image is relocated) and with the checksum\n"
+              "               checked - alloc_nodes() = 500, every id found by key 0 and by key 1 the same as in the trie,\n"
+              "               verify() return code 0\n"
+              "            d. insert 10.1.0.1/1001 with id 1001 into the mapped trie - return code 0, alloc_nodes() = 501,\n"
+              "               the saved trie unchanged - alloc_nodes() = 500\n"
+              "            e. delete both tries and map() the snapshot again - alloc_nodes() = 500, 10.0.0.2 found with id 2\n"
+              "            f. map() the snapshot as a trie of another app_data - NULL, map() of a missing file - NULL\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        auto set_key = [&](int n)
+                       {
+                           memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+                           rdx_key[0][0] = 1;  // set key boolean to 1
+                           rdx_key[0][1] = 10;
+                           rdx_key[0][3] = n / 256;
+                           rdx_key[0][4] = n % 256;
+                           rdx_key[1][0] = 1;  // set key boolean to 1
+                           rdx_key[1][3] = n / 256;
+                           rdx_key[1][4] = n % 256;
+                       };
+
+        os << "a. insert 500 data nodes with even n\n";
+        for ( int n = 2 ; n <= MAX_RDX_NODES ; n += 2 )
+        {
+            set_key(n);
+            rdx->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = n;
+        }
+        os << "alloc_nodes() = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "b. save() the trie\n";
+        os << "return code = " << rdx->save("MKRdxPat.TEST39.snap") << "\n\n";
+
+        os << "c. map() the snapshot while the trie is in use\n";
+        MKRdxPat<app_data> *rdx_map = MKRdxPat<app_data>::map("MKRdxPat.TEST39.snap", true);
+        os << "alloc_nodes() = " << rdx_map->alloc_nodes() << "\n";
+        int same = 0;
+        for ( int n = 1 ; n <= MAX_RDX_NODES ; n++ )
+        {
+            for ( int k = 0 ; k < NUM_KEYS ; k++ )
+            {
+                set_key(n);
+                rdx_key[1-k][0] = 0;  // set key boolean to 0 - search with key k only
+                app_data *a = rdx->search((unsigned char *)rdx_key);
+                app_data *b = rdx_map->search((unsigned char *)rdx_key);
+                if ( ( a == NULL && b == NULL ) || ( a != NULL && b != NULL && a->id == b->id ) )
+                {
+                    same++;
+                }
+            }
+        }
+        os << "searches finding the same id in each trie = " << same << " of " << 2*MAX_RDX_NODES << "\n";
+        os << "verify() return code = " << rdx_map->verify(ERR_CODE, os) << "\n\n";
+
+        os << "d. insert 10.1.0.1/1001 with id 1001 into the mapped trie\n";
+        set_key(1001);
+        rdx_key[0][2] = 1;
+        return_code = rdx_map->insert((unsigned char *)rdx_key, &app_datap);
+        app_datap->id = 1001;
+        os << "return code = " << return_code << ", alloc_nodes() = " << rdx_map->alloc_nodes() << ", saved trie alloc_nodes() = "
+           << rdx->alloc_nodes() << "\n\n";
+
+        delete rdx_map;
+        delete rdx;
+
+        os << "e. map() the snapshot again\n";
+        rdx_map = MKRdxPat<app_data>::map("MKRdxPat.TEST39.snap");
+        set_key(2);
+        rdx_key[1][0] = 0;  // set key boolean to 0 - search with key 0 only
+        app_datap = rdx_map->search((unsigned char *)rdx_key);
+        os << "alloc_nodes() = " << rdx_map->alloc_nodes() << ", 10.0.0.2 id = " << ( app_datap != NULL ? app_datap->id : -1 ) << "\n\n";
+        delete rdx_map;
+
+        os << "f. map() as a trie of another app_data and map() of a missing file\n";
+        struct other_data
+        {
+            long long id;
+        };
+        MKRdxPat<other_data> *rdx_other = MKRdxPat<other_data>::map("MKRdxPat.TEST39.snap");
+        os << "other app_data = " << ( rdx_other == NULL ? "NULL" : "not NULL" ) << "\n";
+        rdx_map = MKRdxPat<app_data>::map("MKRdxPat.TEST39.missing");
+        os << "missing file = " << ( rdx_map == NULL ? "NULL" : "not NULL" ) << "\n\n";
+
+        os.close();
+    }
+    #endif
+
+    {  // TEST 40
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 100;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // rdx search key(s) - key[NUM_KEYS][1+MAX_KEY_BYTES]
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        app_data *app_datap;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST40.results");
+
+        os << "\n"
+              "TEST 40: Streaming dump() and load()\n"
+              "         Expected Results:\n"
+              "            a. insert 10 data nodes - key 0 10.0.0.n and key 1 n*3 with id n, n = 10 down to 1 - into a trie\n"
+              "               of 100 data nodes - alloc_nodes() = 10\n"
+              "            b. dump() the trie - 10 data nodes written, 56 + 10*(2*4+4) + 8 = 184 bytes\n"
+              "            c. load() the dump into an empty trie of 10 data nodes - return code 0, alloc_nodes() = 10, ids in\n"
+              "               key index 0 order 1 to 10, 10.0.0.7 found with id 7 and key 1 21 found with id 7\n"
+              "            d. load() the dump again - return code 4(the trie is not empty)\n"
+              "            e. load() the dump into a trie of 5 data nodes - return code 2\n"
+              "            f. load() the dump cut short by one byte - return code 5, alloc_nodes() = 0\n"
+              "            g. load() the dump into a trie with 3 byte keys - return code 5\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+
+        auto set_key = [&](int n)
+                       {
+                           memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+                           rdx_key[0][0] = 1;  // set key boolean to 1
+                           rdx_key[0][1] = 10;
+                           rdx_key[0][4] = n;
+                           rdx_key[1][0] = 1;  // set key boolean to 1
+                           rdx_key[1][4] = n*3;
+                       };
+
+        os << "a. insert 10 data nodes\n";
+        for ( int n = 10 ; n >= 1 ; n-- )
+        {
+            set_key(n);
+            rdx->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = n;
+        }
+        os << "alloc_nodes() = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "b. dump() the trie\n";
+        std::stringstream dump;
+        os << "data nodes written = " << rdx->dump(dump) << ", bytes = " << dump.str().size() << "\n\n";
+
+        os << "c. load() the dump into an empty trie of 10 data nodes\n";
+        MKRdxPat<app_data> *rdx_load = new MKRdxPat<app_data>(10, NUM_KEYS, MAX_KEY_BYTES);
+        std::stringstream is(dump.str());
+        os << "return code = " << rdx_load->load(is) << ", alloc_nodes() = " << rdx_load->alloc_nodes() << "\n";
+        os << "ids = ";
+        for ( MKRdxPat<app_data>::iterator it = rdx_load->begin(0) ; it != rdx_load->end(0) ; ++it )
+        {
+            os << it->id << " ";
+        }
+        os << "\n";
+        set_key(7);
+        rdx_key[1][0] = 0;  // set key boolean to 0 - search with key 0 only
+        app_datap = rdx_load->search((unsigned char *)rdx_key);
+        os << "10.0.0.7 id = " << ( app_datap != NULL ? app_datap->id : -1 ) << "\n";
+        set_key(7);
+        rdx_key[0][0] = 0;  // set key boolean to 0 - search with key 1 only
+        app_datap = rdx_load->search((unsigned char *)rdx_key);
+        os << "21 id = " << ( app_datap != NULL ? app_datap->id : -1 ) << "\n\n";
+
+        os << "d. load() the dump again\n";
+        is.clear();
+        is.str(dump.str());
+        os << "return code = " << rdx_load->load(is) << "\n\n";
+        delete rdx_load;
+
+        os << "e. load() the dump into a trie of 5 data nodes\n";
+        rdx_load = new MKRdxPat<app_data>(5, NUM_KEYS, MAX_KEY_BYTES);
+        is.clear();
+        is.str(dump.str());
+        os << "return code = " << rdx_load->load(is) << "\n\n";
+        delete rdx_load;
+
+        os << "f. load() the dump cut short by one byte\n";
+        rdx_load = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES);
+        is.clear();
+        is.str(dump.str().substr(0, dump.str().size()-1));
+        os << "return code = " << rdx_load->load(is) << ", alloc_nodes() = " << rdx_load->alloc_nodes() << "\n\n";
+        delete rdx_load;
+
+        os << "g. load() the dump into a trie with 3 byte keys\n";
+        rdx_load = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, 3);
+        is.clear();
+        is.str(dump.str());
+        os << "return code = " << rdx_load->load(is) << "\n\n";
+        delete rdx_load;
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 41
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 200;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // key index 1 is non-unique
+        const unsigned char NONUNIQUE[NUM_KEYS] = { 0, 1 };
+
+        // rdx search key(s) - key[NUM_KEYS][1+MAX_KEY_BYTES]
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // bulk_load() keys and app_data
+        unsigned char key[MAX_RDX_NODES][NUM_KEYS][1+MAX_KEY_BYTES];
+        app_data data[MAX_RDX_NODES];
+
+        app_data *app_datap;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST41.results");
+
+        os << "\n"
+              "TEST 41: bulk_load() keeps the key[][][] order of identical keys in a non-unique key index\n"
+              "         Expected Results:\n"
+              "            a. bulk_load() 200 data nodes with id i - key 0 i and non-unique key 1 7 for i%3 = 0 and i%5\n"
+              "               otherwise, i = 0 to 199 - return code 0\n"
+              "            b. search() by key 1 alone for 0 to 4 and 7 - the first id of each key in key[][][] order -\n"
+              "               ids 5, 1, 2, 8, 4 and 0\n"
+              "            c. remove() by key 1 = 7 alone 5 times - ids 0, 3, 6, 9 and 12\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, 0, NONUNIQUE);
+
+        memset(key, 0, sizeof(key));
+        for ( int i = 0 ; i < MAX_RDX_NODES ; i++ )
+        {
+            key[i][0][0] = 1;  // set key boolean to 1
+            key[i][0][4] = i;
+            key[i][1][0] = 1;  // set key boolean to 1
+            key[i][1][4] = ( i%3 == 0 ) ? 7 : i%5;
+            data[i].id = i;
+        }
+
+        os << "a. bulk_load() 200 data nodes\n";
+        os << "return code = " << rdx->bulk_load((unsigned char *)key, data, MAX_RDX_NODES) << "\n\n";
+
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[1][0] = 1;  // set key boolean to 1 - search with key 1 only
+
+        os << "b. search() by key 1 alone\n";
+        const int key1s[] = { 0, 1, 2, 3, 4, 7 };
+        for ( int v : key1s )
+        {
+            rdx_key[1][4] = v;
+            app_datap = rdx->search((unsigned char *)rdx_key);
+            os << "key 1 = " << v << " id = " << ( app_datap != NULL ? app_datap->id : -1 ) << "\n";
+        }
+        os << "\n";
+
+        os << "c. remove() by key 1 = 7 alone 5 times\n";
+        os << "ids = ";
+        rdx_key[1][4] = 7;
+        for ( int i = 0 ; i < 5 ; i++ )
+        {
+            app_datap = rdx->remove((unsigned char *)rdx_key);
+            os << ( app_datap != NULL ? app_datap->id : -1 ) << " ";
+        }
+        os << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 42
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        int return_code;
+
+        app_data *app_datap;
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 8;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 1;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // NUM_KEYS keys of MAX_KEY_BYTES bytes - set all key booleans to 1
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // bulk_load() keys and app_data - two identical keys
+        unsigned char key[2][NUM_KEYS][1+MAX_KEY_BYTES];
+        app_data data[2];
+
+        // the handles of the data nodes with ids 1 to 8
+        MKRdxPat<app_data>::node_handle handle[MAX_RDX_NODES];
+
+        ofstream os;
+        os.open("MKRdxPat.TEST42.results");
+
+        os << "\n"
+              "TEST 42: A bulk_load() that fails after clear() leaves no expiry times or wheel links behind\n"
+              "         Expected Results:\n"
+              "            a. insert 8 data nodes into a trie constructed with RDX_EXPIRY - key 0 IPv4 address 10.0.0.n with\n"
+              "               id n - and set_expiry() 100+n for n = 1 to 8, then clear()\n"
+              "            b. bulk_load() 2 data nodes with identical keys - return code 1\n"
+              "            c. insert the 8 data nodes again - expiry() of each 0\n"
+              "            d. set_expiry() 50 for each, expire() now 60 - expired ids 1 to 8 - return_code 8, 0 nodes\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, RDX_EXPIRY);
+
+        os << "a. insert 8 data nodes - 10.0.0.n with id n - and set_expiry() 100+n for n = 1 to 8, then clear()\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[0][1] = 10;
+        for ( int i = 0 ; i < MAX_RDX_NODES ; i++ )
+        {
+            rdx_key[0][4] = i+1;
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &handle[i]);
+            app_datap->id = i+1;
+            return_code |= rdx->set_expiry(handle[i], 100+i+1);
+            os << "id = " << i+1 << " return_code = " << return_code << "\n";
+        }
+        rdx->clear();
+        os << "nodes = " << rdx->alloc_nodes() << "\n\n";
+
+        os << "b. bulk_load() 2 data nodes with identical keys\n";
+        memset(key, 0, sizeof(key));
+        for ( int i = 0 ; i < 2 ; i++ )
+        {
+            key[i][0][0] = 1;  // set key boolean to 1
+            key[i][0][1] = 10;
+            key[i][0][4] = 1;
+            data[i].id = i+1;
+        }
+        os << "return code = " << rdx->bulk_load((unsigned char *)key, data, 2) << "\n\n";
+
+        os << "c. insert the 8 data nodes again\n";
+        for ( int i = 0 ; i < MAX_RDX_NODES ; i++ )
+        {
+            rdx_key[0][4] = i+1;
+            return_code = rdx->insert((unsigned char *)rdx_key, &app_datap, &handle[i]);
+            app_datap->id = i+1;
+            os << "id = " << i+1 << " return_code = " << return_code << " expiry = " << rdx->expiry(handle[i]) << "\n";
+        }
+        os << "\n";
+
+        os << "d. set_expiry() 50 for each, expire() now 60\n";
+        for ( int i = 0 ; i < MAX_RDX_NODES ; i++ )
+        {
+            rdx->set_expiry(handle[i], 50);
+        }
+        os << "expired ids = ";
+        return_code = rdx->expire(60, MAX_RDX_NODES, [&](app_data *app_datap, MKRdxPat<app_data>::node_handle handle) -> int
+                                                     {
+                                                         os << app_datap->id << " ";
+                                                         return 0;
+                                                     });
+        os << "\nreturn_code = " << return_code << " nodes = " << rdx->alloc_nodes() << "\n\n";
+
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 43
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 20;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // both key indexes are non-unique
+        const unsigned char NONUNIQUE[NUM_KEYS] = { 1, 1 };
+
+        // rdx search key(s) - key[NUM_KEYS][1+MAX_KEY_BYTES]
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        app_data *app_datap;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST43.results");
+
+        os << "\n"
+              "TEST 43: dump() and load() keep the list order of identical keys in non-unique key indexes\n"
+              "         Expected Results:\n"
+              "            a. insert 12 data nodes - key 0 n%3 and key 1 n%4 with id n, n = 11 down to 0 - into a trie with\n"
+              "               both key indexes non-unique - key 0 order ids 9 6 3 0 10 7 4 1 11 8 5 2, key 1 order ids\n"
+              "               8 4 0 9 5 1 10 6 2 11 7 3\n"
+              "            b. dump() the trie - 12 data nodes written, 56 + 12*(2*4+4+4) + 8 = 256 bytes\n"
+              "            c. load() the dump into an empty trie with both key indexes non-unique - return code 0, the same\n"
+              "               key 0 and key 1 orders as a.\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, 0, NONUNIQUE);
+
+        auto print_orders = [&](MKRdxPat<app_data> *t)
+                            {
+                                for ( int k = 0 ; k < NUM_KEYS ; k++ )
+                                {
+                                    os << "key " << k << " order ids = ";
+                                    for ( MKRdxPat<app_data>::iterator it = t->begin(k) ; it != t->end(k) ; ++it )
+                                    {
+                                        os << it->id << " ";
+                                    }
+                                    os << "\n";
+                                }
+                            };
+
+        os << "a. insert 12 data nodes\n";
+        memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+        rdx_key[0][0] = 1;  // set key boolean to 1
+        rdx_key[1][0] = 1;  // set key boolean to 1
+        for ( int n = 11 ; n >= 0 ; n-- )
+        {
+            rdx_key[0][4] = n%3;
+            rdx_key[1][4] = n%4;
+            rdx->insert((unsigned char *)rdx_key, &app_datap);
+            app_datap->id = n;
+        }
+        print_orders(rdx);
+        os << "\n";
+
+        os << "b. dump() the trie\n";
+        std::stringstream dump;
+        os << "data nodes written = " << rdx->dump(dump) << ", bytes = " << dump.str().size() << "\n\n";
+
+        os << "c. load() the dump into an empty trie\n";
+        MKRdxPat<app_data> *rdx_load = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, 0, NONUNIQUE);
+        std::stringstream is(dump.str());
+        os << "return code = " << rdx_load->load(is) << "\n";
+        print_orders(rdx_load);
+        os << "\n";
+
+        delete rdx_load;
+        delete rdx;
+
+        os.close();
+    }
+
+    {  // TEST 44
+        // application data of type app_data defined here
+        struct app_data
+        {
+            int id;
+        };
+
+        // maximum number of data nodes stored in rdx trie
+        const int MAX_RDX_NODES = 10;
+
+        // number of rdx search keys
+        const int NUM_KEYS = 2;
+
+        // number of bytes in each key(s)
+        const int MAX_KEY_BYTES = 4;
+
+        // key index 1 is non-unique
+        const unsigned char NONUNIQUE[NUM_KEYS] = { 0, 1 };
+
+        // rdx search key(s) - key[NUM_KEYS][1+MAX_KEY_BYTES]
+        unsigned char rdx_key[NUM_KEYS][1+MAX_KEY_BYTES];
+
+        // key 0 and key 1 of the data nodes inserted in turn
+        const int key0s[] = { 1, 2, 3, 4 };
+        const int key1s[] = { 7, 8, 8, 8 };
+
+        app_data *app_datap;
+        MKRdxPat<app_data>::node_handle handle;
+
+        ofstream os;
+        os.open("MKRdxPat.TEST44.results");
+
+        os << "\n"
+              "TEST 44: chg_max_rdx_nodes() keeps the list order of identical keys in a non-unique key index\n"
+              "         Expected Results:\n"
+              "            a. insert ids 1, 2 and 3 - key 0 1 2 3, non-unique key 1 7 8 8 - remove() id 1 and insert id 4 -\n"
+              "               key 0 4, key 1 8 - into the freed data node - handles 1 2 3 1\n"
+              "            b. key 1 order ids 2 3 4, search() by key 1 = 8 alone id 2\n"
+              "            c. chg_max_rdx_nodes(20) - key 1 order ids 2 3 4, search() by key 1 = 8 alone id 2\n"
+              "            d. remove() by key 1 = 8 alone 3 times from the copy - ids 2 3 4\n\n";
+
+
+        os << "MAX_RDX_NODES = " << MAX_RDX_NODES << "\n"
+              "NUM_KEYS = " << NUM_KEYS << "\n"
+              "MAX_KEY_BYTES = " << MAX_KEY_BYTES << "\n\n";
+
+        MKRdxPat<app_data> *rdx = new MKRdxPat<app_data>(MAX_RDX_NODES, NUM_KEYS, MAX_KEY_BYTES, 0, NONUNIQUE);
+
+        auto set_key = [&](int i)
+                       {
+                           memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+                           rdx_key[0][0] = 1;  // set key boolean to 1
+                           rdx_key[0][4] = key0s[i];
+                           rdx_key[1][0] = 1;  // set key boolean to 1
+                           rdx_key[1][4] = key1s[i];
+                       };
+
+        auto print_key1 = [&](MKRdxPat<app_data> *t)
+                          {
+                              os << "key 1 order ids = ";
+                              for ( MKRdxPat<app_data>::iterator it = t->begin(1) ; it != t->end(1) ; ++it )
+                              {
+                                  os << it->id << " ";
+                              }
+                              os << "\n";
+
+                              memset(rdx_key, 0, NUM_KEYS * (1+MAX_KEY_BYTES));
+                              rdx_key[1][0] = 1;  // set key boolean to 1 - search with key 1 only
+                              rdx_key[1][4] = 8;
+                              app_datap = t->search((unsigned char *)rdx_key);
+                              os << "key 1 = 8 id = " << ( app_datap != NULL ? app_datap->id : -1 ) << "\n\n";
+                          };
+
+        os << "a. insert ids 1 2 3, remove() id 1, insert id 4\n";
+        os << "handles = ";
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            set_key(i);
+            rdx->insert((unsigned char *)rdx_key, &app_datap, &handle);
+            app_datap->id = i+1;
+            os << handle << " ";
+        }
+        set_key(0);
+        rdx_key[1][0] = 0;  // set key boolean to 0 - remove with key 0 only
+        rdx->remove((unsigned char *)rdx_key);
+        set_key(3);
+        rdx->insert((unsigned char *)rdx_key, &app_datap, &handle);
+        app_datap->id = 4;
+        os << handle << "\n\n";
+
+        os << "b. the original trie\n";
+        print_key1(rdx);
+
+        os << "c. chg_max_rdx_nodes(20)\n";
+        MKRdxPat<app_data> *rdx_new = rdx->chg_max_rdx_nodes(20);
+        print_key1(rdx_new);
+
+        os << "d. remove() by key 1 = 8 alone 3 times from the copy\n";
+        os << "ids = ";
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            app_datap = rdx_new->remove((unsigned char *)rdx_key);
+            os << ( app_datap != NULL ? app_datap->id : -1 ) << " ";
+        }
+        os << "\n\n";
+
+        delete rdx_new;
+        delete rdx;
+
+        os.close();
+    }
 }
 